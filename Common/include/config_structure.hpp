@@ -169,6 +169,7 @@ private:
   su2double **DV_Value;		/*!< \brief Previous value of the design variable. */
   su2double Venkat_LimiterCoeff;				/*!< \brief Limiter coefficient */
   unsigned long LimiterIter;	/*!< \brief Freeze the value of the limiter after a number of iterations */
+  unsigned long Edge_Coloring_Group_Size;  /*!< \brief Number of consecutive edges colored as one group for the threaded edge loops. */
   su2double AdjSharp_LimiterCoeff;				/*!< \brief Coefficient to identify the limit of a sharp edge. */
   unsigned short SystemMeasurements; /*!< \brief System of measurements. */
   unsigned short Kind_Regime;  /*!< \brief Kind of adjoint function. */
@@ -561,7 +562,16 @@ private:
   unsigned long Linear_Solver_Iter_FSI_Struc;		/*!< \brief Max iterations of the linear solver for FSI applications and structural solver. */
   unsigned long Linear_Solver_Iter_Heat;       /*!< \brief Max iterations of the linear solver for the implicit formulation in the fvm heat solver. */
   unsigned long Linear_Solver_Restart_Frequency;   /*!< \brief Restart frequency of the linear solver for the implicit formulation. */
+  bool Linear_Solver_Fused_Reductions;             /*!< \brief Use the variants of FGMRES and BCGSTAB with fused (fewer) global reductions. */
+  unsigned long Linear_Solver_Recycle_Size;        /*!< \brief Size of the Krylov subspace recycled by FGMRES between linear solves. */
+  unsigned long Linear_Solver_Prec_Reuse;          /*!< \brief Maximum number of consecutive linear solves that reuse the preconditioner. */
+  su2double Linear_Solver_Prec_Degradation;        /*!< \brief Loss of convergence rate that triggers the rebuild of a reused preconditioner. */
+  bool Newton_Krylov;                              /*!< \brief Matrix-free (Jacobian-free) Newton-Krylov mode of the implicit flow solver. */
+  su2double Newton_Krylov_Epsilon;                 /*!< \brief Relative finite difference step of the matrix-free Jacobian-vector product. */
+  bool Reproducible_Reductions;                    /*!< \brief Global sums (dot products, residual norms) independent of the number of ranks. */
   unsigned short Linear_Solver_ILU_n;		/*!< \brief ILU fill=in level. */
+  unsigned short Linear_Solver_AMG_Levels;  /*!< \brief Maximum number of levels of the AMG preconditioner. */
+  su2double Linear_Solver_AMG_Strength;     /*!< \brief Strength of connection threshold of the AMG aggregation. */
   su2double SemiSpan;		/*!< \brief Wing Semi span. */
   su2double Roe_Kappa;		/*!< \brief Relaxation of the Roe scheme. */
   su2double Relaxation_Factor_Flow;		/*!< \brief Relaxation coefficient of the linear solver mean flow. */
@@ -705,6 +715,16 @@ private:
   unsigned short Analytical_Surface;	/*!< \brief Information about the analytical definition of the surface for grid adaptation. */
   unsigned short Geo_Description;	/*!< \brief Description of the geometry. */
   unsigned short Mesh_FileFormat;	/*!< \brief Mesh input format. */
+  unsigned short Mesh_Out_FileFormat;	/*!< \brief Mesh output format (SU2_DEF). */
+  unsigned short Kind_Partitioner;	/*!< \brief Partitioner of the grid (ParMETIS or Hilbert curve). */
+  bool Partition_Cache;	/*!< \brief Reuse the partition of the grid computed in a previous run. */
+  string Partition_Cache_FileName;	/*!< \brief Prefix of the partition cache files. */
+  unsigned short Kind_Partition_Weights;	/*!< \brief Vertex weights of the graph partitioning. */
+  string Partition_Weights_FileName;	/*!< \brief File of the point weights measured in a previous run. */
+  bool Wrt_Partition_Weights;	/*!< \brief Write the measured point weights with the solution files. */
+  unsigned long Load_Balance_Freq;	/*!< \brief Iterations between the checks of the load imbalance (0 to disable). */
+  su2double Load_Balance_Threshold;	/*!< \brief Load imbalance (max/mean-1) above which the grid is repartitioned. */
+  bool Load_Balance_Restart;	/*!< \brief Stop (with a restart) to repartition when the imbalance is above the threshold. */
   unsigned short Output_FileFormat;	/*!< \brief Format of the output files. */
   unsigned short ActDisk_Jump;	/*!< \brief Format of the output files. */
   bool CFL_Adapt;      /*!< \brief Adaptive CFL number. */
@@ -2381,6 +2401,12 @@ public:
    * \return Number of iterations.
    */
   unsigned long GetLimiterIter(void);
+
+  /*!
+   * \brief Get the number of consecutive edges that are colored as one group for the threaded edge loops.
+   * \return Size of the edge groups.
+   */
+  unsigned long GetEdge_Coloring_Group_Size(void);
   
   /*!
    * \brief Get the value of sharp edge limiter.
@@ -4044,11 +4070,65 @@ public:
    */
   unsigned short GetLinear_Solver_ILU_n(void);
 
+  /*!
+   * \brief Get the maximum number of levels of the AMG preconditioner.
+   * \return Maximum number of levels (including the fine level).
+   */
+  unsigned short GetLinear_Solver_AMG_Levels(void);
+
+  /*!
+   * \brief Get the strength of connection threshold of the AMG aggregation.
+   * \return Threshold on the fine level, it is halved on each coarser level.
+   */
+  su2double GetLinear_Solver_AMG_Strength(void);
+
   /*!
    * \brief Get restart frequency of the linear solver for the implicit formulation.
    * \return Restart frequency of the linear solver for the implicit formulation.
    */
   unsigned long GetLinear_Solver_Restart_Frequency(void);
+
+  /*!
+   * \brief Get whether the Krylov solvers fuse their global reductions (classical Gram-Schmidt in FGMRES, single-reduction BCGSTAB).
+   * \return <code>TRUE</code> if the fused variants are used.
+   */
+  bool GetLinear_Solver_Fused_Reductions(void);
+
+  /*!
+   * \brief Get the size of the subspace recycled by FGMRES between consecutive linear solves (0 disables recycling).
+   * \return Number of recycled vectors.
+   */
+  unsigned long GetLinear_Solver_Recycle_Size(void);
+
+  /*!
+   * \brief Get the maximum number of consecutive linear solves that reuse the preconditioner (0 rebuilds it for every solve).
+   * \return Maximum age of the preconditioner.
+   */
+  unsigned long GetLinear_Solver_Prec_Reuse(void);
+
+  /*!
+   * \brief Get the factor by which the convergence rate of the linear solver may degrade before a reused preconditioner is rebuilt.
+   * \return Degradation factor.
+   */
+  su2double GetLinear_Solver_Prec_Degradation(void);
+
+  /*!
+   * \brief Get whether the implicit flow solver uses the matrix-free Newton-Krylov mode.
+   * \return <code>TRUE</code> if the Jacobian-vector products are evaluated from the residual.
+   */
+  bool GetNewton_Krylov(void);
+
+  /*!
+   * \brief Get the relative finite difference step of the matrix-free Jacobian-vector product.
+   * \return Relative step size.
+   */
+  su2double GetNewton_Krylov_Epsilon(void);
+
+  /*!
+   * \brief Get whether the global sums of the linear solvers and residual monitors are exact (reproducible).
+   * \return <code>TRUE</code> if the results of the reductions do not depend on the number of ranks.
+   */
+  bool GetReproducible_Reductions(void);
   
   /*!
    * \brief Get the relaxation factor for iterative linear smoothers.
@@ -4376,6 +4456,14 @@ public:
    */
   unsigned short GetKind_TimeIntScheme_Flow(void);
 
+  /*!
+   * \brief Set the kind of integration scheme for the flow equations.
+   * \note Only used by the matrix-free Newton-Krylov product, to evaluate the residual
+   *       without assembling the Jacobian, the implicit scheme is restored afterwards.
+   * \param[in] val_kind_timeintscheme - Kind of time integration scheme.
+   */
+  void SetKind_TimeIntScheme_Flow(unsigned short val_kind_timeintscheme);
+
   /*!
    * \brief Get the kind of scheme (aliased or non-aliased) to be used in the
    *        predictor step of ADER-DG.
@@ -5407,6 +5495,70 @@ public:
    */
   unsigned short GetMesh_FileFormat(void);
   
+  /*!
+   * \brief Get the format of the grid written by SU2_DEF (SU2 or SU2_BINARY).
+   * \return Format of the output grid.
+   */
+  unsigned short GetMesh_Out_FileFormat(void);
+  
+  /*!
+   * \brief Check if the partition of the grid is cached (and reused) between runs.
+   * \note Only the colors of the points are cached, not the structures built from them.
+   * \return <code>TRUE</code> if the partition cache is used.
+   */
+  bool GetPartition_Cache(void);
+  
+  /*!
+   * \brief Get the partitioner of the grid.
+   * \return Partitioner of the grid (PARMETIS or HILBERT).
+   */
+  unsigned short GetKind_Partitioner(void);
+  
+  /*!
+   * \brief Get the prefix of the partition cache files, the full name also has the
+   *        hash of the grid topology and the number of ranks.
+   * \return Prefix of the partition cache files.
+   */
+  string GetPartition_Cache_FileName(void);
+  
+  /*!
+   * \brief Get the kind of vertex weights of the graph partitioning.
+   * \return Vertex weights (NONE, COST_MODEL or MEASURED).
+   */
+  unsigned short GetKind_Partition_Weights(void);
+  
+  /*!
+   * \brief Get the name of the file of the measured point weights.
+   * \return Name of the partition weights file.
+   */
+  string GetPartition_Weights_FileName(void);
+  
+  /*!
+   * \brief Check if the measured point weights are written with the solution files.
+   * \return <code>TRUE</code> if the partition weights file is written.
+   */
+  bool GetWrt_Partition_Weights(void);
+  
+  /*!
+   * \brief Get the number of iterations between the checks of the load imbalance.
+   * \return Frequency of the load balance checks (0 if they are disabled).
+   */
+  unsigned long GetLoad_Balance_Freq(void);
+  
+  /*!
+   * \brief Get the load imbalance (maximum over mean time of the ranks, minus one) above
+   *        which the grid should be repartitioned.
+   * \return Threshold of the load imbalance.
+   */
+  su2double GetLoad_Balance_Threshold(void);
+  
+  /*!
+   * \brief Check if the run stops (writing a restart and the measured partition weights)
+   *        when the load imbalance is above the threshold.
+   * \return <code>TRUE</code> if the run stops to be repartitioned.
+   */
+  bool GetLoad_Balance_Restart(void);
+  
   /*!
    * \brief Get the format of the output solution.
    * \return Format of the output solution.
@@ -620,6 +620,8 @@ inline su2double CConfig::GetVenkat_LimiterCoeff(void) { return Venkat_LimiterCo
 
 inline unsigned long CConfig::GetLimiterIter(void) { return LimiterIter; }
 
+inline unsigned long CConfig::GetEdge_Coloring_Group_Size(void) { return Edge_Coloring_Group_Size; }
+
 inline su2double CConfig::GetAdjSharp_LimiterCoeff(void) { return AdjSharp_LimiterCoeff; }
 
 inline su2double CConfig::GetReynolds(void) { return Reynolds; }
@@ -1025,8 +1027,26 @@ inline unsigned long CConfig::GetDeform_Linear_Solver_Iter(void) { return Deform
 
 inline unsigned short CConfig::GetLinear_Solver_ILU_n(void) { return Linear_Solver_ILU_n; }
 
+inline unsigned short CConfig::GetLinear_Solver_AMG_Levels(void) { return Linear_Solver_AMG_Levels; }
+
+inline su2double CConfig::GetLinear_Solver_AMG_Strength(void) { return Linear_Solver_AMG_Strength; }
+
 inline unsigned long CConfig::GetLinear_Solver_Restart_Frequency(void) { return Linear_Solver_Restart_Frequency; }
 
+inline bool CConfig::GetLinear_Solver_Fused_Reductions(void) { return Linear_Solver_Fused_Reductions; }
+
+inline unsigned long CConfig::GetLinear_Solver_Recycle_Size(void) { return Linear_Solver_Recycle_Size; }
+
+inline unsigned long CConfig::GetLinear_Solver_Prec_Reuse(void) { return Linear_Solver_Prec_Reuse; }
+
+inline su2double CConfig::GetLinear_Solver_Prec_Degradation(void) { return Linear_Solver_Prec_Degradation; }
+
+inline bool CConfig::GetNewton_Krylov(void) { return Newton_Krylov; }
+
+inline su2double CConfig::GetNewton_Krylov_Epsilon(void) { return Newton_Krylov_Epsilon; }
+
+inline bool CConfig::GetReproducible_Reductions(void) { return Reproducible_Reductions; }
+
 inline su2double CConfig::GetLinear_Solver_Smoother_Relaxation(void) const { return Linear_Solver_Smoother_Relaxation; }
 
 inline su2double CConfig::GetRelaxation_Factor_Flow(void) { return Relaxation_Factor_Flow; }
@@ -1109,6 +1129,8 @@ inline bool CConfig::GetMUSCL_AdjTurb(void) { return MUSCL_AdjTurb; }
 
 inline unsigned short CConfig::GetKind_TimeIntScheme_Flow(void) { return Kind_TimeIntScheme_Flow; }
 
+inline void CConfig::SetKind_TimeIntScheme_Flow(unsigned short val_kind_timeintscheme) { Kind_TimeIntScheme_Flow = val_kind_timeintscheme; }
+
 inline unsigned short CConfig::GetKind_ADER_Predictor(void) { return Kind_ADER_Predictor; }
 
 inline unsigned short CConfig::GetKind_TimeIntScheme_Heat(void) { return Kind_TimeIntScheme_Heat; }
@@ -1464,6 +1486,26 @@ inline string CConfig::GetMesh_Out_FileName(void) { return Mesh_Out_FileName; }
 
 inline unsigned short CConfig::GetMesh_FileFormat(void) { return Mesh_FileFormat; }
 
+inline unsigned short CConfig::GetMesh_Out_FileFormat(void) { return Mesh_Out_FileFormat; }
+
+inline bool CConfig::GetPartition_Cache(void) { return Partition_Cache; }
+
+inline unsigned short CConfig::GetKind_Partitioner(void) { return Kind_Partitioner; }
+
+inline string CConfig::GetPartition_Cache_FileName(void) { return Partition_Cache_FileName; }
+
+inline unsigned short CConfig::GetKind_Partition_Weights(void) { return Kind_Partition_Weights; }
+
+inline string CConfig::GetPartition_Weights_FileName(void) { return Partition_Weights_FileName; }
+
+inline bool CConfig::GetWrt_Partition_Weights(void) { return Wrt_Partition_Weights; }
+
+inline unsigned long CConfig::GetLoad_Balance_Freq(void) { return Load_Balance_Freq; }
+
+inline su2double CConfig::GetLoad_Balance_Threshold(void) { return Load_Balance_Threshold; }
+
+inline bool CConfig::GetLoad_Balance_Restart(void) { return Load_Balance_Restart; }
+
 inline unsigned short CConfig::GetOutput_FileFormat(void) { return Output_FileFormat; }
 
 inline unsigned short CConfig::GetActDisk_Jump(void) { return ActDisk_Jump; }
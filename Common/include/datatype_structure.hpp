@@ -63,6 +63,27 @@
 
 typedef double passivedouble;
 
+/*--- Type of the linear algebra (Jacobian, preconditioners and Krylov vectors) of the implicit solvers.
+ * It is single precision when configured with --enable-mixed-precision, only for the primal (passive)
+ * build, since the AD tapes and the adjoint linear solvers expect double precision. ---*/
+
+#if defined USE_MIXED_PRECISION && !defined CODI_REVERSE_TYPE && !defined CODI_FORWARD_TYPE
+#define SU2_MIXED_PRECISION
+typedef float su2mixedfloat;
+#else
+typedef passivedouble su2mixedfloat;
+#endif
+
+/*--- Type of the rank-local indices of the sparse matrices (row pointers and column indices).
+ * The number of blocks of the matrix of one rank fits in 32 bits for any practical partition,
+ * configuring with --enable-long-sparse-index selects 64 bit indices. ---*/
+
+#ifdef USE_LONG_SPARSE_INDEX
+typedef unsigned long su2sparseidx;
+#else
+typedef unsigned int su2sparseidx;
+#endif
+
 /*!
  * \namespace SU2_TYPE
  * \brief Namespace for defining the datatype wrapper routines; this class features as a base class for
@@ -350,6 +350,12 @@ public:
 	 * \param[in] val_point - Point to be added.		 
 	 */
 	void SetPoint(unsigned long val_point);
+
+  /*!
+   * \brief Set all the points that compose the control volume at once, the list must not have duplicates.
+   * \param[in] val_points - Points surrounding the central node of the control volume.
+   */
+  void SetPoints(const vector<unsigned long> &val_points);
 	
 	/*! 
 	 * \brief Set the edges that compose the control volume.
@@ -802,6 +808,7 @@ private:
 	su2double *Coord_CG;			/*!< \brief Center-of-gravity of the element. */
 	unsigned long *Nodes;		/*!< \brief Vector to store the global nodes of an element. */
 	su2double *Normal;				/*!< \brief Normal al elemento y coordenadas de su centro de gravedad. */
+	bool External_Storage;		/*!< \brief Nodes and Normal point into the flat edge arrays of the geometry. */
 
 public:
 		
@@ -817,6 +824,13 @@ public:
 	 * \brief Destructor of the class. 
 	 */
 	~CEdge(void);
+
+	/*!
+	 * \brief Move the nodes and the normal of the edge into the flat edge arrays of the geometry.
+	 * \param[in] val_nodes - Location of the two nodes of the edge.
+	 * \param[in] val_normal - Location of the nDim components of the normal.
+	 */
+	void SetExternalStorage(unsigned long *val_nodes, su2double *val_normal);
 	
 	/*! 
 	 * \brief Set the center of gravity of the edge.
@@ -838,6 +852,12 @@ public:
 	 */
 	
 	unsigned long GetNode(unsigned short val_node);
+
+	/*!
+	 * \brief Get both nodes of the edge.
+	 * \return Pointer to the two nodes of the edge.
+	 */
+	unsigned long *GetNodes(void);
 	
 	/*! 
 	 * \brief Get the number of nodes of an element.
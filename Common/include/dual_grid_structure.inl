@@ -45,6 +45,8 @@ inline void CPoint::ResetElem(void) { Elem.clear(); nElem = 0; }
 
 inline void CPoint::ResetPoint(void) { Point.clear(); Edge.clear(); nPoint = 0; }
 
+inline void CPoint::SetPoints(const vector<unsigned long> &val_points) { Point = val_points; Edge.assign(Point.size(), -1); nPoint = Point.size(); }
+
 inline su2double CPoint::GetCoord(unsigned short val_dim) { return Coord[val_dim]; }
 
 inline su2double *CPoint::GetCoord(void) { return Coord; }
@@ -272,6 +274,8 @@ inline unsigned short CEdge::GetnNodes() { return 2; }
 
 inline unsigned long CEdge::GetNode(unsigned short val_node) { return Nodes[val_node]; }
 
+inline unsigned long *CEdge::GetNodes(void) { return Nodes; }
+
 inline su2double CEdge::GetCG(unsigned short val_dim) { return Coord_CG[val_dim]; }
 
 inline su2double *CEdge::GetNormal(void) {	return Normal; }
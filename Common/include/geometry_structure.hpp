@@ -303,6 +303,18 @@ protected:
   unsigned short MGLevel;         /*!< \brief The mesh level index for the current geometry container. */
   unsigned long Max_GlobalPoint;  /*!< \brief Greater global point in the domain local structure. */
 
+  /*--- Edge ordering and coloring for the edge loops. ---*/
+  vector<unsigned long> EdgeColorPtr;   /*!< \brief First edge of each color (the last entry is nEdge). */
+  unsigned long EdgeColorGroupSize;     /*!< \brief Number of consecutive edges of a color that share no point with the other groups of the color. */
+  unsigned long *EdgeNodes;             /*!< \brief Flat array with the two nodes of each edge (nEdge x 2). */
+  su2double *EdgeNormals;               /*!< \brief Flat array with the normal of each edge (nEdge x nDim). */
+
+  /*!
+   * \brief Renumber the edges, updating the edge indices stored by the points.
+   * \param[in] Order - Old index of each new edge.
+   */
+  void ReorderEdges(const vector<unsigned long> &Order);
+
   /* --- Custom boundary variables --- */
   su2double **CustomBoundaryTemperature;
   su2double **CustomBoundaryHeatFlux;
@@ -393,6 +405,24 @@ public:
   unsigned short *bufS_P2PSend;       /*!< \brief Data structure for unsigned long point-to-point send. */
   SU2_MPI::Request *req_P2PSend;      /*!< \brief Data structure for point-to-point send requests. */
   SU2_MPI::Request *req_P2PRecv;      /*!< \brief Data structure for point-to-point recv requests. */
+  bool P2PPersistent;                 /*!< \brief Use persistent requests (MPI_Send_init/MPI_Recv_init) for the point-to-point comms. */
+  SU2_MPI::Request *reqPers_P2PSend[4]; /*!< \brief Persistent send requests, one set per data type and direction of the comms. */
+  SU2_MPI::Request *reqPers_P2PRecv[4]; /*!< \brief Persistent recv requests, one set per data type and direction of the comms. */
+  bool P2PRecv_InPlace;               /*!< \brief True if the recv points of every neighbor are a contiguous range of the local numbering. */
+  vector<su2double*> InPlace_Data;    /*!< \brief Destination arrays of the persistent requests of the in-place recvs. */
+  vector<unsigned short> InPlace_nVar; /*!< \brief Values per point of the persistent requests of the in-place recvs. */
+  vector<SU2_MPI::Request*> reqPers_InPlaceSend; /*!< \brief Persistent send requests of the in-place comms, one set per destination array. */
+  vector<SU2_MPI::Request*> reqPers_InPlaceRecv; /*!< \brief Persistent recv requests of the in-place comms, one set per destination array. */
+#ifdef HAVE_NEIGHBOR_COLLECTIVES
+  SU2_MPI::Comm P2PGraphComm[2];      /*!< \brief Distributed graph communicators of the halo exchange (forward and reverse). */
+  SU2_MPI::Request req_P2PGraph;      /*!< \brief Request of the neighborhood collective of the halo exchange. */
+  int *P2PGraph_SendCounts;           /*!< \brief Send counts of the neighborhood collective. */
+  int *P2PGraph_SendDispls;           /*!< \brief Send displacements of the neighborhood collective. */
+  int *P2PGraph_RecvCounts;           /*!< \brief Recv counts of the neighborhood collective. */
+  int *P2PGraph_RecvDispls;           /*!< \brief Recv displacements of the neighborhood collective. */
+  int *P2PGraph_Sources;              /*!< \brief Source ranks of the messages of the current exchange. */
+  int iP2PGraphRecv;                  /*!< \brief Messages of the current exchange already returned by WaitAnyP2PRecv(). */
+#endif
 
   /*--- Data structures for periodic communications. ---*/
 
@@ -440,6 +470,19 @@ public:
    */
   void AllocateP2PComms(unsigned short val_countPerPoint);
   
+  /*!
+   * \brief Routine to create the persistent requests for the point-to-point communication of a data type in one direction. The requests are bound to the current buffers, they are created on first use and freed when the buffers are reallocated.
+   * \param[in] commType    - Enumerated type for the quantity to be communicated.
+   * \param[in] val_reverse - Boolean controlling forward or reverse communication between neighbors.
+   * \return Index of the set of persistent requests.
+   */
+  unsigned short SetPersistentP2PComms(unsigned short commType, bool val_reverse);
+  
+  /*!
+   * \brief Routine to free the persistent requests of the point-to-point communications.
+   */
+  void FreePersistentP2PComms(void);
+  
   /*!
    * \brief Routine to launch non-blocking recvs only for all point-to-point communication with neighboring partitions. Note that this routine is called by any class that has loaded data into the generic communication buffers.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -459,6 +502,46 @@ public:
    */
   void PostP2PSends(CGeometry *geometry, CConfig *config, unsigned short commType, int val_iMessage, bool val_reverse);
   
+  /*!
+   * \brief Routine to set up (on first use) the persistent requests of the in-place comms into a given array.
+   * \param[in] val_data - Array (nPoint x val_nVar) that receives the data of the halo points.
+   * \param[in] val_nVar - Number of values per point.
+   * \return Index of the set of persistent requests.
+   */
+  unsigned short SetPersistentP2PComms_InPlace(su2double *val_data, unsigned short val_nVar);
+  
+  /*!
+   * \brief Routine to launch the non-blocking recvs of a forward point-to-point communication directly into the rows of the halo points of an array, without the comm buffers. Only valid if GetP2PRecv_InPlace() is true.
+   * \param[in] val_data - Array (nPoint x val_nVar) that receives the data of the halo points.
+   * \param[in] val_nVar - Number of values per point.
+   */
+  void PostP2PRecvs_InPlace(su2double *val_data, unsigned short val_nVar);
+  
+  /*!
+   * \brief Routine to launch a single non-blocking send of an in-place communication, the send buffer must be loaded with val_nVar values per point.
+   * \param[in] val_data     - Array (nPoint x val_nVar) that receives the data of the halo points.
+   * \param[in] val_nVar     - Number of values per point.
+   * \param[in] val_iMessage - Index of the message in the order they are stored.
+   */
+  void PostP2PSends_InPlace(su2double *val_data, unsigned short val_nVar, int val_iMessage);
+  
+  /*!
+   * \brief Check if the halo points of every neighbor are a contiguous range of the local numbering, i.e. if the data can be received in place.
+   * \return <code>TRUE</code> if the in-place recvs can be used; otherwise <code>FALSE</code>.
+   */
+  bool GetP2PRecv_InPlace(void);
+  
+  /*!
+   * \brief Routine to wait for one of the point-to-point recvs launched by PostP2PRecvs(), in the order the messages arrive. With the neighborhood collectives the whole exchange is completed by the first call and the messages are returned in the order of the neighbors.
+   * \return Rank from which the message was received.
+   */
+  int WaitAnyP2PRecv(void);
+  
+  /*!
+   * \brief Routine to wait for all the point-to-point sends launched by PostP2PSends().
+   */
+  void WaitAllP2PSends(void);
+  
   /*!
    * \brief Routine to set up persistent data structures for periodic communications.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -547,6 +630,62 @@ public:
 	 */
 	unsigned long GetnEdge(void);
 
+  /*!
+   * \brief Store the nodes and normals of the edges in flat arrays. When more than one thread is
+   *        used the edges are first sorted by their nodes and split in groups of consecutive edges,
+   *        the groups are colored such that no two groups of the same color share a point, and the
+   *        edges are renumbered so that each color is a contiguous range of groups. Edges of the
+   *        same group may share points (one thread processes the whole group), the groups of one
+   *        color can be processed concurrently without atomics. With a single thread the edges keep
+   *        their order (and hence the order of the sums over edges) and form one color. Calling it
+   *        again rebuilds the flat arrays from the current edges.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetEdgeColoring(CConfig *config);
+
+  /*!
+   * \brief Get the number of edge colors.
+   * \return Number of edge colors (0 if SetEdgeColoring was not called).
+   */
+  unsigned long GetnEdgeColor(void);
+
+  /*!
+   * \brief Get the first edge of a color.
+   * \param[in] val_color - Color.
+   * \return Index of the edge.
+   */
+  unsigned long GetEdgeColorBegin(unsigned long val_color);
+
+  /*!
+   * \brief Get the edge after the last edge of a color.
+   * \param[in] val_color - Color.
+   * \return Index of the edge.
+   */
+  unsigned long GetEdgeColorEnd(unsigned long val_color);
+
+  /*!
+   * \brief Get the size of the edge groups, the chunk size with which the edges of a color are
+   *        split among threads (schedule(static, size)).
+   * \return Number of edges per group.
+   */
+  unsigned long GetEdgeColorGroupSize(void);
+
+  /*!
+   * \brief Get the nodes of an edge from the flat edge arrays, or from the edge itself if the
+   *        flat arrays were not built (same as edge[iEdge]->GetNode).
+   * \param[in] val_edge - Index of the edge.
+   * \return Pointer to the two nodes of the edge.
+   */
+  unsigned long *GetEdgeNodes(unsigned long val_edge);
+
+  /*!
+   * \brief Get the normal of an edge from the flat edge arrays, or from the edge itself if the
+   *        flat arrays were not built (same as edge[iEdge]->GetNormal).
+   * \param[in] val_edge - Index of the edge.
+   * \return Pointer to the normal of the edge.
+   */
+  su2double *GetEdgeNormal(unsigned long val_edge);
+
 	/*! 
 	 * \brief Get number of markers.
 	 * \return Number of markers.
@@ -890,6 +1029,13 @@ public:
    */
   virtual void SetColorGrid_Parallel(CConfig *config);
 
+  /*!
+   * \brief A virtual member.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_time - Time of the computations of this rank.
+   */
+  virtual void WritePartitionWeights(CConfig *config, passivedouble val_time);
+
   /*!
    * \brief A virtual member.
    * \param[in] config - Definition of the particular problem.
@@ -1943,6 +2089,17 @@ public:
    */
   void Read_SU2_Format_Parallel(CConfig *config, string val_mesh_filename, unsigned short val_iZone, unsigned short val_nZone);
 
+  /*!
+   * \brief Reads the geometry of the grid from an SU2_BINARY mesh file. Each rank reads its
+   *        linear partition of the points and elements with MPI I/O, the elements are then
+   *        sent to the ranks that own their nodes (for parmetis).
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_mesh_filename - Name of the file with the grid information.
+   * \param[in] val_iZone - Domain to be read from the grid file.
+   * \param[in] val_nZone - Total number of domains in the grid file.
+   */
+  void Read_SU2_Binary_Format_Parallel(CConfig *config, string val_mesh_filename, unsigned short val_iZone, unsigned short val_nZone);
+
   /*!
    * \brief Reads the geometry of the grid and adjust the boundary
    *        conditions with the configuration file in parallel (for parmetis).
@@ -2152,6 +2309,30 @@ void UpdateTurboVertex(CConfig *config,unsigned short val_iZone, unsigned short
    */
   void SetColorGrid_Parallel(CConfig *config);
 
+  /*!
+   * \brief Set the domains for grid partitioning by cutting a Hilbert space-filling curve
+   *        through the points (of the linear partitions) in parts with the same number of points.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetColorGrid_Hilbert(CConfig *config);
+
+  /*!
+   * \brief Compute the cost model of the points of the linear partitions for the weighted
+   *        graph partitioning: the number of blocks of the row of the point in the Jacobian
+   *        plus the number of markers of the point.
+   * \param[in] config - Definition of the particular problem.
+   * \param[out] val_weight - Weight of each point of the linear partition.
+   */
+  void ComputePartitionWeights(CConfig *config, passivedouble *val_weight);
+
+  /*!
+   * \brief Write the point weights measured in this run (the time of each rank distributed
+   *        over its points with the cost model), to be used by the next partitioning.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_time - Time of the computations of this rank (without the time blocked in MPI).
+   */
+  void WritePartitionWeights(CConfig *config, passivedouble val_time);
+
   /*!
    * \brief Set the domains for FEM grid partitioning using ParMETIS.
    * \param[in] config - Definition of the particular problem.
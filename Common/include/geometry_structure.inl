@@ -125,6 +125,8 @@ inline void CGeometry::SetColorGrid(CConfig *config) { }
 
 inline void CGeometry::SetColorGrid_Parallel(CConfig *config) { }
 
+inline void CGeometry::WritePartitionWeights(CConfig *config, passivedouble val_time) { }
+
 inline void CGeometry::SetColorFEMGrid_Parallel(CConfig *config) { }
 
 inline void CGeometry::DivideConnectivity(CConfig *config, unsigned short Elem_Type) { }
@@ -213,6 +215,18 @@ inline void CGeometry::SetnVertexSpanMax(unsigned short marker_flag, unsigned lo
 
 inline unsigned long CGeometry::GetnEdge(void) { return nEdge; }
 
+inline unsigned long CGeometry::GetnEdgeColor(void) { return (EdgeColorPtr.empty())? 0 : EdgeColorPtr.size()-1; }
+
+inline unsigned long CGeometry::GetEdgeColorBegin(unsigned long val_color) { return EdgeColorPtr[val_color]; }
+
+inline unsigned long CGeometry::GetEdgeColorEnd(unsigned long val_color) { return EdgeColorPtr[val_color+1]; }
+
+inline unsigned long CGeometry::GetEdgeColorGroupSize(void) { return EdgeColorGroupSize; }
+
+inline unsigned long *CGeometry::GetEdgeNodes(unsigned long val_edge) { return (EdgeNodes != NULL)? &EdgeNodes[2*val_edge] : edge[val_edge]->GetNodes(); }
+
+inline su2double *CGeometry::GetEdgeNormal(unsigned long val_edge) { return (EdgeNormals != NULL)? &EdgeNormals[nDim*val_edge] : edge[val_edge]->GetNormal(); }
+
 inline bool CGeometry::FindFace(unsigned long first_elem, unsigned long second_elem, unsigned short &face_first_elem, unsigned short &face_second_elem) { return 0;}
 
 inline void CGeometry::SetBoundVolume(void) { }
@@ -531,3 +545,5 @@ inline su2double CPhysicalGeometry::GetMaxAngularCoord(unsigned short val_marker
 inline su2double CPhysicalGeometry::GetMinRelAngularCoord(unsigned short val_marker, unsigned short val_span){return MinRelAngularCoord[val_marker][val_span];}
 
 inline void CGeometry::Check_Periodicity(CConfig* config) {}
+
+inline bool CGeometry::GetP2PRecv_InPlace(void) { return P2PRecv_InPlace; }
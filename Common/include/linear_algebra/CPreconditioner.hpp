@@ -252,3 +252,51 @@ public:
     sparse_matrix->ComputeLineletPreconditioner(u, v, geometry, config);
   }
 };
+
+
+/*!
+ * \class CAMGPreconditioner
+ * \brief specialization of preconditioner that uses CSysMatrix class
+ */
+template<class ScalarType>
+class CAMGPreconditioner : public CPreconditioner<ScalarType> {
+private:
+  CSysMatrix<ScalarType>* sparse_matrix; /*!< \brief pointer to matrix that defines the preconditioner. */
+  CGeometry* geometry; /*!< \brief pointer to matrix that defines the geometry. */
+  CConfig* config; /*!< \brief pointer to matrix that defines the config. */
+
+  /*!
+   * \brief Default constructor of the class
+   * \note This class cannot be default constructed as that would leave us with invalid pointers.
+   */
+  CAMGPreconditioner();
+
+public:
+
+  /*!
+   * \brief constructor of the class
+   * \param[in] matrix_ref - matrix reference that will be used to define the preconditioner
+   * \param[in] geometry_ref - geometry associated with the problem
+   * \param[in] config_ref - config of the problem
+   */
+  inline CAMGPreconditioner(CSysMatrix<ScalarType> & matrix_ref,
+                            CGeometry *geometry_ref, CConfig *config_ref) {
+    sparse_matrix = &matrix_ref;
+    geometry = geometry_ref;
+    config = config_ref;
+  }
+
+  /*!
+   * \brief destructor of the class
+   */
+  ~CAMGPreconditioner() {}
+
+  /*!
+   * \brief operator that defines the preconditioner operation
+   * \param[in] u - CSysVector that is being preconditioned
+   * \param[out] v - CSysVector that is the result of the preconditioning
+   */
+  inline void operator()(const CSysVector<ScalarType> & u, CSysVector<ScalarType> & v) const {
+    sparse_matrix->ComputeAMGPreconditioner(u, v, geometry, config);
+  }
+};
@@ -0,0 +1,244 @@
+/*!
+ * \file CSysAMG.hpp
+ * \brief Smoothed aggregation algebraic multigrid, used as a preconditioner
+ *        for the block sparse matrices of CSysMatrix.
+ * \version 6.2.0 "Falcon"
+ *
+ * The current SU2 release has been coordinated by the
+ * SU2 International Developers Society <www.su2devsociety.org>
+ * with selected contributions from the open-source community.
+ *
+ * The main research teams contributing to the current release are:
+ *  - Prof. Juan J. Alonso's group at Stanford University.
+ *  - Prof. Piero Colonna's group at Delft University of Technology.
+ *  - Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+ *  - Prof. Alberto Guardone's group at Polytechnic University of Milan.
+ *  - Prof. Rafael Palacios' group at Imperial College London.
+ *  - Prof. Vincent Terrapon's group at the University of Liege.
+ *  - Prof. Edwin van der Weide's group at the University of Twente.
+ *  - Lab. of New Concepts in Aeronautics at Tech. Institute of Aeronautics.
+ *
+ * Copyright 2012-2019, Francisco D. Palacios, Thomas D. Economon,
+ *                      Tim Albring, and the SU2 contributors.
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../datatype_structure.hpp"
+#include <vector>
+
+using namespace std;
+
+/*!
+ * \class CSysAMG
+ * \brief Hierarchy of a smoothed aggregation algebraic multigrid method for
+ *        block sparse matrices (compressed row format, square nVar x nVar blocks).
+ *
+ * The points are aggregated based on the strength of the connections between
+ * blocks and the unknowns of each point are kept together, the tentative
+ * prolongation interpolates each variable by a constant over an aggregate.
+ * The hierarchy is built for the rows owned by the rank (couplings to the halo
+ * are dropped), the preconditioner is therefore additive across ranks like the
+ * ILU and LU-SGS preconditioners.
+ */
+template<class ScalarType>
+class CSysAMG {
+private:
+
+  /*!
+   * \brief Operators and work vectors of one level of the hierarchy.
+   */
+  struct CLevel {
+    unsigned long nPoint;             /*!< \brief Number of points (block rows) of the level. */
+    vector<unsigned long> row_ptr;    /*!< \brief Pointers to the first block of each row. */
+    vector<unsigned long> col_ind;    /*!< \brief Column of each block. */
+    vector<unsigned long> dia_ptr;    /*!< \brief Position of the diagonal block of each row. */
+    vector<ScalarType> matrix;        /*!< \brief Blocks of the level operator. */
+    vector<ScalarType> invDiag;       /*!< \brief Inverse of the diagonal blocks (for the smoother). */
+
+    vector<unsigned long> P_row_ptr;  /*!< \brief Pointers to the first block of each row of the prolongation to this level. */
+    vector<unsigned long> P_col_ind;  /*!< \brief Column (coarse point) of each block of the prolongation. */
+    vector<ScalarType> P_matrix;      /*!< \brief Blocks of the prolongation (from the next coarser level). */
+
+    vector<ScalarType> sol;           /*!< \brief Solution (correction) on the level. */
+    vector<ScalarType> rhs;           /*!< \brief Right hand side on the level. */
+    vector<ScalarType> res;           /*!< \brief Residual on the level. */
+  };
+
+  unsigned long nVar;                 /*!< \brief Size of the blocks. */
+  unsigned short nLevel;              /*!< \brief Number of levels in the hierarchy. */
+  vector<CLevel> Level;               /*!< \brief Levels of the hierarchy, 0 is the fine level. */
+
+  unsigned long nCoarseDOF;           /*!< \brief Number of unknowns of the coarsest level. */
+  vector<ScalarType> CoarseLU;        /*!< \brief Dense LU factorization of the coarsest level operator. */
+  vector<unsigned long> CoarsePivot;  /*!< \brief Pivots of the LU factorization. */
+  bool direct_coarse;                 /*!< \brief The coarsest level is solved exactly (else it is smoothed). */
+
+  vector<ScalarType> block, block_aux, work; /*!< \brief Block sized work arrays. */
+
+  /*!
+   * \brief Transpose a block sparse matrix (the blocks are transposed too).
+   * \param[in] nRow - Number of block rows of the matrix.
+   * \param[in] nCol - Number of block columns of the matrix.
+   * \param[in] row_ptr, col_ind, val - Matrix.
+   * \param[out] t_row_ptr, t_col_ind, t_val - Transposed matrix.
+   */
+  void BlockSparseTranspose(unsigned long nRow, unsigned long nCol,
+                            const vector<unsigned long> & row_ptr, const vector<unsigned long> & col_ind,
+                            const vector<ScalarType> & val, vector<unsigned long> & t_row_ptr,
+                            vector<unsigned long> & t_col_ind, vector<ScalarType> & t_val) const;
+
+  /*!
+   * \brief Product of two block sparse matrices, C = A * B.
+   * \param[in] nRow - Number of block rows of A.
+   * \param[in] nCol - Number of block columns of B.
+   * \param[in] a_row_ptr, a_col_ind, a_val - Matrix A.
+   * \param[in] b_row_ptr, b_col_ind, b_val - Matrix B.
+   * \param[out] c_row_ptr, c_col_ind, c_val - Matrix C.
+   */
+  void BlockSparseProduct(unsigned long nRow, unsigned long nCol,
+                          const vector<unsigned long> & a_row_ptr, const vector<unsigned long> & a_col_ind,
+                          const vector<ScalarType> & a_val, const vector<unsigned long> & b_row_ptr,
+                          const vector<unsigned long> & b_col_ind, const vector<ScalarType> & b_val,
+                          vector<unsigned long> & c_row_ptr, vector<unsigned long> & c_col_ind,
+                          vector<ScalarType> & c_val);
+
+  /*!
+   * \brief Find the diagonal blocks of a level and invert them.
+   * \param[in,out] lvl - Level.
+   */
+  void SetDiagonal(CLevel & lvl);
+
+  /*!
+   * \brief Aggregate the points of a level based on the strength of the connections.
+   * \param[in] lvl - Level.
+   * \param[in] strength - Threshold for a connection to be strong.
+   * \param[out] aggregate - Aggregate of each point.
+   * \return Number of aggregates.
+   */
+  unsigned long Aggregate(const CLevel & lvl, passivedouble strength, vector<unsigned long> & aggregate) const;
+
+  /*!
+   * \brief Build the smoothed prolongation from the aggregates, P = (I - w D^-1 A) P_tent.
+   * \param[in] lvl - Fine level, the prolongation is stored in it.
+   * \param[in] aggregate - Aggregate of each point.
+   * \param[in] nAggregate - Number of aggregates.
+   */
+  void SetProlongation(CLevel & lvl, const vector<unsigned long> & aggregate, unsigned long nAggregate);
+
+  /*!
+   * \brief Galerkin coarse operator, A_c = P^T A P.
+   * \param[in] fine - Fine level (operator and prolongation).
+   * \param[out] coarse - Coarse level.
+   */
+  void SetCoarseOperator(const CLevel & fine, CLevel & coarse);
+
+  /*!
+   * \brief Estimate the spectral radius of D^-1 A with a few power iterations.
+   */
+  ScalarType SpectralRadius(const CLevel & lvl);
+
+  /*!
+   * \brief Factorize the (dense) operator of the coarsest level.
+   */
+  void FactorizeCoarse(void);
+
+  /*!
+   * \brief Block Gauss-Seidel sweep, sol is updated in place.
+   * \param[in,out] lvl - Level.
+   * \param[in] forward - Direction of the sweep, backward sweeps make the V-cycle symmetric.
+   */
+  void Smooth(CLevel & lvl, bool forward);
+
+  /*!
+   * \brief Compute res = rhs - A * sol on a level.
+   */
+  void Residual(CLevel & lvl);
+
+  /*!
+   * \brief Recursive V-cycle starting at a level, the rhs of the level must be set.
+   */
+  void VCycle(unsigned short iLevel);
+
+public:
+
+  /*!
+   * \brief Constructor of the class.
+   */
+  CSysAMG(void);
+
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CSysAMG(void);
+
+  /*!
+   * \brief Build the hierarchy from the rows of a block sparse matrix.
+   * \param[in] nPointDomain - Number of rows owned by the rank, columns beyond it are dropped.
+   * \param[in] val_nVar - Size of the blocks.
+   * \param[in] row_ptr - Pointers to the first block of each row.
+   * \param[in] col_ind - Column of each block.
+   * \param[in] matrix - Blocks of the matrix.
+   * \param[in] transposed - Build the hierarchy for the transposed matrix.
+   * \param[in] max_levels - Maximum number of levels.
+   * \param[in] strength - Threshold of the strength of connection.
+   */
+  void Build(unsigned long nPointDomain, unsigned long val_nVar, const su2sparseidx *row_ptr,
+             const su2sparseidx *col_ind, const ScalarType *matrix, bool transposed,
+             unsigned short max_levels, passivedouble strength);
+
+  /*!
+   * \brief Apply one V-cycle (zero initial guess) to a vector.
+   * \param[in] vec - Vector to be preconditioned (nPointDomain*nVar).
+   * \param[out] prod - Result of the preconditioning.
+   */
+  void Apply(const ScalarType *vec, ScalarType *prod);
+
+  /*!
+   * \brief Get the number of levels of the hierarchy.
+   */
+  inline unsigned short GetnLevel(void) const { return nLevel; }
+
+  /*!
+   * \brief Get the operator of a level and the prolongation to it (block compressed row format).
+   * \param[in] iLevel - Level of the hierarchy, 0 is the fine level.
+   * \param[out] row_ptr, col_ind, val - Operator of the level.
+   * \param[out] p_row_ptr, p_col_ind, p_val - Prolongation from the next coarser level (empty on the coarsest level).
+   */
+  void GetLevel(unsigned short iLevel, vector<unsigned long> & row_ptr, vector<unsigned long> & col_ind,
+                vector<ScalarType> & val, vector<unsigned long> & p_row_ptr, vector<unsigned long> & p_col_ind,
+                vector<ScalarType> & p_val) const;
+
+  /*!
+   * \brief LU factorization with partial pivoting of a dense (row major) matrix, P A = L U. Whole
+   *        rows are swapped (LAPACK getrf convention), zero pivots are replaced by one.
+   * \param[in] n - Size of the matrix.
+   * \param[in,out] lu - Matrix on entry, L (unit diagonal, not stored) and U on exit.
+   * \param[out] pivot - Row swapped with each row, in the order of the factorization.
+   */
+  static void DenseLUFactorize(unsigned long n, vector<ScalarType> & lu, vector<unsigned long> & pivot);
+
+  /*!
+   * \brief Solve a system with the factorization of DenseLUFactorize (LAPACK getrs convention).
+   * \param[in] n - Size of the matrix.
+   * \param[in] lu - Factors L and U.
+   * \param[in] pivot - Pivots of the factorization.
+   * \param[in,out] x - Right hand side on entry, solution on exit (n entries).
+   */
+  static void DenseLUSolve(unsigned long n, const vector<ScalarType> & lu, const vector<unsigned long> & pivot,
+                           ScalarType *x);
+
+};
@@ -39,6 +39,7 @@
 #pragma once
 
 #include "../mpi_structure.hpp"
+#include "../omp_structure.hpp"
 #include <limits>
 #include <iostream>
 #include <cmath>
@@ -48,7 +49,8 @@
 #include "../geometry_structure.hpp"
 #include "CSysVector.hpp"
 
-#if defined(HAVE_MKL) && !defined(CODI_FORWARD_TYPE)
+/*--- The MKL JIT kernels are double precision, they are not used by the mixed-precision build. ---*/
+#if defined(HAVE_MKL) && !defined(CODI_FORWARD_TYPE) && !defined(SU2_MIXED_PRECISION)
 #include "mkl.h"
 #define USE_MKL
 /*---
@@ -64,6 +66,8 @@ using namespace std;
 
 const su2double eps = numeric_limits<passivedouble>::epsilon(); /*!< \brief machine epsilon */
 
+template<class ScalarType> class CSysAMG;
+
 
 /*!
  * \class CSysMatrix
@@ -83,11 +87,13 @@ private:
   ScalarType *matrix;            /*!< \brief Entries of the sparse matrix. */
   ScalarType *ILU_matrix;         /*!< \brief Entries of the ILU sparse matrix. */
   unsigned long nnz;                 /*!< \brief Number of possible nonzero entries in the matrix. */
-  unsigned long *row_ptr;            /*!< \brief Pointers to the first element in each row. */
-  unsigned long *col_ind;            /*!< \brief Column index for each of the elements in val(). */
+  su2sparseidx *row_ptr;             /*!< \brief Pointers to the first element in each row. */
+  su2sparseidx *col_ind;             /*!< \brief Column index for each of the elements in val() (sorted in each row). */
+  su2sparseidx *dia_ptr;             /*!< \brief Pointers to the diagonal element of each row. */
   unsigned long nnz_ilu;             /*!< \brief Number of possible nonzero entries in the matrix (ILU). */
-  unsigned long *row_ptr_ilu;        /*!< \brief Pointers to the first element in each row (ILU). */
-  unsigned long *col_ind_ilu;        /*!< \brief Column index for each of the elements in val() (ILU). */
+  su2sparseidx *row_ptr_ilu;         /*!< \brief Pointers to the first element in each row (ILU), shared with the matrix for ILU(0). */
+  su2sparseidx *col_ind_ilu;         /*!< \brief Column index for each of the elements in val() (ILU), shared with the matrix for ILU(0). */
+  su2sparseidx *dia_ptr_ilu;         /*!< \brief Pointers to the diagonal element of each row (ILU), shared with the matrix for ILU(0). */
   unsigned short ilu_fill_in;        /*!< \brief Fill in level for the ILU preconditioner. */
 
   ScalarType *block;             /*!< \brief Internal array to store a subblock of the matrix. */
@@ -105,6 +111,21 @@ private:
   vector<ScalarType> LineletInvDiag;            /*!< \brief Inverse of the diagonal blocks of the tri-diag system. */
   vector<ScalarType> LineletVector;             /*!< \brief Solution and RHS of the tri-diag system. */
 
+  CSysAMG<ScalarType> *amg;                     /*!< \brief Algebraic multigrid hierarchy (AMG preconditioner). */
+
+  bool ilu_levels_ready;                        /*!< \brief True when the level schedule of the ILU has been set. */
+  vector<unsigned long> ILULowerLevelPtr;       /*!< \brief Start of each level of the forward sweeps in ILULowerRows. */
+  vector<unsigned long> ILULowerRows;           /*!< \brief Domain rows grouped by level, the rows of a level only depend on lower rows of previous levels. */
+  vector<unsigned long> ILUUpperLevelPtr;       /*!< \brief Start of each level of the backward sweep in ILUUpperRows. */
+  vector<unsigned long> ILUUpperRows;           /*!< \brief Domain rows grouped by level, the rows of a level only depend on upper rows of previous levels. */
+  vector<ScalarType> ILU_work;                  /*!< \brief Work arrays of the ILU, three blocks per thread. */
+
+  bool product_rows_ready;                      /*!< \brief True when the row orders of the products below have been set. */
+  vector<unsigned long> ProductRows;            /*!< \brief Domain rows ordered for the product, the rows that are sent to other ranks first. */
+  unsigned long nProductRowsComm;               /*!< \brief Number of rows at the start of ProductRows that are sent to other ranks. */
+  vector<unsigned long> ProductTranspRows;      /*!< \brief Domain rows ordered for the transposed product, the rows coupled to halo points first. */
+  unsigned long nProductTranspRowsComm;         /*!< \brief Number of rows at the start of ProductTranspRows that are coupled to halo points. */
+
 #ifdef USE_MKL
   void * MatrixMatrixProductJitter;                            /*!< \brief Jitter handle for MKL JIT based GEMM. */
   dgemm_jit_kernel_t MatrixMatrixProductKernel;                /*!< \brief MKL JIT based GEMM kernel. */
@@ -138,6 +159,51 @@ private:
 #endif
   }
 
+  /*!
+   * \brief Find block "ij" in a sparse structure. The diagonal is accessed directly and, since the
+   *        columns of each row are sorted, only the lower or the upper part of the row is searched.
+   * \param[in] val - Entries of the matrix.
+   * \param[in] ptr, ind, dia - Row pointers, column indices and diagonal pointers of the structure.
+   * \param[in] block_i - Row index.
+   * \param[in] block_j - Column index.
+   * \return Pointer to location in memory where the block starts, NULL if it is not in the structure.
+   */
+  inline ScalarType *FindBlock(ScalarType *val, const su2sparseidx *ptr, const su2sparseidx *ind,
+                               const su2sparseidx *dia, unsigned long block_i, unsigned long block_j) const {
+
+    if (block_i == block_j) return &(val[dia[block_i]*nVar*nEqn]);
+
+    unsigned long begin = (block_j < block_i)? ptr[block_i] : dia[block_i]+1;
+    unsigned long end   = (block_j < block_i)? dia[block_i] : ptr[block_i+1];
+
+    for (unsigned long index = begin; index < end; index++)
+      if (ind[index] == block_j)
+        return &(val[index*nVar*nEqn]);
+
+    return NULL;
+  }
+
+  /*!
+   * \brief Find block "ij" of the matrix.
+   */
+  inline ScalarType *MatrixBlock(unsigned long block_i, unsigned long block_j) const {
+    return FindBlock(matrix, row_ptr, col_ind, dia_ptr, block_i, block_j);
+  }
+
+  /*!
+   * \brief Find block "ij" of the ILU matrix.
+   */
+  inline ScalarType *ILUBlock(unsigned long block_i, unsigned long block_j) const {
+    return FindBlock(ILU_matrix, row_ptr_ilu, col_ind_ilu, dia_ptr_ilu, block_i, block_j);
+  }
+
+  /*!
+   * \brief Set the pointers to the diagonal element of each row of a sparse structure.
+   * \param[in] ptr, ind - Row pointers and column indices of the structure.
+   * \return Diagonal pointers (allocated here).
+   */
+  su2sparseidx *SetDiagonalPointers(const su2sparseidx *ptr, const su2sparseidx *ind) const;
+
   /*!
    * \brief Assigns values to the sparse-matrix structure (used in Initialize).
    * \param[in] val_nPoint - Number of points in the nPoint x nPoint block structure
@@ -148,7 +214,7 @@ private:
    * \param[in] val_nnz - Number of possible nonzero entries in the matrix.
    * \param[in] config - Definition of the particular problem.
    */
-  void SetIndexes(unsigned long val_nPoint, unsigned long val_nPointDomain, unsigned short val_nVar, unsigned short val_nEq, unsigned long* val_row_ptr, unsigned long* val_col_ind, unsigned long val_nnz, CConfig *config);
+  void SetIndexes(unsigned long val_nPoint, unsigned long val_nPointDomain, unsigned short val_nVar, unsigned short val_nEq, su2sparseidx* val_row_ptr, su2sparseidx* val_col_ind, unsigned long val_nnz, CConfig *config);
 
   /*!
    * \brief Assigns values to the sparse-matrix structure (used in Initialize).
@@ -382,11 +448,7 @@ public:
    */
   inline ScalarType *GetBlock(unsigned long block_i, unsigned long block_j) {
 
-    for (unsigned long index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++)
-      if (col_ind[index] == block_j)
-        return &(matrix[index*nVar*nEqn]);
-
-    return NULL;
+    return MatrixBlock(block_i, block_j);
   }
 
   /*!
@@ -400,9 +462,9 @@ public:
   inline ScalarType GetBlock(unsigned long block_i, unsigned long block_j,
                              unsigned short iVar, unsigned short jVar) {
 
-    for (unsigned long index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++)
-      if (col_ind[index] == block_j)
-        return matrix[index*nVar*nEqn+iVar*nEqn+jVar];
+    const ScalarType *mat_ij = MatrixBlock(block_i, block_j);
+
+    if (mat_ij != NULL) return mat_ij[iVar*nEqn+jVar];
 
     return 0.0;
   }
@@ -416,16 +478,14 @@ public:
   template<class OtherType>
   inline void SetBlock(unsigned long block_i, unsigned long block_j, OtherType **val_block) {
 
-    unsigned long iVar, jVar, index;
+    unsigned long iVar, jVar;
 
-    for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
-      if (col_ind[index] == block_j) {
-        for (iVar = 0; iVar < nVar; iVar++)
-          for (jVar = 0; jVar < nEqn; jVar++)
-            matrix[index*nVar*nEqn+iVar*nEqn+jVar] = PassiveAssign<ScalarType,OtherType>(val_block[iVar][jVar]);
-        break;
-      }
-    }
+    ScalarType *mat_ij = MatrixBlock(block_i, block_j);
+    if (mat_ij == NULL) return;
+
+    for (iVar = 0; iVar < nVar; iVar++)
+      for (jVar = 0; jVar < nEqn; jVar++)
+        mat_ij[iVar*nEqn+jVar] = PassiveAssign<ScalarType,OtherType>(val_block[iVar][jVar]);
   }
 
   /*!
@@ -437,15 +497,11 @@ public:
   template<class OtherType>
   inline void SetBlock(unsigned long block_i, unsigned long block_j, OtherType *val_block) {
 
-    unsigned long iVar, index;
+    ScalarType *mat_ij = MatrixBlock(block_i, block_j);
+    if (mat_ij == NULL) return;
 
-    for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
-      if (col_ind[index] == block_j) {
-        for (iVar = 0; iVar < nVar*nEqn; iVar++)
-          matrix[index*nVar*nEqn+iVar] = PassiveAssign<ScalarType,OtherType>(val_block[iVar]);
-        break;
-      }
-    }
+    for (unsigned long iVar = 0; iVar < nVar*nEqn; iVar++)
+      mat_ij[iVar] = PassiveAssign<ScalarType,OtherType>(val_block[iVar]);
   }
 
   /*!
@@ -457,16 +513,14 @@ public:
   template<class OtherType>
   inline void AddBlock(unsigned long block_i, unsigned long block_j, OtherType **val_block) {
 
-    unsigned long iVar, jVar, index;
+    unsigned long iVar, jVar;
+
+    ScalarType *mat_ij = MatrixBlock(block_i, block_j);
+    if (mat_ij == NULL) return;
 
-    for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
-      if (col_ind[index] == block_j) {
-        for (iVar = 0; iVar < nVar; iVar++)
-          for (jVar = 0; jVar < nEqn; jVar++)
-            matrix[index*nVar*nEqn+iVar*nEqn+jVar] += PassiveAssign<ScalarType,OtherType>(val_block[iVar][jVar]);
-        break;
-      }
-    }
+    for (iVar = 0; iVar < nVar; iVar++)
+      for (jVar = 0; jVar < nEqn; jVar++)
+        mat_ij[iVar*nEqn+jVar] += PassiveAssign<ScalarType,OtherType>(val_block[iVar][jVar]);
   }
 
   /*!
@@ -478,16 +532,14 @@ public:
   template<class OtherType>
   inline void SubtractBlock(unsigned long block_i, unsigned long block_j, OtherType **val_block) {
 
-    unsigned long iVar, jVar, index;
+    unsigned long iVar, jVar;
 
-    for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
-      if (col_ind[index] == block_j) {
-        for (iVar = 0; iVar < nVar; iVar++)
-          for (jVar = 0; jVar < nEqn; jVar++)
-            matrix[index*nVar*nEqn+iVar*nEqn+jVar] -= PassiveAssign<ScalarType,OtherType>(val_block[iVar][jVar]);
-        break;
-      }
-    }
+    ScalarType *mat_ij = MatrixBlock(block_i, block_j);
+    if (mat_ij == NULL) return;
+
+    for (iVar = 0; iVar < nVar; iVar++)
+      for (jVar = 0; jVar < nEqn; jVar++)
+        mat_ij[iVar*nEqn+jVar] -= PassiveAssign<ScalarType,OtherType>(val_block[iVar][jVar]);
   }
 
   /*!
@@ -499,15 +551,10 @@ public:
   template<class OtherType>
   inline void AddVal2Diag(unsigned long block_i, OtherType val_matrix) {
 
-    unsigned long iVar, index;
+    unsigned long iVar, index = dia_ptr[block_i];
 
-    for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
-      if (col_ind[index] == block_i) { // Only elements on the diagonal
-        for (iVar = 0; iVar < nVar; iVar++)
-          matrix[index*nVar*nVar+iVar*nVar+iVar] += PassiveAssign<ScalarType,OtherType>(val_matrix);
-        break;
-      }
-    }
+    for (iVar = 0; iVar < nVar; iVar++)
+      matrix[index*nVar*nVar+iVar*nVar+iVar] += PassiveAssign<ScalarType,OtherType>(val_matrix);
   }
 
   /*!
@@ -519,21 +566,14 @@ public:
   template<class OtherType>
   inline void SetVal2Diag(unsigned long block_i, OtherType val_matrix) {
 
-    unsigned long iVar, jVar, index;
-
-    for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
-      if (col_ind[index] == block_i) { // Only elements on the diagonal
+    unsigned long iVar, jVar, index = dia_ptr[block_i];
 
-        for (iVar = 0; iVar < nVar; iVar++)
-          for (jVar = 0; jVar < nVar; jVar++)
-            matrix[index*nVar*nVar+iVar*nVar+jVar] = 0.0;
+    for (iVar = 0; iVar < nVar; iVar++)
+      for (jVar = 0; jVar < nVar; jVar++)
+        matrix[index*nVar*nVar+iVar*nVar+jVar] = 0.0;
 
-        for (iVar = 0; iVar < nVar; iVar++)
-          matrix[index*nVar*nVar+iVar*nVar+iVar] = PassiveAssign<ScalarType,OtherType>(val_matrix);
-
-        break;
-      }
-    }
+    for (iVar = 0; iVar < nVar; iVar++)
+      matrix[index*nVar*nVar+iVar*nVar+iVar] = PassiveAssign<ScalarType,OtherType>(val_matrix);
   }
 
   /*!
@@ -583,6 +623,18 @@ public:
    */
   void ComputeJacobiPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod, CGeometry *geometry, CConfig *config);
 
+  /*!
+   * \brief Group the rows of the ILU pattern in levels that can be factorized (and solved) concurrently.
+   */
+  void SetILULevels(void);
+
+  /*!
+   * \brief Factorize one row of the ILU matrix, the rows it depends on must be factorized.
+   * \param[in] iPoint - Row.
+   * \param[in] work - Work array of three blocks (private to the calling thread).
+   */
+  void FactorizeILURow(unsigned long iPoint, ScalarType *work);
+
   /*!
    * \brief Build the ILU preconditioner.
    * \param[in] transposed - Flag to use the transposed matrix to construct the preconditioner.
@@ -619,6 +671,40 @@ public:
    */
   void ComputeLineletPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod, CGeometry *geometry, CConfig *config);
 
+  /*!
+   * \brief Build the algebraic multigrid (smoothed aggregation) preconditioner.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] transposed - Flag to use the transposed matrix to construct the preconditioner.
+   */
+  void BuildAMGPreconditioner(CConfig *config, bool transposed = false);
+
+  /*!
+   * \brief Multiply CSysVector by the preconditioner (one V-cycle).
+   * \param[in] vec - CSysVector to be multiplied by the preconditioner.
+   * \param[out] prod - Result of the product A*vec.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeAMGPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod, CGeometry *geometry, CConfig *config);
+
+  /*!
+   * \brief Order the domain rows such that the products can overlap the halo communication with the interior rows.
+   * \param[in] geometry - Geometrical definition of the problem (point-to-point comm. structure).
+   */
+  void SetProductRows(CGeometry *geometry);
+
+  /*!
+   * \brief Add the product of a range of the (ordered) rows of the matrix by a vector.
+   * \param[in] vec - CSysVector to be multiplied by the sparse matrix A.
+   * \param[in,out] prod - Result of the product.
+   * \param[in] rows - Ordered rows, ProductRows or ProductTranspRows.
+   * \param[in] begin - Start of the range in rows.
+   * \param[in] end - End of the range in rows (exclusive).
+   * \param[in] transposed - Multiply by the transposed matrix.
+   */
+  inline void RowsVectorProduct(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+                                const vector<unsigned long> & rows, unsigned long begin, unsigned long end, bool transposed);
+
   /*!
    * \brief Compute the residual Ax-b
    * \param[in] sol - CSysVector to be multiplied by the preconditioner.
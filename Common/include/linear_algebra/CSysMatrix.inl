@@ -46,53 +46,40 @@
 template<class ScalarType>
 inline ScalarType *CSysMatrix<ScalarType>::GetBlock_ILUMatrix(unsigned long block_i, unsigned long block_j) {
 
-  for (unsigned long index = row_ptr_ilu[block_i]; index < row_ptr_ilu[block_i+1]; index++)
-    if (col_ind_ilu[index] == block_j)
-      return &(ILU_matrix[index*nVar*nEqn]);
-
-  return NULL;
+  return ILUBlock(block_i, block_j);
 }
 
 template<class ScalarType>
 inline void CSysMatrix<ScalarType>::SetBlock_ILUMatrix(unsigned long block_i, unsigned long block_j, ScalarType *val_block) {
 
-  unsigned long iVar, index;
+  ScalarType *ilu_ij = ILUBlock(block_i, block_j);
+  if (ilu_ij == NULL) return;
 
-  for (index = row_ptr_ilu[block_i]; index < row_ptr_ilu[block_i+1]; index++) {
-    if (col_ind_ilu[index] == block_j) {
-      for (iVar = 0; iVar < nVar*nEqn; iVar++)
-        ILU_matrix[index*nVar*nEqn+iVar] = val_block[iVar];
-      break;
-    }
-  }
+  for (unsigned long iVar = 0; iVar < nVar*nEqn; iVar++)
+    ilu_ij[iVar] = val_block[iVar];
 
 }
 
 template<class ScalarType>
 inline void CSysMatrix<ScalarType>::SetBlockTransposed_ILUMatrix(unsigned long block_i, unsigned long block_j, ScalarType *val_block) {
 
-  unsigned long iVar, jVar, index;
+  unsigned long iVar, jVar;
 
-  for (index = row_ptr_ilu[block_i]; index < row_ptr_ilu[block_i+1]; index++) {
-    if (col_ind_ilu[index] == block_j) {
-      for (iVar = 0; iVar < nVar; iVar++)
-        for (jVar = 0; jVar < nEqn; jVar++)
-          ILU_matrix[index*nVar*nEqn+iVar*nEqn+jVar] = val_block[jVar*nVar+iVar];
-      break;
-    }
-  }
+  ScalarType *ilu_ij = ILUBlock(block_i, block_j);
+  if (ilu_ij == NULL) return;
+
+  for (iVar = 0; iVar < nVar; iVar++)
+    for (jVar = 0; jVar < nEqn; jVar++)
+      ilu_ij[iVar*nEqn+jVar] = val_block[jVar*nVar+iVar];
 
 }
 
 template<class ScalarType>
 inline void CSysMatrix<ScalarType>::SubtractBlock_ILUMatrix(unsigned long block_i, unsigned long block_j, ScalarType *val_block) {
 
-  for (unsigned long index = row_ptr_ilu[block_i]; index < row_ptr_ilu[block_i+1]; index++) {
-    if (col_ind_ilu[index] == block_j) {
-      MatrixSubtraction(&ILU_matrix[index*nVar*nEqn], val_block, &ILU_matrix[index*nVar*nEqn]);
-      break;
-    }
-  }
+  ScalarType *ilu_ij = ILUBlock(block_i, block_j);
+
+  if (ilu_ij != NULL) MatrixSubtraction(ilu_ij, val_block, ilu_ij);
 
 }
 
@@ -126,6 +113,143 @@ inline void gemm_impl(const unsigned long n, const T *a, const T *b, T *c) {
   }
 }
 
+template<class T>
+inline void gauss_elimination_impl(const unsigned long n, T *matrix, T *vec) {
+
+  int iVar, jVar, kVar, nvar = int(n);
+  T weight;
+
+  /*--- Transform system in Upper Matrix ---*/
+  for (iVar = 1; iVar < nvar; iVar++) {
+    for (jVar = 0; jVar < iVar; jVar++) {
+      weight = matrix[iVar*nvar+jVar] / matrix[jVar*nvar+jVar];
+      for (kVar = jVar; kVar < nvar; kVar++)
+        matrix[iVar*nvar+kVar] -= weight*matrix[jVar*nvar+kVar];
+      vec[iVar] -= weight*vec[jVar];
+    }
+  }
+
+  /*--- Backwards substitution ---*/
+  for (iVar = nvar-1; iVar >= 0; iVar--) {
+    for (jVar = iVar+1; jVar < nvar; jVar++)
+      vec[iVar] -= matrix[iVar*nvar+jVar]*vec[jVar];
+    vec[iVar] /= matrix[iVar*nvar+iVar];
+  }
+}
+
+template<class T>
+inline void matrix_inverse_impl(const unsigned long n, const T *matrix, T *inverse, T *work) {
+  /*---
+   This is a generalization of Gaussian elimination for multiple rhs' (the basis vectors).
+   We could call "Gauss_Elimination" multiple times or fully generalize it for multiple rhs,
+   the performance of both routines would suffer in both cases without the use of exotic templating.
+   And so it feels reasonable to have some duplication here.
+  ---*/
+
+  int iVar, jVar, kVar, nvar = int(n);
+  T weight;
+
+  /*--- Initialize the inverse and make a copy of the matrix ---*/
+  for (iVar = 0; iVar < nvar; iVar++) {
+    for (jVar = 0; jVar < nvar; jVar++) {
+      work[iVar*nvar+jVar] = matrix[iVar*nvar+jVar];
+      inverse[iVar*nvar+jVar] = T(iVar==jVar); // identity
+    }
+  }
+
+  /*--- Transform system in Upper Matrix ---*/
+  for (iVar = 1; iVar < nvar; iVar++) {
+    for (jVar = 0; jVar < iVar; jVar++)
+    {
+      weight = work[iVar*nvar+jVar] / work[jVar*nvar+jVar];
+
+      for (kVar = jVar; kVar < nvar; kVar++)
+        work[iVar*nvar+kVar] -= weight*work[jVar*nvar+kVar];
+
+      /*--- at this stage "inverse" is lower triangular so not all cols need updating ---*/
+      for (kVar = 0; kVar <= jVar; kVar++)
+        inverse[iVar*nvar+kVar] -= weight*inverse[jVar*nvar+kVar];
+    }
+  }
+
+  /*--- Backwards substitution ---*/
+  for (iVar = nvar-1; iVar >= 0; iVar--)
+  {
+    for (jVar = iVar+1; jVar < nvar; jVar++)
+      for (kVar = 0; kVar < nvar; kVar++)
+        inverse[iVar*nvar+kVar] -= work[iVar*nvar+jVar] * inverse[jVar*nvar+kVar];
+
+    for (kVar = 0; kVar < nvar; kVar++)
+      inverse[iVar*nvar+kVar] /= work[iVar*nvar+iVar];
+  }
+}
+
+/*---
+ Block kernels, the block size N is a template parameter so that the loops of the
+ implementations above are fully unrolled for the common sizes. N=0 is the generic
+ kernel for any other size (given at run time by n).
+---*/
+template<class T, unsigned long N, bool alpha, bool beta, bool transp>
+inline void gemv_kernel(const unsigned long n, const T *a, const T *b, T *c) {
+  gemv_impl<T,alpha,beta,transp>(N? N:n, a, b, c);
+}
+
+template<class T, unsigned long N>
+inline void gemm_kernel(const unsigned long n, const T *a, const T *b, T *c) {
+  gemm_impl<T>(N? N:n, a, b, c);
+}
+
+template<class T, unsigned long N>
+inline void gauss_elimination_kernel(const unsigned long n, T *matrix, T *vec) {
+  if (N==1) {vec[0] /= matrix[0]; return;}
+  gauss_elimination_impl<T>(N? N:n, matrix, vec);
+}
+
+template<class T, unsigned long N>
+inline void matrix_inverse_kernel(const unsigned long n, const T *matrix, T *inverse, T *work) {
+  if (N==1) {inverse[0] = 1.0/matrix[0]; return;}
+  matrix_inverse_impl<T>(N? N:n, matrix, inverse, work);
+}
+
+/*---
+ The block size is only known at run time, switch on it to call the kernel of the
+ common sizes, i.e. 1 (scalar equations), 2 (SST), 4 and 5 (2D/3D flow), 6 and 7
+ (flow with turbulence models solved coupled). The calls are direct and can be
+ inlined in the loops over the blocks, the switch is predicted perfectly.
+---*/
+#define BLOCK_SIZE_SWITCH(n, CALL) \
+switch (n) { \
+  case 1:  { const unsigned long N = 1; CALL; break; } \
+  case 2:  { const unsigned long N = 2; CALL; break; } \
+  case 4:  { const unsigned long N = 4; CALL; break; } \
+  case 5:  { const unsigned long N = 5; CALL; break; } \
+  case 6:  { const unsigned long N = 6; CALL; break; } \
+  case 7:  { const unsigned long N = 7; CALL; break; } \
+  default: { const unsigned long N = 0; CALL; break; } \
+}
+
+template<class T, bool alpha, bool beta, bool transp>
+inline void block_gemv(const unsigned long n, const T *a, const T *b, T *c) {
+  BLOCK_SIZE_SWITCH(n, (gemv_kernel<T,N,alpha,beta,transp>(n, a, b, c)))
+}
+
+template<class T>
+inline void block_gemm(const unsigned long n, const T *a, const T *b, T *c) {
+  BLOCK_SIZE_SWITCH(n, (gemm_kernel<T,N>(n, a, b, c)))
+}
+
+template<class T>
+inline void block_gauss_elimination(const unsigned long n, T *matrix, T *vec) {
+  BLOCK_SIZE_SWITCH(n, (gauss_elimination_kernel<T,N>(n, matrix, vec)))
+}
+
+template<class T>
+inline void block_matrix_inverse(const unsigned long n, const T *matrix, T *inverse, T *work) {
+  BLOCK_SIZE_SWITCH(n, (matrix_inverse_kernel<T,N>(n, matrix, inverse, work)))
+}
+
+#undef BLOCK_SIZE_SWITCH
+
 #define __MATVECPROD_SIGNATURE__(TYPE,NAME) \
 inline void CSysMatrix<TYPE>::NAME(const TYPE *matrix, const TYPE *vector, TYPE *product)
 
@@ -134,27 +258,27 @@ inline void CSysMatrix<TYPE>::NAME(const TYPE *matrix, const TYPE *vector, TYPE
 #if !defined(USE_MKL)
 MATVECPROD_SIGNATURE( MatrixVectorProduct ) {
   /*---
-   Without MKL (default) picture copying the body of gemv_impl
-   here and resolving the conditionals at compilation.
+   Without MKL (default) use the kernels specialized for the block size, they
+   are instantiations of gemv_impl with the conditionals resolved at compilation.
   ---*/
-  gemv_impl<ScalarType,true,false,false>(nVar, matrix, vector, product);
+  block_gemv<ScalarType,true,false,false>(nVar, matrix, vector, product);
 }
 
 MATVECPROD_SIGNATURE( MatrixVectorProductAdd ) {
-  gemv_impl<ScalarType,true,true,false>(nVar, matrix, vector, product);
+  block_gemv<ScalarType,true,true,false>(nVar, matrix, vector, product);
 }
 
 MATVECPROD_SIGNATURE( MatrixVectorProductSub ) {
-  gemv_impl<ScalarType,false,true,false>(nVar, matrix, vector, product);
+  block_gemv<ScalarType,false,true,false>(nVar, matrix, vector, product);
 }
 
 MATVECPROD_SIGNATURE( MatrixVectorProductTransp ) {
-  gemv_impl<ScalarType,true,true,true>(nVar, matrix, vector, product);
+  block_gemv<ScalarType,true,true,true>(nVar, matrix, vector, product);
 }
 
 template<class ScalarType>
 inline void CSysMatrix<ScalarType>::MatrixMatrixProduct(const ScalarType *matrix_a, const ScalarType *matrix_b, ScalarType *product) {
-  gemm_impl<ScalarType>(nVar, matrix_a, matrix_b, product);
+  block_gemm<ScalarType>(nVar, matrix_a, matrix_b, product);
 }
 #else
 MATVECPROD_SIGNATURE( MatrixVectorProduct ) {
@@ -187,24 +311,24 @@ inline void CSysMatrix<ScalarType>::MatrixMatrixProduct(const ScalarType *matrix
 /*--- WHEN using MKL, AND compiling for AD, we need to specialize for su2double to avoid mixing incompatible types. ---*/
 #define MATVECPROD_SPECIALIZATION(NAME) template<> __MATVECPROD_SIGNATURE__(su2double,NAME)
 MATVECPROD_SPECIALIZATION( MatrixVectorProduct ) {
-  gemv_impl<su2double,true,false,false>(nVar, matrix, vector, product);
+  block_gemv<su2double,true,false,false>(nVar, matrix, vector, product);
 }
 
 MATVECPROD_SPECIALIZATION( MatrixVectorProductAdd ) {
-  gemv_impl<su2double,true,true,false>(nVar, matrix, vector, product);
+  block_gemv<su2double,true,true,false>(nVar, matrix, vector, product);
 }
 
 MATVECPROD_SPECIALIZATION( MatrixVectorProductSub ) {
-  gemv_impl<su2double,false,true,false>(nVar, matrix, vector, product);
+  block_gemv<su2double,false,true,false>(nVar, matrix, vector, product);
 }
 
 MATVECPROD_SPECIALIZATION( MatrixVectorProductTransp ) {
-  gemv_impl<su2double,true,true,true>(nVar, matrix, vector, product);
+  block_gemv<su2double,true,true,true>(nVar, matrix, vector, product);
 }
 
 template<>
 inline void CSysMatrix<su2double>::MatrixMatrixProduct(const su2double *matrix_a, const su2double *matrix_b, su2double *product) {
-  gemm_impl<su2double>(nVar, matrix_a, matrix_b, product);
+  block_gemm<su2double>(nVar, matrix_a, matrix_b, product);
 }
 #undef MATVECPROD_SPECIALIZATION
 #endif // CODI_REVERSE_TYPE
@@ -216,97 +340,63 @@ inline void CSysMatrix<su2double>::MatrixMatrixProduct(const su2double *matrix_a
 template<class ScalarType>
 inline void CSysMatrix<ScalarType>::Gauss_Elimination(ScalarType* matrix, ScalarType* vec) {
 
-  /*---
-   This is a relatively large method to inline but maybe better
-   code will be generated for the special case nVar=1 this way.
-  ---*/
-
+#ifdef USE_MKL_LAPACK
   if (nVar==1) {vec[0] /= matrix[0]; return;}
 
-#ifdef USE_MKL_LAPACK
   // With MKL_DIRECT_CALL enabled, this is significantly faster than native code on Intel Architectures.
   LAPACKE_dgetrf( LAPACK_ROW_MAJOR, nVar, nVar, matrix, nVar, mkl_ipiv );
   LAPACKE_dgetrs( LAPACK_ROW_MAJOR, 'N', nVar, 1, matrix, nVar, mkl_ipiv, vec, 1 );
 #else
-  int iVar, jVar, kVar, nvar = int(nVar);
-  ScalarType weight;
-
-  /*--- Transform system in Upper Matrix ---*/
-  for (iVar = 1; iVar < nvar; iVar++) {
-    for (jVar = 0; jVar < iVar; jVar++) {
-      weight = matrix[iVar*nvar+jVar] / matrix[jVar*nvar+jVar];
-      for (kVar = jVar; kVar < nvar; kVar++)
-        matrix[iVar*nvar+kVar] -= weight*matrix[jVar*nvar+kVar];
-      vec[iVar] -= weight*vec[jVar];
-    }
-  }
-
-  /*--- Backwards substitution ---*/
-  for (iVar = nvar-1; iVar >= 0; iVar--) {
-    for (jVar = iVar+1; jVar < nvar; jVar++)
-      vec[iVar] -= matrix[iVar*nvar+jVar]*vec[jVar];
-    vec[iVar] /= matrix[iVar*nvar+iVar];
-  }
+  block_gauss_elimination<ScalarType>(nVar, matrix, vec);
 #endif
 }
 
 template<class ScalarType>
 inline void CSysMatrix<ScalarType>::MatrixInverse(const ScalarType *matrix, ScalarType *inverse) {
 
-  /*---
-   This is a generalization of Gaussian elimination for multiple rhs' (the basis vectors).
-   We could call "Gauss_Elimination" multiple times or fully generalize it for multiple rhs,
-   the performance of both routines would suffer in both cases without the use of exotic templating.
-   And so it feels reasonable to have some duplication here.
-  ---*/
-
+#ifdef USE_MKL_LAPACK
   if (nVar==1) {inverse[0] = 1.0/matrix[0]; return;}
 
-  int iVar, jVar, nvar = int(nVar);
+  unsigned long iVar, jVar;
 
   /*--- Initialize the inverse and make a copy of the matrix ---*/
-  for (iVar = 0; iVar < nvar; iVar++) {
-    for (jVar = 0; jVar < nvar; jVar++) {
-      block[iVar*nvar+jVar] = matrix[iVar*nvar+jVar];
-      inverse[iVar*nvar+jVar] = ScalarType(iVar==jVar); // identity
+  for (iVar = 0; iVar < nVar; iVar++) {
+    for (jVar = 0; jVar < nVar; jVar++) {
+      block[iVar*nVar+jVar] = matrix[iVar*nVar+jVar];
+      inverse[iVar*nVar+jVar] = ScalarType(iVar==jVar); // identity
     }
   }
 
-  /*--- Inversion ---*/
-#ifdef USE_MKL_LAPACK
   // With MKL_DIRECT_CALL enabled, this is significantly faster than native code on Intel Architectures.
   LAPACKE_dgetrf( LAPACK_ROW_MAJOR, nVar, nVar, block, nVar, mkl_ipiv );
   LAPACKE_dgetrs( LAPACK_ROW_MAJOR, 'N', nVar, nVar, block, nVar, mkl_ipiv, inverse, nVar );
 #else
-  int kVar;
-  ScalarType weight;
+  block_matrix_inverse<ScalarType>(nVar, matrix, inverse, block);
+#endif
+}
 
-  /*--- Transform system in Upper Matrix ---*/
-  for (iVar = 1; iVar < nvar; iVar++) {
-    for (jVar = 0; jVar < iVar; jVar++)
-    {
-      weight = block[iVar*nvar+jVar] / block[jVar*nvar+jVar];
+template<class ScalarType>
+inline void CSysMatrix<ScalarType>::RowsVectorProduct(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+                                                      const vector<unsigned long> & rows, unsigned long begin,
+                                                      unsigned long end, bool transposed) {
 
-      for (kVar = jVar; kVar < nvar; kVar++)
-        block[iVar*nvar+kVar] -= weight*block[jVar*nvar+kVar];
+  unsigned long iRow, row_i, index;
 
-      /*--- at this stage "inverse" is lower triangular so not all cols need updating ---*/
-      for (kVar = 0; kVar <= jVar; kVar++)
-        inverse[iVar*nvar+kVar] -= weight*inverse[jVar*nvar+kVar];
+  if (!transposed) {
+    for (iRow = begin; iRow < end; iRow++) {
+      row_i = rows[iRow];
+      for (index = row_ptr[row_i]; index < row_ptr[row_i+1]; index++)
+        MatrixVectorProductAdd(&matrix[index*nVar*nVar], &vec[col_ind[index]*nVar], &prod[row_i*nVar]);
     }
   }
-
-  /*--- Backwards substitution ---*/
-  for (iVar = nvar-1; iVar >= 0; iVar--)
-  {
-    for (jVar = iVar+1; jVar < nvar; jVar++)
-      for (kVar = 0; kVar < nvar; kVar++)
-        inverse[iVar*nvar+kVar] -= block[iVar*nvar+jVar] * inverse[jVar*nvar+kVar];
-
-    for (kVar = 0; kVar < nvar; kVar++)
-      inverse[iVar*nvar+kVar] /= block[iVar*nvar+iVar];
+  else {
+    for (iRow = begin; iRow < end; iRow++) {
+      row_i = rows[iRow];
+      for (index = row_ptr[row_i]; index < row_ptr[row_i+1]; index++)
+        MatrixVectorProductTransp(&matrix[index*nVar*nVar], &vec[row_i*nVar], &prod[col_ind[index]*nVar]);
+    }
   }
-#endif
+
 }
 
 template<class ScalarType>
@@ -41,6 +41,7 @@
 #include "../mpi_structure.hpp"
 
 #include <climits>
+#include <type_traits>
 #include <limits>
 #include <cmath>
 #include <vector>
@@ -59,6 +60,14 @@
 
 using namespace std;
 
+/*!
+ * \brief Type of the partial sums of the fused reductions, the single precision vectors are reduced in double.
+ */
+template<class T> struct CSysReductionType { typedef T Type; };
+#ifdef SU2_MIXED_PRECISION
+template<> struct CSysReductionType<su2mixedfloat> { typedef passivedouble Type; };
+#endif
+
 /*!
  * \class CSysSolve
  * \brief Class for solving linear systems using classical and Krylov-subspace iterative methods
@@ -78,12 +87,19 @@ public:
   typedef CSysMatrix<ScalarType> MatrixType;
   typedef CMatrixVectorProduct<ScalarType> ProductType;
   typedef CPreconditioner<ScalarType> PrecondType;
+  typedef typename CSysReductionType<ScalarType>::Type ReductionType;
 
 private:
 
   bool mesh_deform;    /*!< \brief Operate in mesh deformation mode, changes the source of solver options. */
   ScalarType Residual; /*!< \brief Residual at the end of a call to Solve. */
 
+  bool prec_ready;             /*!< \brief Indicate if the preconditioner of the matrix can be reused by Solve. */
+  unsigned short Prec_Kind;    /*!< \brief Kind of the preconditioner that was last built. */
+  unsigned long Prec_Age;      /*!< \brief Number of solves since the preconditioner was built. */
+  unsigned long Prec_Builds;   /*!< \brief Number of times the preconditioner has been built by Solve. */
+  ScalarType Prec_Rate;        /*!< \brief Convergence rate (log of the reduction per iteration) with the fresh preconditioner. */
+
   bool cg_ready;     /*!< \brief Indicate if memory used by CG is allocated. */
   bool bcg_ready;    /*!< \brief Indicate if memory used by BCGSTAB is allocated. */
   bool gmres_ready;  /*!< \brief Indicate if memory used by FGMRES is allocated. */
@@ -96,15 +112,60 @@ private:
 
   VectorType r_0;    /*!< \brief The "arbitrary" vector in BCGSTAB. */
   VectorType v;      /*!< \brief BCGSTAB "v" vector (v = A * M^-1 * p). */
+  VectorType q;      /*!< \brief Preconditioned intermediate residual in the fused BCGSTAB. */
 
   vector<VectorType> W;  /*!< \brief Large matrix used by FGMRES, w^i+1 = A * z^i. */
   vector<VectorType> Z;  /*!< \brief Large matrix used by FGMRES, preconditioned W. */
 
+  /*!
+   * \brief Subspace recycled by FGMRES between calls to Solve (GCRO), C = A * U with C orthonormal.
+   */
+  struct CRecycledSpace {
+    vector<VectorType> U;  /*!< \brief Basis of the recycled subspace. */
+    vector<VectorType> C;  /*!< \brief Image of U by the operator of the current system. */
+    unsigned long size;    /*!< \brief Number of vectors stored. */
+    unsigned long next;    /*!< \brief Slot that receives the next correction. */
+    CRecycledSpace() : size(0), next(0) {}
+  };
+
+  CRecycledSpace Recycle;          /*!< \brief Recycled subspace of the direct systems (Solve). */
+  CRecycledSpace Recycle_b;        /*!< \brief Recycled subspace of the transposed systems (Solve_b). */
+  CRecycledSpace *ActiveRecycle;   /*!< \brief Subspace used by FGMRES, NULL if recycling is off. */
+
   VectorType  LinSysRes_tmp;  /*!< \brief Temporary used when it is necessary to interface between active and passive types. */
   VectorType  LinSysSol_tmp;  /*!< \brief Temporary used when it is necessary to interface between active and passive types. */
   VectorType* LinSysRes_ptr;  /*!< \brief Pointer to appropriate LinSysRes (set to original or temporary in call to Solve). */
   VectorType* LinSysSol_ptr;  /*!< \brief Pointer to appropriate LinSysSol (set to original or temporary in call to Solve). */
 
+  vector<ReductionType> RedLocal;   /*!< \brief Local partial sums of a fused reduction. */
+  vector<ReductionType> RedGlobal;  /*!< \brief Global sums of a fused reduction. */
+  vector<passivedouble> RedSendBuf; /*!< \brief Send buffer of the non-blocking reductions. */
+  vector<passivedouble> RedRecvBuf; /*!< \brief Receive buffer of the non-blocking reductions. */
+  CBaseMPIWrapper::Request RedRequest; /*!< \brief Request of the non-blocking reduction in flight. */
+
+  /*!
+   * \brief Local (this rank) part of the dot product of two vectors, see RedLocal.
+   */
+  inline ReductionType LocalDotProd(const VectorType & u, const VectorType & v) const {
+    ReductionType sum = 0.0;
+    for (unsigned long i = 0; i < u.GetNElmDomain(); i++)
+      sum += ReductionType(u[i])*ReductionType(v[i]);
+    return sum;
+  }
+
+  /*!
+   * \brief Start the sum over all ranks of the first entries of RedLocal, non-blocking for passive
+   *        types, AD types use the blocking AD-aware reduction so that no derivative is lost.
+   * \param[in] count - Number of partial sums.
+   */
+  void StartReduction(int count);
+
+  /*!
+   * \brief Complete the reduction started by StartReduction, the result is in RedGlobal.
+   * \param[in] count - Number of partial sums.
+   */
+  void FinishReduction(int count);
+
   /*!
    * \brief sign transfer function
    * \param[in] x - value having sign prescribed
@@ -174,6 +235,64 @@ private:
    */
   void ModGramSchmidt(int i, vector<vector<ScalarType> > & Hsbg, vector<VectorType> & w);
 
+  /*!
+   * \brief Classical Gram-Schmidt orthogonalization with one reorthogonalization (CGS2)
+   *
+   * \param[in] i - index indicating which vector in w is being orthogonalized
+   * \param[in, out] Hsbg - the upper Hessenberg begin updated
+   * \param[in, out] w - the (i+1)th vector of w is orthogonalized against the
+   *                    previous vectors in w
+   *
+   * All the projections of each pass, and the norm of the vector, are obtained
+   * with a single (fused) global reduction, two per call instead of the i+3
+   * reductions (plus the divergence check) of ModGramSchmidt.
+   */
+  void ClassicalGramSchmidt(int i, vector<vector<ScalarType> > & Hsbg, vector<VectorType> & w);
+
+  /*!
+   * \brief Prepare the recycled subspace for a new system, C = A * U is recomputed and orthonormalized.
+   * \param[in,out] space - Recycled subspace.
+   * \param[in] mat_vec - Matrix-vector product of the new system.
+   * \param[in] x - Vector used as a template for the allocation.
+   * \param[in] nVec - Maximum size of the subspace.
+   *
+   * The same transformations are applied to U so that C = A * U still holds,
+   * vectors that become (numerically) dependent are discarded.
+   */
+  void PrepareRecycledSpace(CRecycledSpace & space, ProductType & mat_vec, const VectorType & x, unsigned long nVec);
+
+  /*!
+   * \brief Add a vector (the correction of a solve) to the recycled subspace, replacing the oldest when full.
+   * \param[in,out] space - Recycled subspace.
+   * \param[in] mat_vec - Matrix-vector product of the current system.
+   * \param[in,out] u - Vector to add, overwritten.
+   * \param[out] Au - Work vector.
+   */
+  void AddToRecycledSpace(CRecycledSpace & space, ProductType & mat_vec, VectorType & u, VectorType & Au);
+
+  /*!
+   * \brief Decide if the preconditioner built in a previous call to Solve can be reused.
+   * \param[in] KindPrecond - Kind of preconditioner.
+   * \param[in] config - Definition of the particular problem.
+   * \return <code>TRUE</code> if the build of the preconditioner can be skipped.
+   */
+  bool ReusePreconditioner(unsigned short KindPrecond, CConfig *config) const;
+
+  /*!
+   * \brief Update the statistics of the preconditioner after a solve, and mark it for rebuild if it degraded.
+   * \param[in] built - Whether the preconditioner was built for this solve.
+   * \param[in] KindPrecond - Kind of preconditioner.
+   * \param[in] iter - Number of iterations of the solve.
+   * \param[in] res0 - Initial residual norm.
+   * \param[in] config - Definition of the particular problem.
+   *
+   * The convergence rate is measured as the reduction of the residual per iteration,
+   * the preconditioner is rebuilt when the rate falls below 1/LINEAR_SOLVER_PREC_DEGRADATION
+   * times the rate obtained right after the last build.
+   */
+  void UpdatePreconditionerStats(bool built, unsigned short KindPrecond, unsigned long iter,
+                                 ScalarType res0, CConfig *config);
+
   /*!
    * \brief writes header information for a CSysSolve residual history
    * \param[in] solver - string describing the solver
@@ -231,6 +350,9 @@ public:
 
   /*!
    * \brief Flexible Generalized Minimal Residual method
+   * \note If a recycled subspace is active (see PrepareRecycledSpace) the method is the
+   *       flexible GCRO variant, the initial residual is projected out of span(C), the Arnoldi
+   *       vectors are kept orthogonal to C, and the correction is added to the subspace.
    * \param[in] b - the right hand size vector
    * \param[in,out] x - on entry the intial guess, on exit the solution
    * \param[in] mat_vec - object that defines matrix-vector product
@@ -261,6 +383,27 @@ public:
                                   PrecondType & precond, ScalarType tol, unsigned long m,
                                   ScalarType *residual, bool monitoring, CConfig *config);
 
+  /*!
+   * \brief BCGSTAB with fused global reductions
+   * \param[in] b - the right hand size vector
+   * \param[in,out] x - on entry the intial guess, on exit the solution
+   * \param[in] mat_vec - object that defines matrix-vector product
+   * \param[in] precond - object that defines preconditioner
+   * \param[in] tol - tolerance with which to solve the system
+   * \param[in] m - maximum size of the search subspace
+   * \param[in] residual - norm of final residual
+   * \param[in] monitoring - turn on priting residuals from solver to screen.
+   * \param[in] config - Definition of the particular problem.
+   *
+   * The inner products of the second half-step (for omega), the next rho, and
+   * the residual norm are recovered from one reduction of five partial sums,
+   * which is non-blocking and overlapped with the first update of the solution.
+   * There are two global synchronizations per iteration instead of five.
+   */
+  unsigned long BCGSTAB_Fused_LinSolver(const VectorType & b, VectorType & x, ProductType & mat_vec,
+                                        PrecondType & precond, ScalarType tol, unsigned long m,
+                                        ScalarType *residual, bool monitoring, CConfig *config);
+
   /*!
    * \brief Generic smoother (modified Richardson iteration with preconditioner)
    * \param[in] b - the right hand size vector
@@ -284,9 +427,11 @@ public:
    * \param[in] LinSysSol - Linear system solution
    * \param[in] geometry -  Geometrical definition of the problem.
    * \param[in] config - Definition of the particular problem.
+   * \param[in] custom_mat_vec - Optional matrix-vector product (e.g. matrix-free), the Jacobian is then only
+   *            used to build the preconditioner. The object is owned by the caller.
    */
   unsigned long Solve(MatrixType & Jacobian, CSysVector<su2double> & LinSysRes, CSysVector<su2double> & LinSysSol,
-                      CGeometry *geometry, CConfig *config);
+                      CGeometry *geometry, CConfig *config, ProductType *custom_mat_vec = NULL);
 
   /*!
    * \brief Solve the adjoint linear system using a Krylov subspace method
@@ -305,4 +450,23 @@ public:
    */
   inline ScalarType GetResidual(void) const { return Residual; }
 
+  /*!
+   * \brief Get the number of times the preconditioner was built by Solve (lazy refresh statistics).
+   * \return Number of builds.
+   */
+  inline unsigned long GetPrec_Builds(void) const { return Prec_Builds; }
+
+  /*!
+   * \brief Get the number of solves since the preconditioner was last built.
+   * \return Age of the preconditioner.
+   */
+  inline unsigned long GetPrec_Age(void) const { return Prec_Age; }
+
+  /*!
+   * \brief Check if the next call to Solve will reuse the preconditioner, i.e. the matrix is not needed to build it.
+   * \param[in] config - Definition of the particular problem.
+   * \return <code>TRUE</code> if the preconditioner of the previous solve is kept.
+   */
+  inline bool GetPrec_Reuse(CConfig *config) const { return ReusePreconditioner(config->GetKind_Linear_Solver_Prec(), config); }
+
 };
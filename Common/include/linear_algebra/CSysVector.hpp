@@ -369,3 +369,11 @@ public:
  */
 template<class ScalarType>
 CSysVector<ScalarType> operator*(const ScalarType & val, const CSysVector<ScalarType> & u);
+
+#ifdef SU2_MIXED_PRECISION
+/*!
+ * \brief Dot product of single precision vectors, accumulated and reduced in double precision.
+ */
+template<>
+su2mixedfloat dotProd<su2mixedfloat>(const CSysVector<su2mixedfloat> & u, const CSysVector<su2mixedfloat> & v);
+#endif
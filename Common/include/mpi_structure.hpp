@@ -77,6 +77,16 @@ class CBaseMPIWrapper;
 typedef CBaseMPIWrapper SU2_MPI;
 #endif // defined CODI_REVERSE_TYPE || defined CODI_FORWARD_TYPE
 
+/*--- The halo exchange may use the MPI-3 neighborhood collectives instead of
+ point-to-point messages (--enable-neighbor-collectives), they are not available
+ through the AD wrappers of MPI. ---*/
+#if defined USE_NEIGHBOR_COLLECTIVES && !(defined CODI_REVERSE_TYPE || defined CODI_FORWARD_TYPE)
+#if MPI_VERSION < 3
+#error "The neighborhood collectives (--enable-neighbor-collectives) require an MPI-3 library."
+#endif
+#define HAVE_NEIGHBOR_COLLECTIVES
+#endif
+
 /*--- Select the appropriate MPI wrapper based on datatype, to use in templated classes. ---*/
 template<class T> struct SelectMPIWrapper {};
 
@@ -113,11 +123,14 @@ protected:
   static Comm currentComm;
   static bool winMinRankErrorInUse;
   static Win  winMinRankError;
+  static double WaitTime;   /*!< \brief Time blocked in the waits and collectives (load balance monitoring). */
   
 public:
   
   static int GetRank();
   
+  static double GetWaitTime();
+  
   static int GetSize();
   
   static Comm GetComm();
@@ -150,6 +163,18 @@ public:
   static void Irecv(void *buf, int count, Datatype datatype, int source,
                     int tag, Comm comm, Request* request);
 
+  static void Send_init(void *buf, int count, Datatype datatype, int dest,
+                        int tag, Comm comm, Request* request);
+
+  static void Recv_init(void *buf, int count, Datatype datatype, int source,
+                        int tag, Comm comm, Request* request);
+
+  static void Start(Request *request);
+
+  static void Startall(int nrequests, Request *request);
+
+  static void Request_free(Request *request);
+
   static void Wait(Request *request, Status *status);
 
   static void Waitall(int nrequests, Request *request, Status *status);
@@ -179,6 +204,9 @@ public:
   static void Allreduce(void *sendbuf, void *recvbuf, int count,
                         Datatype datatype, Op op, Comm comm);
 
+  static void Iallreduce(void *sendbuf, void *recvbuf, int count,
+                         Datatype datatype, Op op, Comm comm, Request* request);
+
   static void Gather(void *sendbuf, int sendcnt,Datatype sendtype,
                      void *recvbuf, int recvcnt, Datatype recvtype, int root, Comm comm);
 
@@ -355,6 +383,8 @@ private:
 public:
   static int GetRank();
   
+  static double GetWaitTime();
+  
   static int GetSize();  
   
   static Comm GetComm();
@@ -387,6 +417,18 @@ public:
   static void Irecv(void *buf, int count, Datatype datatype, int source,
                     int tag, Comm comm, Request* request);
 
+  static void Send_init(void *buf, int count, Datatype datatype, int dest,
+                        int tag, Comm comm, Request* request);
+
+  static void Recv_init(void *buf, int count, Datatype datatype, int source,
+                        int tag, Comm comm, Request* request);
+
+  static void Start(Request *request);
+
+  static void Startall(int nrequests, Request *request);
+
+  static void Request_free(Request *request);
+
   static void Wait(Request *request, Status *status);
 
   static void Waitall(int nrequests, Request *request, Status *status);
@@ -414,6 +456,9 @@ public:
   static void Allreduce(void *sendbuf, void *recvbuf, int count,
                         Datatype datatype, Op op, Comm comm);
 
+  static void Iallreduce(void *sendbuf, void *recvbuf, int count,
+                         Datatype datatype, Op op, Comm comm, Request* request);
+
   static void Gather(void *sendbuf, int sendcnt, Datatype sendtype,
                      void *recvbuf, int recvcnt, Datatype recvtype, int root, Comm comm);
 
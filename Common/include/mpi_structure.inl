@@ -106,6 +106,10 @@ inline int CBaseMPIWrapper::GetRank(){
   return Rank;
 }
 
+inline double CBaseMPIWrapper::GetWaitTime(){
+  return WaitTime;
+}
+
 inline int CBaseMPIWrapper::GetSize(){
   return Size;
 }
@@ -159,7 +163,9 @@ inline void CBaseMPIWrapper::Finalize(){
 }
 
 inline void CBaseMPIWrapper::Barrier(Comm comm) {
+  double StartTime = MPI_Wtime();
   MPI_Barrier(comm);
+  WaitTime += MPI_Wtime()-StartTime;
 }
 
 inline void CBaseMPIWrapper::Abort(Comm comm, int error) {
@@ -180,8 +186,32 @@ inline void CBaseMPIWrapper::Irecv(void *buf, int count, Datatype datatype,
   MPI_Irecv(buf,count,datatype,dest,tag,comm, request);
 }
 
+inline void CBaseMPIWrapper::Send_init(void *buf, int count, Datatype datatype,
+                                   int dest, int tag, Comm comm, Request *request) {
+  MPI_Send_init(buf,count,datatype,dest,tag,comm,request);
+}
+
+inline void CBaseMPIWrapper::Recv_init(void *buf, int count, Datatype datatype,
+                                   int source, int tag, Comm comm, Request *request) {
+  MPI_Recv_init(buf,count,datatype,source,tag,comm,request);
+}
+
+inline void CBaseMPIWrapper::Start(Request *request) {
+  MPI_Start(request);
+}
+
+inline void CBaseMPIWrapper::Startall(int nrequests, Request *request) {
+  MPI_Startall(nrequests, request);
+}
+
+inline void CBaseMPIWrapper::Request_free(Request *request) {
+  MPI_Request_free(request);
+}
+
 inline void CBaseMPIWrapper::Wait(Request *request, Status *status) {
+  double StartTime = MPI_Wtime();
   MPI_Wait(request,status);
+  WaitTime += MPI_Wtime()-StartTime;
 }
 
 inline void CBaseMPIWrapper::Testall(int count, Request *array_of_requests, int *flag, Status *array_of_statuses) {
@@ -189,7 +219,9 @@ inline void CBaseMPIWrapper::Testall(int count, Request *array_of_requests, int
 }
 
 inline void CBaseMPIWrapper::Waitall(int nrequests, Request *request, Status *status) {
+  double StartTime = MPI_Wtime();
   MPI_Waitall(nrequests, request, status);
+  WaitTime += MPI_Wtime()-StartTime;
 }
 
 inline void CBaseMPIWrapper::Probe(int source, int tag, Comm comm, Status *status){
@@ -208,7 +240,9 @@ inline void CBaseMPIWrapper::Recv(void *buf, int count, Datatype datatype,
 
 inline void CBaseMPIWrapper::Bcast(void *buf, int count, Datatype datatype,
                                int root, Comm comm) {
+  double StartTime = MPI_Wtime();
   MPI_Bcast(buf,count,datatype,root,comm);
+  WaitTime += MPI_Wtime()-StartTime;
 }
 
 inline void CBaseMPIWrapper::Bsend(void *buf, int count, Datatype datatype,
@@ -223,7 +257,20 @@ inline void CBaseMPIWrapper::Reduce(void *sendbuf, void *recvbuf, int count,
 
 inline void CBaseMPIWrapper::Allreduce(void *sendbuf, void *recvbuf, int count,
                                    Datatype datatype, Op op, Comm comm) {
+  double StartTime = MPI_Wtime();
+  MPI_Allreduce(sendbuf,recvbuf,count,datatype,op,comm);
+  WaitTime += MPI_Wtime()-StartTime;
+}
+
+inline void CBaseMPIWrapper::Iallreduce(void *sendbuf, void *recvbuf, int count,
+                                    Datatype datatype, Op op, Comm comm, Request* request) {
+#if MPI_VERSION >= 3
+  MPI_Iallreduce(sendbuf,recvbuf,count,datatype,op,comm,request);
+#else
+  /*--- Non-blocking collectives are not available, the reduction completes here. ---*/
   MPI_Allreduce(sendbuf,recvbuf,count,datatype,op,comm);
+  *request = MPI_REQUEST_NULL;
+#endif
 }
 
 inline void CBaseMPIWrapper::Gather(void *sendbuf, int sendcnt,Datatype sendtype,
@@ -270,7 +317,9 @@ inline void CBaseMPIWrapper::Reduce_scatter(void *sendbuf, void *recvbuf, int *r
 
 inline void CBaseMPIWrapper::Waitany(int nrequests, Request *request,
                                  int *index, Status *status) {
+  double StartTime = MPI_Wtime();
   MPI_Waitany(nrequests, request, index, status);
+  WaitTime += MPI_Wtime()-StartTime;
 }
   
 
@@ -509,6 +558,10 @@ inline int CBaseMPIWrapper::GetRank(){
   return Rank;
 }
 
+inline double CBaseMPIWrapper::GetWaitTime(){
+  return 0.0;
+}
+
 inline int CBaseMPIWrapper::GetSize(){
   return Size;
 }
@@ -543,6 +596,18 @@ inline void CBaseMPIWrapper::Isend(void *buf, int count, Datatype datatype, int
 inline void CBaseMPIWrapper::Irecv(void *buf, int count, Datatype datatype, int source,
                                int tag, Comm comm, Request* request) {}
 
+inline void CBaseMPIWrapper::Send_init(void *buf, int count, Datatype datatype, int dest,
+                                   int tag, Comm comm, Request* request) {}
+
+inline void CBaseMPIWrapper::Recv_init(void *buf, int count, Datatype datatype, int source,
+                                   int tag, Comm comm, Request* request) {}
+
+inline void CBaseMPIWrapper::Start(Request *request) {}
+
+inline void CBaseMPIWrapper::Startall(int nrequests, Request *request) {}
+
+inline void CBaseMPIWrapper::Request_free(Request *request) {}
+
 inline void CBaseMPIWrapper::Wait(Request *request, Status *status) {}
 
 inline void CBaseMPIWrapper::Waitall(int nrequests, Request *request, Status *status) {}
@@ -572,6 +637,11 @@ inline void  CBaseMPIWrapper::Allreduce(void *sendbuf, void *recvbuf, int count,
    CopyData(sendbuf, recvbuf, count, datatype);
 }
 
+inline void  CBaseMPIWrapper::Iallreduce(void *sendbuf, void *recvbuf, int count,
+                                     Datatype datatype, Op op, Comm comm, Request* request){
+   CopyData(sendbuf, recvbuf, count, datatype);
+}
+
 inline void CBaseMPIWrapper::Gather(void *sendbuf, int sendcnt, Datatype sendtype,
                    void *recvbuf, int recvcnt, Datatype recvtype, int root, Comm comm){
   CopyData(sendbuf, recvbuf, sendcnt, sendtype);
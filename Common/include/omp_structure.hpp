@@ -0,0 +1,70 @@
+/*!
+ * \file omp_structure.hpp
+ * \brief Thin wrapper of the OpenMP interface, so that the shared-memory
+ *        parallel loops compile (serially) when OpenMP is not available.
+ * \version 6.2.0 "Falcon"
+ *
+ * The current SU2 release has been coordinated by the
+ * SU2 International Developers Society <www.su2devsociety.org>
+ * with selected contributions from the open-source community.
+ *
+ * The main research teams contributing to the current release are:
+ *  - Prof. Juan J. Alonso's group at Stanford University.
+ *  - Prof. Piero Colonna's group at Delft University of Technology.
+ *  - Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+ *  - Prof. Alberto Guardone's group at Polytechnic University of Milan.
+ *  - Prof. Rafael Palacios' group at Imperial College London.
+ *  - Prof. Vincent Terrapon's group at the University of Liege.
+ *  - Prof. Edwin van der Weide's group at the University of Twente.
+ *  - Lab. of New Concepts in Aeronautics at Tech. Institute of Aeronautics.
+ *
+ * Copyright 2012-2019, Francisco D. Palacios, Thomas D. Economon,
+ *                      Tim Albring, and the SU2 contributors.
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+/*--- The AD tapes are not thread safe, hence the reverse mode types are
+ always compiled without the OpenMP directives. ---*/
+
+#if defined HAVE_OMP && !defined CODI_REVERSE_TYPE
+
+#include <omp.h>
+
+#define SU2_OMP_ENABLED
+
+/*--- Convert the arguments of the macro into an OpenMP pragma (variadic
+ since the clauses of a directive are separated by commas). ---*/
+#define SU2_PRAGMA(...) _Pragma(#__VA_ARGS__)
+#define SU2_OMP(...) SU2_PRAGMA(omp __VA_ARGS__)
+
+#else
+
+#define SU2_OMP(...)
+
+inline int omp_get_max_threads(void) { return 1; }
+inline int omp_get_num_threads(void) { return 1; }
+inline int omp_get_thread_num(void) { return 0; }
+
+#endif
+
+/*--- Shorthands for the most common constructs. ---*/
+
+#define SU2_OMP_PARALLEL SU2_OMP(parallel)
+#define SU2_OMP_FOR_STAT SU2_OMP(for schedule(static))
+#define SU2_OMP_BARRIER SU2_OMP(barrier)
+#define SU2_OMP_MASTER SU2_OMP(master)
+#define SU2_OMP_SIMD SU2_OMP(simd)
@@ -1521,11 +1521,59 @@ static const map<string, ENUM_ADAPT> Adapt_Map = CCreateMap<string, ENUM_ADAPT>
  */
 enum ENUM_INPUT {
   SU2 = 1,                       /*!< \brief SU2 input format. */
-  CGNS = 2                     /*!< \brief CGNS input format for the computational grid. */
+  CGNS = 2,                    /*!< \brief CGNS input format for the computational grid. */
+  SU2_BINARY = 3               /*!< \brief SU2 binary format, read in parallel with MPI I/O. */
 };
 static const map<string, ENUM_INPUT> Input_Map = CCreateMap<string, ENUM_INPUT>
 ("SU2", SU2)
-("CGNS", CGNS);
+("CGNS", CGNS)
+("SU2_BINARY", SU2_BINARY);
+
+/*!
+ * \brief Entries of the header of SU2_BINARY mesh files, an array of long long that is
+ *        followed by the AoA and AoS offsets (passivedouble). The header is followed by
+ *        the coordinates (nPoint x nDim passivedouble), the element offsets (nElem+1
+ *        long long), the element connectivity (VTK type and nodes of each element, long long)
+ *        and the markers (tag length, number of elements and connectivity length as long long,
+ *        the tag, and the VTK type and nodes of each boundary element).
+ */
+enum ENUM_MESH_BINARY_HEADER {
+  MESH_BIN_MAGIC = 0,        /*!< \brief Identifier of the format (535532, the hex representation of "SU2"). */
+  MESH_BIN_VERSION = 1,      /*!< \brief Version of the format. */
+  MESH_BIN_NDIM = 2,         /*!< \brief Number of dimensions. */
+  MESH_BIN_NPOINT = 3,       /*!< \brief Number of points. */
+  MESH_BIN_NPOINTDOMAIN = 4, /*!< \brief Number of points without ghost points. */
+  MESH_BIN_NELEM = 5,        /*!< \brief Number of volume elements. */
+  MESH_BIN_NELEMCONN = 6,    /*!< \brief Length of the volume connectivity (types and nodes). */
+  MESH_BIN_NMARKER = 7,      /*!< \brief Number of markers. */
+  MESH_BIN_NVARS = 8         /*!< \brief Size of the header. */
+};
+const long long MESH_BIN_FORMAT_ID = 535532;  /*!< \brief Identifier of SU2_BINARY mesh files. */
+const long long MESH_BIN_FORMAT_VERSION = 1;  /*!< \brief Current version of the SU2_BINARY mesh format. */
+
+/*!
+ * \brief Types of partitioners of the grid (finite volume solvers).
+ */
+enum ENUM_PARTITIONER {
+  PARMETIS_PARTITIONER = 0,  /*!< \brief Graph partitioning with ParMETIS. */
+  HILBERT_PARTITIONER = 1    /*!< \brief Geometric partitioning along a Hilbert space-filling curve. */
+};
+static const map<string, ENUM_PARTITIONER> Partitioner_Map = CCreateMap<string, ENUM_PARTITIONER>
+("PARMETIS", PARMETIS_PARTITIONER)
+("HILBERT", HILBERT_PARTITIONER);
+
+/*!
+ * \brief Types of vertex weights of the graph partitioning.
+ */
+enum ENUM_PARTITION_WEIGHTS {
+  NO_PARTITION_WEIGHTS = 0,  /*!< \brief All the points have the same weight. */
+  COST_MODEL_WEIGHTS = 1,    /*!< \brief Weights from a cost model of the points (neighbors and boundary vertices). */
+  MEASURED_WEIGHTS = 2       /*!< \brief Weights measured in a previous run (read from file). */
+};
+static const map<string, ENUM_PARTITION_WEIGHTS> Partition_Weights_Map = CCreateMap<string, ENUM_PARTITION_WEIGHTS>
+("NONE", NO_PARTITION_WEIGHTS)
+("COST_MODEL", COST_MODEL_WEIGHTS)
+("MEASURED", MEASURED_WEIGHTS);
 
 const int CGNS_STRING_SIZE = 33;/*!< \brief Length of strings used in the CGNS format. */
 
@@ -1780,13 +1828,15 @@ enum ENUM_LINEAR_SOLVER_PREC {
   JACOBI = 1,		/*!< \brief Jacobi preconditioner. */
   LU_SGS = 2,		/*!< \brief LU SGS preconditioner. */
   LINELET = 3,  /*!< \brief Line implicit preconditioner. */
-  ILU = 4       /*!< \brief ILU(0) preconditioner. */
+  ILU = 4,      /*!< \brief ILU(0) preconditioner. */
+  AMG = 5       /*!< \brief Smoothed aggregation algebraic multigrid preconditioner. */
 };
 static const map<string, ENUM_LINEAR_SOLVER_PREC> Linear_Solver_Prec_Map = CCreateMap<string, ENUM_LINEAR_SOLVER_PREC>
 ("JACOBI", JACOBI)
 ("LU_SGS", LU_SGS)
 ("LINELET", LINELET)
-("ILU", ILU);
+("ILU", ILU)
+("AMG", AMG);
 
 /*!
  * \brief types of analytic definitions for various geometries
@@ -0,0 +1,157 @@
+/*!
+ * \file CReproducibleSum.hpp
+ * \brief Exact (and therefore reproducible) accumulation of sums of doubles,
+ *        used for the global reductions when their result must not depend
+ *        on the number of ranks. The functions are in <i>CReproducibleSum.cpp</i>.
+ * \version 6.2.0 "Falcon"
+ *
+ * The current SU2 release has been coordinated by the
+ * SU2 International Developers Society <www.su2devsociety.org>
+ * with selected contributions from the open-source community.
+ *
+ * The main research teams contributing to the current release are:
+ *  - Prof. Juan J. Alonso's group at Stanford University.
+ *  - Prof. Piero Colonna's group at Delft University of Technology.
+ *  - Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+ *  - Prof. Alberto Guardone's group at Polytechnic University of Milan.
+ *  - Prof. Rafael Palacios' group at Imperial College London.
+ *  - Prof. Vincent Terrapon's group at the University of Liege.
+ *  - Prof. Edwin van der Weide's group at the University of Twente.
+ *  - Lab. of New Concepts in Aeronautics at Tech. Institute of Aeronautics.
+ *
+ * Copyright 2012-2019, Francisco D. Palacios, Thomas D. Economon,
+ *                      Tim Albring, and the SU2 contributors.
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../mpi_structure.hpp"
+#include <cmath>
+#include <cstring>
+
+/*!
+ * \class CReproducibleSum
+ * \brief Fixed-point accumulator that covers the whole range of double precision
+ *        (a "superaccumulator"), the sum of any set of doubles is exact and does
+ *        not depend on the order in which they are added.
+ *
+ * The bits of the accumulator are stored in 32 bit chunks held by 64 bit integers,
+ * which leaves room to add many values (or the accumulators of many ranks) before
+ * the carries need to be propagated. The global sum is an integer reduction of the
+ * chunks, hence it is the same for any number of ranks and any partition. Only the
+ * conversion of the final result to double is rounded.
+ */
+class CReproducibleSum {
+private:
+  static bool active;                   /*!< \brief Use the reproducible reductions (REPRODUCIBLE_REDUCTIONS option). */
+
+  static const int nChunk = 70;         /*!< \brief Number of 32 bit chunks, 2^-1152 to 2^1088. */
+  static const int Offset = 1152;       /*!< \brief Position of the bit 2^0 in the accumulator. */
+  static const long MaxPending = 1L<<28;/*!< \brief Additions allowed before the carries are propagated. */
+
+  long long chunk[nChunk];  /*!< \brief Chunks of the fixed-point value, least significant first. */
+  double nonfinite;         /*!< \brief Sum of the infinite and NaN values (they are not representable). */
+  long pending;             /*!< \brief Additions since the last propagation of the carries. */
+
+  /*!
+   * \brief Propagate the carries, all chunks but the last are then in [0, 2^32).
+   */
+  void Normalize(void);
+
+public:
+
+  /*!
+   * \brief Constructor of the class, the accumulator is zero.
+   */
+  CReproducibleSum(void) { Clear(); }
+
+  /*!
+   * \brief Select if the global reductions of the code (dot products of the linear
+   *        solvers and residual monitors) should be reproducible.
+   * \param[in] val_active - Use the reproducible reductions.
+   */
+  static void SetActive(bool val_active) { active = val_active; }
+
+  /*!
+   * \brief Check if the reproducible reductions are used.
+   */
+  static bool GetActive(void) { return active; }
+
+  /*!
+   * \brief Set the accumulator to zero.
+   */
+  inline void Clear(void) {
+    for (int i = 0; i < nChunk; i++) chunk[i] = 0;
+    nonfinite = 0.0;
+    pending = 0;
+  }
+
+  /*!
+   * \brief Add a value to the accumulator (exactly).
+   * \param[in] val - Value to add.
+   */
+  inline void Add(double val) {
+
+    /*--- val = +-mant * 2^(bexp-1075), with mant an integer of up to 53 bits,
+     taken directly from the bits of the IEEE representation. ---*/
+
+    unsigned long long bits;
+    std::memcpy(&bits, &val, sizeof(double));
+
+    int bexp = int((bits >> 52) & 0x7FF);
+    unsigned long long mant = bits & 0xFFFFFFFFFFFFFULL;
+
+    if (bexp == 0x7FF) { nonfinite += val; return; }
+    if (bexp == 0) { if (mant == 0) return; bexp = 1; }
+    else mant |= 0x10000000000000ULL;
+
+    long long sign = (bits >> 63)? -1 : 1;
+
+    /*--- Split the shifted mantissa (up to 84 bits) over three chunks. ---*/
+
+    int pos = bexp - 1075 + Offset;
+    int idx = pos / 32, shift = pos % 32;
+
+    unsigned long long lo = (mant & 0xFFFFFFFFULL) << shift;
+    unsigned long long hi = (mant >> 32) << shift;
+
+    chunk[idx]   += sign*(long long)(lo & 0xFFFFFFFFULL);
+    chunk[idx+1] += sign*(long long)((lo >> 32) + (hi & 0xFFFFFFFFULL));
+    chunk[idx+2] += sign*(long long)(hi >> 32);
+
+    if (++pending == MaxPending) Normalize();
+  }
+
+  /*!
+   * \brief Add the value of another accumulator (exactly).
+   * \param[in] other - Accumulator to add.
+   */
+  void Add(const CReproducibleSum & other);
+
+  /*!
+   * \brief Value of the sum rounded to double, the rounding only depends on the exact sum.
+   * \return Sum of the values added.
+   */
+  double GetValue(void) const;
+
+  /*!
+   * \brief Sum the accumulators over all ranks, all the ranks get the same (exact) result.
+   * \param[in,out] sums - Accumulators, on exit the global sums.
+   * \param[in] count - Number of accumulators.
+   */
+  static void Allreduce(CReproducibleSum *sums, int count);
+
+};
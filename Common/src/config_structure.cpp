@@ -62,6 +62,7 @@ vector<double> GEMM_Profile_MaxTime;      /*!< \brief Maximum time spent for thi
 
 #include "../include/ad_structure.hpp"
 #include "../include/toolboxes/printing_toolbox.hpp"
+#include "../include/toolboxes/CReproducibleSum.hpp"
 
 CConfig::CConfig(char case_filename[MAX_STRING_SIZE], unsigned short val_software, unsigned short val_nZone, bool verb_high) {
   
@@ -381,6 +382,28 @@ unsigned short CConfig::GetnDim(string val_mesh_filename, unsigned short val_for
       break;
     }
 
+    case SU2_BINARY: {
+
+      /*--- The dimension is stored in the header of the binary mesh. ---*/
+      long long Mesh_Vars[MESH_BIN_NVARS];
+      FILE *fhw = fopen(val_mesh_filename.c_str(), "rb");
+      if (!fhw) {
+        SU2_MPI::Error(string("The SU2 binary mesh file named ") + val_mesh_filename + string(" was not found."), CURRENT_FUNCTION);
+      }
+      size_t ret = fread(Mesh_Vars, sizeof(long long), MESH_BIN_NVARS, fhw);
+      fclose(fhw);
+
+      if ((ret != (size_t)MESH_BIN_NVARS) || (Mesh_Vars[MESH_BIN_MAGIC] != MESH_BIN_FORMAT_ID)) {
+        SU2_MPI::Error(val_mesh_filename + string(" is not an SU2 binary mesh file."), CURRENT_FUNCTION);
+      }
+      if ((Mesh_Vars[MESH_BIN_NDIM] != 2) && (Mesh_Vars[MESH_BIN_NDIM] != 3)) {
+        SU2_MPI::Error("Wrong number of dimensions in the SU2 binary mesh file.", CURRENT_FUNCTION);
+      }
+      nDim = Mesh_Vars[MESH_BIN_NDIM];
+
+      break;
+    }
+
     case CGNS: {
 
 #ifdef HAVE_CGNS
@@ -1390,8 +1413,26 @@ void CConfig::SetConfig_Options() {
   addUnsignedLongOption("LINEAR_SOLVER_ITER_HEAT", Linear_Solver_Iter_Heat, 10);
   /* DESCRIPTION: Fill in level for the ILU preconditioner */
   addUnsignedShortOption("LINEAR_SOLVER_ILU_FILL_IN", Linear_Solver_ILU_n, 0);
+  /* DESCRIPTION: Maximum number of levels of the AMG preconditioner */
+  addUnsignedShortOption("LINEAR_SOLVER_AMG_LEVELS", Linear_Solver_AMG_Levels, 10);
+  /* DESCRIPTION: Strength of connection threshold for the aggregation of the AMG preconditioner */
+  addDoubleOption("LINEAR_SOLVER_AMG_STRENGTH", Linear_Solver_AMG_Strength, 0.08);
   /* DESCRIPTION: Maximum number of iterations of the linear solver for the implicit formulation */
   addUnsignedLongOption("LINEAR_SOLVER_RESTART_FREQUENCY", Linear_Solver_Restart_Frequency, 10);
+  /* DESCRIPTION: Fuse the global reductions of FGMRES (classical Gram-Schmidt) and BCGSTAB, fewer synchronizations per iteration */
+  addBoolOption("LINEAR_SOLVER_FUSED_REDUCTIONS", Linear_Solver_Fused_Reductions, false);
+  /* DESCRIPTION: Number of vectors of the Krylov subspace recycled by FGMRES between linear solves (0 = no recycling) */
+  addUnsignedLongOption("LINEAR_SOLVER_RECYCLE_SIZE", Linear_Solver_Recycle_Size, 0);
+  /* DESCRIPTION: Maximum number of consecutive linear solves that reuse the preconditioner (0 = rebuild for every solve) */
+  addUnsignedLongOption("LINEAR_SOLVER_PREC_REUSE", Linear_Solver_Prec_Reuse, 0);
+  /* DESCRIPTION: Rebuild a reused preconditioner when the linear convergence rate drops by this factor */
+  addDoubleOption("LINEAR_SOLVER_PREC_DEGRADATION", Linear_Solver_Prec_Degradation, 2.0);
+  /* DESCRIPTION: Matrix-free Newton-Krylov mode, the approximate Jacobian is only used as preconditioner */
+  addBoolOption("NEWTON_KRYLOV", Newton_Krylov, false);
+  /* DESCRIPTION: Relative finite difference step of the matrix-free Jacobian-vector product */
+  addDoubleOption("NEWTON_KRYLOV_EPSILON", Newton_Krylov_Epsilon, 1E-7);
+  /* DESCRIPTION: Exact global sums for dot products and residual norms, results independent of the number of ranks */
+  addBoolOption("REPRODUCIBLE_REDUCTIONS", Reproducible_Reductions, false);
   /* DESCRIPTION: Relaxation factor for iterative linear smoothers (SMOOTHER_ILU/JACOBI/LU-SGS/LINELET) */
   addDoubleOption("LINEAR_SOLVER_SMOOTHER_RELAXATION", Linear_Solver_Smoother_Relaxation, 1.0);
   /* DESCRIPTION: Relaxation of the flow equations solver for the implicit formulation */
@@ -1510,6 +1551,9 @@ void CConfig::SetConfig_Options() {
   /*!\brief LIMITER_ITER
    *  \n DESCRIPTION: Freeze the value of the limiter after a number of iterations. DEFAULT value 999999. \ingroup Config*/
   addUnsignedLongOption("LIMITER_ITER", LimiterIter, 999999);
+  /*!\brief EDGE_COLORING_GROUP_SIZE
+   *  \n DESCRIPTION: Number of consecutive edges that are colored as one group and processed by the same thread in the shared-memory parallel edge loops. DEFAULT value 512. \ingroup Config*/
+  addUnsignedLongOption("EDGE_COLORING_GROUP_SIZE", Edge_Coloring_Group_Size, 512);
 
   /*!\brief CONV_NUM_METHOD_FLOW
    *  \n DESCRIPTION: Convective numerical method \n OPTIONS: See \link Upwind_Map \endlink , \link Centered_Map \endlink. \ingroup Config*/
@@ -1663,6 +1707,26 @@ void CConfig::SetConfig_Options() {
   addStringOption("MESH_FILENAME", Mesh_FileName, string("mesh.su2"));
   /*!\brief MESH_OUT_FILENAME \n DESCRIPTION: Mesh output file name. Used when converting, scaling, or deforming a mesh. \n DEFAULT: mesh_out.su2 \ingroup Config*/
   addStringOption("MESH_OUT_FILENAME", Mesh_Out_FileName, string("mesh_out.su2"));
+  /*!\brief MESH_OUT_FORMAT \n DESCRIPTION: Format of the mesh written by SU2_DEF, SU2 or SU2_BINARY \n DEFAULT: SU2 \ingroup Config*/
+  addEnumOption("MESH_OUT_FORMAT", Mesh_Out_FileFormat, Input_Map, SU2);
+  /*!\brief GRID_PARTITIONER \n DESCRIPTION: Partitioner of the grid, graph partitioning (PARMETIS) or geometric along a space-filling curve (HILBERT) \n OPTIONS: see \link Partitioner_Map \endlink \n DEFAULT: PARMETIS \ingroup Config*/
+  addEnumOption("GRID_PARTITIONER", Kind_Partitioner, Partitioner_Map, PARMETIS_PARTITIONER);
+  /*!\brief PARTITION_CACHE \n DESCRIPTION: Store the ParMETIS colors of the grid points and reuse them when the same grid topology is partitioned for the same number of ranks (the structures built from the partition are not cached) \n DEFAULT: NO \ingroup Config*/
+  addBoolOption("PARTITION_CACHE", Partition_Cache, false);
+  /*!\brief PARTITION_CACHE_FILENAME \n DESCRIPTION: Prefix of the partition cache files \n DEFAULT: partition_cache \ingroup Config*/
+  addStringOption("PARTITION_CACHE_FILENAME", Partition_Cache_FileName, string("partition_cache"));
+  /*!\brief PARTITION_WEIGHTS \n DESCRIPTION: Vertex weights of the ParMETIS partitioning \n OPTIONS: see \link Partition_Weights_Map \endlink \n DEFAULT: NONE \ingroup Config*/
+  addEnumOption("PARTITION_WEIGHTS", Kind_Partition_Weights, Partition_Weights_Map, NO_PARTITION_WEIGHTS);
+  /*!\brief PARTITION_WEIGHTS_FILENAME \n DESCRIPTION: File of the point weights measured in a previous run \n DEFAULT: partition_weights.dat \ingroup Config*/
+  addStringOption("PARTITION_WEIGHTS_FILENAME", Partition_Weights_FileName, string("partition_weights.dat"));
+  /*!\brief WRT_PARTITION_WEIGHTS \n DESCRIPTION: Write the measured point weights with the solution files \n DEFAULT: NO \ingroup Config*/
+  addBoolOption("WRT_PARTITION_WEIGHTS", Wrt_Partition_Weights, false);
+  /*!\brief LOAD_BALANCE_FREQ \n DESCRIPTION: Iterations between the checks of the load imbalance of the ranks (0 to disable) \n DEFAULT: 0 \ingroup Config*/
+  addUnsignedLongOption("LOAD_BALANCE_FREQ", Load_Balance_Freq, 0);
+  /*!\brief LOAD_BALANCE_THRESHOLD \n DESCRIPTION: Load imbalance (maximum over mean time of the ranks, minus one) above which the grid is repartitioned \n DEFAULT: 0.2 \ingroup Config*/
+  addDoubleOption("LOAD_BALANCE_THRESHOLD", Load_Balance_Threshold, 0.2);
+  /*!\brief LOAD_BALANCE_RESTART \n DESCRIPTION: Stop the run with a restart when the load imbalance is above the threshold \n DEFAULT: NO \ingroup Config*/
+  addBoolOption("LOAD_BALANCE_RESTART", Load_Balance_Restart, false);
   /* DESCRIPTION: Determine if the mesh file supports multizone. \n DEFAULT: true (temporarily) */
   addBoolOption("MULTIZONE_MESH", Multizone_Mesh, true);
   /* DESCRIPTION: Determine if we need to allocate memory to store the multizone residual. \n DEFAULT: true (temporarily) */
@@ -3204,6 +3268,31 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
   if ((Kind_Regime == EULER) && (Buffet_Monitoring == true)){
     SU2_MPI::Error("Buffet monitoring incompatible with Euler Solver", CURRENT_FUNCTION);
   }
+
+  if (Newton_Krylov) {
+    if ((Kind_Regime != COMPRESSIBLE) || ((Kind_Solver != EULER) && (Kind_Solver != NAVIER_STOKES) && (Kind_Solver != RANS)))
+      SU2_MPI::Error("NEWTON_KRYLOV is only available for the direct compressible flow solvers.", CURRENT_FUNCTION);
+    if (Kind_TimeIntScheme_Flow != EULER_IMPLICIT)
+      SU2_MPI::Error("NEWTON_KRYLOV requires TIME_DISCRE_FLOW= EULER_IMPLICIT.", CURRENT_FUNCTION);
+    if (DiscreteAdjoint || AD_Mode)
+      SU2_MPI::Error("NEWTON_KRYLOV is not compatible with algorithmic differentiation.", CURRENT_FUNCTION);
+    if (Low_Mach_Precon || (Kind_Upwind_Flow == TURKEL))
+      SU2_MPI::Error("NEWTON_KRYLOV is not compatible with low Mach number preconditioning.", CURRENT_FUNCTION);
+  }
+
+  /*--- The fused reductions of the Krylov solvers bypass the exact sums. ---*/
+
+  if (Reproducible_Reductions && Linear_Solver_Fused_Reductions) {
+    if (rank == MASTER_NODE)
+      cout << "REPRODUCIBLE_REDUCTIONS= YES, LINEAR_SOLVER_FUSED_REDUCTIONS is ignored." << endl;
+    Linear_Solver_Fused_Reductions = false;
+  }
+
+  CReproducibleSum::SetActive(Reproducible_Reductions);
+
+  if (Mesh_Out_FileFormat == CGNS) {
+    SU2_MPI::Error("MESH_OUT_FORMAT= CGNS is not supported, use SU2 or SU2_BINARY.", CURRENT_FUNCTION);
+  }
   
   /*--- Check for Fluid model consistency ---*/
 
@@ -5992,6 +6081,7 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
                 case LINELET: cout << "Using a linelet preconditioning."<< endl; break;
                 case LU_SGS:  cout << "Using a LU-SGS preconditioning."<< endl; break;
                 case JACOBI:  cout << "Using a Jacobi preconditioning."<< endl; break;
+                case AMG:     cout << "Using an algebraic multigrid preconditioning."<< endl; break;
               }
               break;
             case SMOOTHER:
@@ -6000,6 +6090,7 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
                 case LINELET: cout << "A Linelet"; break;
                 case LU_SGS:  cout << "A LU-SGS"; break;
                 case JACOBI:  cout << "A Jacobi"; break;
+                case AMG:     cout << "An algebraic multigrid"; break;
               }
               cout << " method is used for smoothing the linear system." << endl;
               break;
@@ -402,6 +402,7 @@ CEdge::CEdge(unsigned long val_iPoint, unsigned long val_jPoint, unsigned short
   Coord_CG = NULL;
   Normal   = NULL;
   Nodes    = NULL;
+  External_Storage = false;
 
   /*--- Allocate center of gravity coordinates, nodes, and face normal ---*/
   Coord_CG = new su2double [nDim];
@@ -422,11 +423,33 @@ CEdge::CEdge(unsigned long val_iPoint, unsigned long val_jPoint, unsigned short
 CEdge::~CEdge() {
   
   if (Coord_CG != NULL) delete[] Coord_CG;
-  if (Normal   != NULL) delete[] Normal;
-  if (Nodes    != NULL) delete[] Nodes;
+  if (!External_Storage) {
+    if (Normal != NULL) delete[] Normal;
+    if (Nodes  != NULL) delete[] Nodes;
+  }
   
 }
 
+void CEdge::SetExternalStorage(unsigned long *val_nodes, su2double *val_normal) {
+
+  unsigned short iDim;
+
+  val_nodes[0] = Nodes[0];
+  val_nodes[1] = Nodes[1];
+  for (iDim = 0; iDim < nDim; iDim++)
+    val_normal[iDim] = Normal[iDim];
+
+  if (!External_Storage) {
+    delete [] Nodes;
+    delete [] Normal;
+  }
+
+  Nodes  = val_nodes;
+  Normal = val_normal;
+  External_Storage = true;
+
+}
+
 void CEdge::SetCoord_CG(su2double **val_coord) {
 
   unsigned short iDim, iNode;
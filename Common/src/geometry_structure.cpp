@@ -39,6 +39,10 @@
 #include "../include/adt_structure.hpp"
 #include "../include/toolboxes/printing_toolbox.hpp"
 #include "../include/element_structure.hpp"
+#include "../include/omp_structure.hpp"
+#ifdef HAVE_CGNS
+#include "cgns_io.h"
+#endif
 #include <iomanip>
 #include <sys/types.h>
 #include <sys/stat.h>
@@ -83,6 +87,9 @@ CGeometry::CGeometry(void) {
   bound               = NULL;
   node                = NULL;
   edge                = NULL;
+  EdgeNodes           = NULL;
+  EdgeNormals         = NULL;
+  EdgeColorGroupSize  = 0;
   vertex              = NULL;
   nVertex             = NULL;
   newBound            = NULL;
@@ -127,6 +134,32 @@ CGeometry::CGeometry(void) {
   req_P2PSend = NULL;
   req_P2PRecv = NULL;
   
+  /*--- Persistent requests are not available through the AD wrappers of MPI. ---*/
+  
+#if defined CODI_REVERSE_TYPE || defined CODI_FORWARD_TYPE || defined HAVE_NEIGHBOR_COLLECTIVES
+  P2PPersistent = false;
+#else
+  P2PPersistent = true;
+#endif
+  
+#ifdef HAVE_NEIGHBOR_COLLECTIVES
+  P2PGraphComm[0] = MPI_COMM_NULL;
+  P2PGraphComm[1] = MPI_COMM_NULL;
+  P2PGraph_SendCounts = NULL;
+  P2PGraph_SendDispls = NULL;
+  P2PGraph_RecvCounts = NULL;
+  P2PGraph_RecvDispls = NULL;
+  P2PGraph_Sources    = NULL;
+  iP2PGraphRecv       = 0;
+#endif
+  
+  for (unsigned short iSet = 0; iSet < 4; iSet++) {
+    reqPers_P2PSend[iSet] = NULL;
+    reqPers_P2PRecv[iSet] = NULL;
+  }
+  
+  P2PRecv_InPlace = false;
+  
   nPoint_P2PSend = NULL;
   nPoint_P2PRecv = NULL;
   
@@ -206,6 +239,9 @@ CGeometry::~CGeometry(void) {
     delete[] edge;
   }
 
+  if (EdgeNodes   != NULL) delete [] EdgeNodes;
+  if (EdgeNormals != NULL) delete [] EdgeNormals;
+
   if (vertex != NULL) {
     for (iMarker = 0; iMarker < nMarker; iMarker++) {
       for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
@@ -259,6 +295,17 @@ CGeometry::~CGeometry(void) {
   if (bufS_P2PRecv != NULL) delete [] bufS_P2PRecv;
   if (bufS_P2PSend != NULL) delete [] bufS_P2PSend;
   
+  FreePersistentP2PComms();
+  
+#ifdef HAVE_NEIGHBOR_COLLECTIVES
+  for (unsigned short iDir = 0; iDir < 2; iDir++)
+    if (P2PGraphComm[iDir] != MPI_COMM_NULL) MPI_Comm_free(&P2PGraphComm[iDir]);
+  if (P2PGraph_SendCounts != NULL) delete [] P2PGraph_SendCounts;
+  if (P2PGraph_SendDispls != NULL) delete [] P2PGraph_SendDispls;
+  if (P2PGraph_RecvCounts != NULL) delete [] P2PGraph_RecvCounts;
+  if (P2PGraph_RecvDispls != NULL) delete [] P2PGraph_RecvDispls;
+#endif
+  
   if (req_P2PSend != NULL) delete [] req_P2PSend;
   if (req_P2PRecv != NULL) delete [] req_P2PRecv;
   
@@ -316,6 +363,10 @@ void CGeometry::PreprocessP2PComms(CGeometry *geometry,
   
   int iRank, iSend, iRecv, count;
   
+  /*--- Persistent requests of a previous set of lists are not valid anymore. ---*/
+  
+  FreePersistentP2PComms();
+  
   /*--- Create some temporary structures for tracking sends/recvs. ---*/
   
   int *nPoint_Send_All = new int[size+1]; nPoint_Send_All[0] = 0;
@@ -495,6 +546,89 @@ void CGeometry::PreprocessP2PComms(CGeometry *geometry,
     }
   }
   
+  /*--- The halo points are numbered by the rank that owns them (see
+   CPhysicalGeometry::LoadPoints()), so the recv points of each neighbor are
+   normally a contiguous range and the data can be received in place. This is
+   checked here since the lists of the coarse multigrid levels are not ordered
+   in this way. As for the persistent requests, the AD builds keep the comms
+   through the buffers. ---*/
+  
+  P2PRecv_InPlace = true;
+  for (iRecv = 0; iRecv < nP2PRecv; iRecv++) {
+    for (count = nPoint_P2PRecv[iRecv]+1; count < nPoint_P2PRecv[iRecv+1]; count++) {
+      if (Local_Point_P2PRecv[count] != Local_Point_P2PRecv[count-1]+1)
+        P2PRecv_InPlace = false;
+    }
+  }
+  
+#if defined CODI_REVERSE_TYPE || defined CODI_FORWARD_TYPE
+  P2PRecv_InPlace = false;
+#endif
+  
+  /*--- The senders pack the messages for the layout of the recvs, hence all
+   the ranks must agree. ---*/
+  
+  int InPlace_Local = P2PRecv_InPlace, InPlace_Global = P2PRecv_InPlace;
+  SU2_MPI::Allreduce(&InPlace_Local, &InPlace_Global, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+  P2PRecv_InPlace = (InPlace_Global == 1);
+  
+  /*--- Distributed graph topologies for the neighborhood collectives. The
+   collectives involve every rank of the communicator, hence only the ranks
+   that take part in the halo exchange are included. In reverse the sends
+   and recvs are swapped, which needs a second topology. ---*/
+  
+#ifdef HAVE_NEIGHBOR_COLLECTIVES
+  
+  for (unsigned short iDir = 0; iDir < 2; iDir++)
+    if (P2PGraphComm[iDir] != MPI_COMM_NULL) MPI_Comm_free(&P2PGraphComm[iDir]);
+  if (P2PGraph_SendCounts != NULL) delete [] P2PGraph_SendCounts;
+  if (P2PGraph_SendDispls != NULL) delete [] P2PGraph_SendDispls;
+  if (P2PGraph_RecvCounts != NULL) delete [] P2PGraph_RecvCounts;
+  if (P2PGraph_RecvDispls != NULL) delete [] P2PGraph_RecvDispls;
+  
+  int nNeighbor = max(nP2PSend, nP2PRecv);
+  P2PGraph_SendCounts = new int[nNeighbor+1];
+  P2PGraph_SendDispls = new int[nNeighbor+1];
+  P2PGraph_RecvCounts = new int[nNeighbor+1];
+  P2PGraph_RecvDispls = new int[nNeighbor+1];
+  
+  MPI_Comm haloComm;
+  int color = ((nP2PSend > 0) || (nP2PRecv > 0))? 1 : MPI_UNDEFINED;
+  MPI_Comm_split(MPI_COMM_WORLD, color, rank, &haloComm);
+  
+  if (haloComm != MPI_COMM_NULL) {
+    
+    /*--- Ranks of the neighbors in the new communicator. ---*/
+    
+    MPI_Group worldGroup, haloGroup;
+    MPI_Comm_group(MPI_COMM_WORLD, &worldGroup);
+    MPI_Comm_group(haloComm, &haloGroup);
+    
+    int *graphSend = new int[nP2PSend+1];
+    int *graphRecv = new int[nP2PRecv+1];
+    MPI_Group_translate_ranks(worldGroup, nP2PSend, Neighbors_P2PSend, haloGroup, graphSend);
+    MPI_Group_translate_ranks(worldGroup, nP2PRecv, Neighbors_P2PRecv, haloGroup, graphRecv);
+    
+    /*--- The ranks are not reordered, the neighbors keep the order of the
+     send/recv lists so that the buffer offsets can be used directly. ---*/
+    
+    MPI_Dist_graph_create_adjacent(haloComm, nP2PRecv, graphRecv, MPI_UNWEIGHTED,
+                                   nP2PSend, graphSend, MPI_UNWEIGHTED,
+                                   MPI_INFO_NULL, 0, &P2PGraphComm[0]);
+    MPI_Dist_graph_create_adjacent(haloComm, nP2PSend, graphSend, MPI_UNWEIGHTED,
+                                   nP2PRecv, graphRecv, MPI_UNWEIGHTED,
+                                   MPI_INFO_NULL, 0, &P2PGraphComm[1]);
+    
+    delete [] graphSend;
+    delete [] graphRecv;
+    
+    MPI_Group_free(&worldGroup);
+    MPI_Group_free(&haloGroup);
+    MPI_Comm_free(&haloComm);
+  }
+  
+#endif
+  
   /*--- In the future, some additional data structures could be created
    here to separate the interior and boundary nodes in order to help
    further overlap computation and communication. ---*/
@@ -512,6 +646,11 @@ void CGeometry::AllocateP2PComms(unsigned short val_countPerPoint) {
   
   int iSend, iRecv;
   
+  /*--- The persistent requests are bound to the buffers, they are
+   created again when they are used with the new buffers. ---*/
+  
+  FreePersistentP2PComms();
+  
   /*--- Store the larger packet size to the class data. ---*/
   
   countPerPoint = val_countPerPoint;
@@ -544,6 +683,126 @@ void CGeometry::AllocateP2PComms(unsigned short val_countPerPoint) {
   
 }
 
+unsigned short CGeometry::SetPersistentP2PComms(unsigned short commType,
+                                                bool val_reverse) {
+  
+  /*--- One set of requests per data type and direction of the comms. ---*/
+  
+  unsigned short iSet = 0;
+  
+  switch (commType) {
+    case COMM_TYPE_DOUBLE:         iSet = 0; break;
+    case COMM_TYPE_UNSIGNED_SHORT: iSet = 1; break;
+    default:
+      SU2_MPI::Error("Unrecognized data type for point-to-point MPI comms.",
+                     CURRENT_FUNCTION);
+      break;
+  }
+  if (val_reverse) iSet += 2;
+  
+  if (reqPers_P2PRecv[iSet] != NULL) return iSet;
+  
+#if !(defined CODI_REVERSE_TYPE || defined CODI_FORWARD_TYPE)
+  
+  int iRecv, iSend, offset, count, source, dest, tag;
+  
+  reqPers_P2PRecv[iSet] = new SU2_MPI::Request[nP2PRecv];
+  reqPers_P2PSend[iSet] = new SU2_MPI::Request[nP2PSend];
+  
+  /*--- The buffers, counts and neighbors are the same as for the
+   non-blocking comms in PostP2PRecvs() and PostP2PSends(). In reverse
+   the send data structures are used for the recvs and vice-versa. ---*/
+
+  /*--- These recvs go through the comm buffers and are unpacked by the
+   solvers. The solution of the solvers with a contiguous storage is received
+   in place instead (see SetPersistentP2PComms_InPlace()). ---*/
+  
+  su2double      *bufD_Recv = (val_reverse)? bufD_P2PSend : bufD_P2PRecv;
+  su2double      *bufD_Send = (val_reverse)? bufD_P2PRecv : bufD_P2PSend;
+  unsigned short *bufS_Recv = (val_reverse)? bufS_P2PSend : bufS_P2PRecv;
+  unsigned short *bufS_Send = (val_reverse)? bufS_P2PRecv : bufS_P2PSend;
+  
+  int *nPoint_Recv    = (val_reverse)? nPoint_P2PSend : nPoint_P2PRecv;
+  int *nPoint_Send    = (val_reverse)? nPoint_P2PRecv : nPoint_P2PSend;
+  int *Neighbors_Recv = (val_reverse)? Neighbors_P2PSend : Neighbors_P2PRecv;
+  int *Neighbors_Send = (val_reverse)? Neighbors_P2PRecv : Neighbors_P2PSend;
+  
+  for (iRecv = 0; iRecv < nP2PRecv; iRecv++) {
+    
+    offset = countPerPoint*nPoint_Recv[iRecv];
+    count  = countPerPoint*(nPoint_Recv[iRecv+1] - nPoint_Recv[iRecv]);
+    source = Neighbors_Recv[iRecv];
+    tag    = source + 1;
+    
+    if (commType == COMM_TYPE_DOUBLE)
+      SU2_MPI::Recv_init(&(bufD_Recv[offset]), count, MPI_DOUBLE,
+                         source, tag, MPI_COMM_WORLD, &(reqPers_P2PRecv[iSet][iRecv]));
+    else
+      SU2_MPI::Recv_init(&(bufS_Recv[offset]), count, MPI_UNSIGNED_SHORT,
+                         source, tag, MPI_COMM_WORLD, &(reqPers_P2PRecv[iSet][iRecv]));
+  }
+  
+  for (iSend = 0; iSend < nP2PSend; iSend++) {
+    
+    offset = countPerPoint*nPoint_Send[iSend];
+    count  = countPerPoint*(nPoint_Send[iSend+1] - nPoint_Send[iSend]);
+    dest   = Neighbors_Send[iSend];
+    tag    = rank + 1;
+    
+    if (commType == COMM_TYPE_DOUBLE)
+      SU2_MPI::Send_init(&(bufD_Send[offset]), count, MPI_DOUBLE,
+                         dest, tag, MPI_COMM_WORLD, &(reqPers_P2PSend[iSet][iSend]));
+    else
+      SU2_MPI::Send_init(&(bufS_Send[offset]), count, MPI_UNSIGNED_SHORT,
+                         dest, tag, MPI_COMM_WORLD, &(reqPers_P2PSend[iSet][iSend]));
+  }
+  
+#endif
+  
+  return iSet;
+  
+}
+
+void CGeometry::FreePersistentP2PComms(void) {
+  
+#if !(defined CODI_REVERSE_TYPE || defined CODI_FORWARD_TYPE)
+  
+  for (unsigned short iSet = 0; iSet < 4; iSet++) {
+    
+    if (reqPers_P2PRecv[iSet] != NULL) {
+      for (int iRecv = 0; iRecv < nP2PRecv; iRecv++)
+        SU2_MPI::Request_free(&(reqPers_P2PRecv[iSet][iRecv]));
+      delete [] reqPers_P2PRecv[iSet];
+      reqPers_P2PRecv[iSet] = NULL;
+    }
+    
+    if (reqPers_P2PSend[iSet] != NULL) {
+      for (int iSend = 0; iSend < nP2PSend; iSend++)
+        SU2_MPI::Request_free(&(reqPers_P2PSend[iSet][iSend]));
+      delete [] reqPers_P2PSend[iSet];
+      reqPers_P2PSend[iSet] = NULL;
+    }
+    
+  }
+  
+  for (unsigned short iSet = 0; iSet < InPlace_Data.size(); iSet++) {
+    for (int iRecv = 0; iRecv < nP2PRecv; iRecv++)
+      SU2_MPI::Request_free(&(reqPers_InPlaceRecv[iSet][iRecv]));
+    for (int iSend = 0; iSend < nP2PSend; iSend++)
+      SU2_MPI::Request_free(&(reqPers_InPlaceSend[iSet][iSend]));
+    delete [] reqPers_InPlaceRecv[iSet];
+    delete [] reqPers_InPlaceSend[iSet];
+  }
+  
+  InPlace_Data.clear();
+  InPlace_nVar.clear();
+  reqPers_InPlaceRecv.clear();
+  reqPers_InPlaceSend.clear();
+  
+#endif
+  
+}
+
 void CGeometry::PostP2PRecvs(CGeometry *geometry,
                              CConfig *config,
                              unsigned short commType,
@@ -553,6 +812,27 @@ void CGeometry::PostP2PRecvs(CGeometry *geometry,
   
   int iMessage, iRecv, offset, nPointP2P, count, source, tag;
   
+  /*--- With persistent requests the buffers, counts and sources are already
+   bound to the requests, they only need to be started. The handles are
+   copied so that the waits of the callers on req_P2PRecv are unchanged. ---*/
+  
+  /*--- With the neighborhood collectives the recvs are part of the exchange
+   started once all the sends are loaded (see PostP2PSends()). ---*/
+  
+#ifdef HAVE_NEIGHBOR_COLLECTIVES
+  return;
+#endif
+  
+#if !(defined CODI_REVERSE_TYPE || defined CODI_FORWARD_TYPE)
+  if (P2PPersistent) {
+    unsigned short iSet = SetPersistentP2PComms(commType, val_reverse);
+    for (iRecv = 0; iRecv < nP2PRecv; iRecv++)
+      req_P2PRecv[iRecv] = reqPers_P2PRecv[iSet][iRecv];
+    SU2_MPI::Startall(nP2PRecv, req_P2PRecv);
+    return;
+  }
+#endif
+  
   /*--- Launch the non-blocking recv's first. Note that we have stored
    the counts and sources, so we can launch these before we even load
    the data and send from the neighbor ranks. ---*/
@@ -663,6 +943,68 @@ void CGeometry::PostP2PSends(CGeometry *geometry,
   
   int iMessage, offset, nPointP2P, count, dest, tag;
   
+  /*--- Start the neighborhood collective of the whole exchange when the last
+   message is loaded. In reverse the sends and recvs are swapped. ---*/
+  
+#ifdef HAVE_NEIGHBOR_COLLECTIVES
+  int nSend = (val_reverse)? nP2PRecv : nP2PSend;
+  int nRecv = (val_reverse)? nP2PSend : nP2PRecv;
+  
+  if (val_iSend == nSend-1) {
+    
+    int iNeighbor;
+    int *nPoint_Send = (val_reverse)? nPoint_P2PRecv : nPoint_P2PSend;
+    int *nPoint_Recv = (val_reverse)? nPoint_P2PSend : nPoint_P2PRecv;
+    
+    for (iNeighbor = 0; iNeighbor < nSend; iNeighbor++) {
+      P2PGraph_SendCounts[iNeighbor] = countPerPoint*(nPoint_Send[iNeighbor+1]-nPoint_Send[iNeighbor]);
+      P2PGraph_SendDispls[iNeighbor] = countPerPoint*nPoint_Send[iNeighbor];
+    }
+    for (iNeighbor = 0; iNeighbor < nRecv; iNeighbor++) {
+      P2PGraph_RecvCounts[iNeighbor] = countPerPoint*(nPoint_Recv[iNeighbor+1]-nPoint_Recv[iNeighbor]);
+      P2PGraph_RecvDispls[iNeighbor] = countPerPoint*nPoint_Recv[iNeighbor];
+    }
+    
+    P2PGraph_Sources = (val_reverse)? Neighbors_P2PSend : Neighbors_P2PRecv;
+    iP2PGraphRecv    = 0;
+    
+    MPI_Comm graphComm = P2PGraphComm[(val_reverse)? 1 : 0];
+    
+    switch (commType) {
+      case COMM_TYPE_DOUBLE:
+        MPI_Ineighbor_alltoallv((val_reverse)? bufD_P2PRecv : bufD_P2PSend,
+                                P2PGraph_SendCounts, P2PGraph_SendDispls, MPI_DOUBLE,
+                                (val_reverse)? bufD_P2PSend : bufD_P2PRecv,
+                                P2PGraph_RecvCounts, P2PGraph_RecvDispls, MPI_DOUBLE,
+                                graphComm, &req_P2PGraph);
+        break;
+      case COMM_TYPE_UNSIGNED_SHORT:
+        MPI_Ineighbor_alltoallv((val_reverse)? bufS_P2PRecv : bufS_P2PSend,
+                                P2PGraph_SendCounts, P2PGraph_SendDispls, MPI_UNSIGNED_SHORT,
+                                (val_reverse)? bufS_P2PSend : bufS_P2PRecv,
+                                P2PGraph_RecvCounts, P2PGraph_RecvDispls, MPI_UNSIGNED_SHORT,
+                                graphComm, &req_P2PGraph);
+        break;
+      default:
+        SU2_MPI::Error("Unrecognized data type for point-to-point MPI comms.",
+                       CURRENT_FUNCTION);
+        break;
+    }
+  }
+  return;
+#endif
+  
+  /*--- Start the persistent send of this message (see PostP2PRecvs()). ---*/
+  
+#if !(defined CODI_REVERSE_TYPE || defined CODI_FORWARD_TYPE)
+  if (P2PPersistent) {
+    unsigned short iSet = SetPersistentP2PComms(commType, val_reverse);
+    req_P2PSend[val_iSend] = reqPers_P2PSend[iSet][val_iSend];
+    SU2_MPI::Start(&(req_P2PSend[val_iSend]));
+    return;
+  }
+#endif
+  
   /*--- Post the non-blocking send as soon as the buffer is loaded. ---*/
   
   iMessage = val_iSend;
@@ -754,6 +1096,181 @@ void CGeometry::PostP2PSends(CGeometry *geometry,
   
 }
 
+unsigned short CGeometry::SetPersistentP2PComms_InPlace(su2double *val_data,
+                                                        unsigned short val_nVar) {
+  
+  /*--- One set of requests per destination array, in practice one per solver
+   that exchanges its solution on this grid. ---*/
+  
+  unsigned short iSet;
+  
+  for (iSet = 0; iSet < InPlace_Data.size(); iSet++)
+    if ((InPlace_Data[iSet] == val_data) && (InPlace_nVar[iSet] == val_nVar)) return iSet;
+  
+#if !(defined CODI_REVERSE_TYPE || defined CODI_FORWARD_TYPE)
+  
+  int iRecv, iSend, offset, count, source, dest, tag;
+  
+  SU2_MPI::Request *reqRecv = new SU2_MPI::Request[nP2PRecv];
+  SU2_MPI::Request *reqSend = new SU2_MPI::Request[nP2PSend];
+  
+  for (iRecv = 0; iRecv < nP2PRecv; iRecv++) {
+    
+    offset = val_nVar*Local_Point_P2PRecv[nPoint_P2PRecv[iRecv]];
+    count  = val_nVar*(nPoint_P2PRecv[iRecv+1] - nPoint_P2PRecv[iRecv]);
+    source = Neighbors_P2PRecv[iRecv];
+    tag    = source + 1;
+    
+    SU2_MPI::Recv_init(&(val_data[offset]), count, MPI_DOUBLE,
+                       source, tag, MPI_COMM_WORLD, &(reqRecv[iRecv]));
+  }
+  
+  for (iSend = 0; iSend < nP2PSend; iSend++) {
+    
+    offset = val_nVar*nPoint_P2PSend[iSend];
+    count  = val_nVar*(nPoint_P2PSend[iSend+1] - nPoint_P2PSend[iSend]);
+    dest   = Neighbors_P2PSend[iSend];
+    tag    = rank + 1;
+    
+    SU2_MPI::Send_init(&(bufD_P2PSend[offset]), count, MPI_DOUBLE,
+                       dest, tag, MPI_COMM_WORLD, &(reqSend[iSend]));
+  }
+  
+  InPlace_Data.push_back(val_data);
+  InPlace_nVar.push_back(val_nVar);
+  reqPers_InPlaceRecv.push_back(reqRecv);
+  reqPers_InPlaceSend.push_back(reqSend);
+  
+#endif
+  
+  return iSet;
+  
+}
+
+void CGeometry::PostP2PRecvs_InPlace(su2double *val_data,
+                                     unsigned short val_nVar) {
+  
+  int iRecv, offset, count, source, tag;
+  
+  /*--- The recv of each neighbor goes directly into the rows of its halo
+   points, which start at the first point of the recv list. ---*/
+  
+#ifdef HAVE_NEIGHBOR_COLLECTIVES
+  return;
+#endif
+  
+#if !(defined CODI_REVERSE_TYPE || defined CODI_FORWARD_TYPE)
+  if (P2PPersistent) {
+    unsigned short iSet = SetPersistentP2PComms_InPlace(val_data, val_nVar);
+    for (iRecv = 0; iRecv < nP2PRecv; iRecv++)
+      req_P2PRecv[iRecv] = reqPers_InPlaceRecv[iSet][iRecv];
+    SU2_MPI::Startall(nP2PRecv, req_P2PRecv);
+    return;
+  }
+#endif
+  
+  for (iRecv = 0; iRecv < nP2PRecv; iRecv++) {
+    
+    offset = val_nVar*Local_Point_P2PRecv[nPoint_P2PRecv[iRecv]];
+    count  = val_nVar*(nPoint_P2PRecv[iRecv+1] - nPoint_P2PRecv[iRecv]);
+    source = Neighbors_P2PRecv[iRecv];
+    tag    = source + 1;
+    
+    SU2_MPI::Irecv(&(val_data[offset]), count, MPI_DOUBLE,
+                   source, tag, MPI_COMM_WORLD, &(req_P2PRecv[iRecv]));
+  }
+  
+}
+
+void CGeometry::PostP2PSends_InPlace(su2double *val_data,
+                                     unsigned short val_nVar,
+                                     int val_iSend) {
+  
+  int offset, count, dest, tag;
+  
+  /*--- With the neighborhood collectives the recv displacements of the
+   exchange point to the first halo point of each neighbor in val_data. ---*/
+  
+#ifdef HAVE_NEIGHBOR_COLLECTIVES
+  if (val_iSend == nP2PSend-1) {
+    
+    int iNeighbor;
+    
+    for (iNeighbor = 0; iNeighbor < nP2PSend; iNeighbor++) {
+      P2PGraph_SendCounts[iNeighbor] = val_nVar*(nPoint_P2PSend[iNeighbor+1]-nPoint_P2PSend[iNeighbor]);
+      P2PGraph_SendDispls[iNeighbor] = val_nVar*nPoint_P2PSend[iNeighbor];
+    }
+    for (iNeighbor = 0; iNeighbor < nP2PRecv; iNeighbor++) {
+      P2PGraph_RecvCounts[iNeighbor] = val_nVar*(nPoint_P2PRecv[iNeighbor+1]-nPoint_P2PRecv[iNeighbor]);
+      P2PGraph_RecvDispls[iNeighbor] = val_nVar*Local_Point_P2PRecv[nPoint_P2PRecv[iNeighbor]];
+    }
+    
+    P2PGraph_Sources = Neighbors_P2PRecv;
+    iP2PGraphRecv    = 0;
+    
+    MPI_Ineighbor_alltoallv(bufD_P2PSend, P2PGraph_SendCounts, P2PGraph_SendDispls, MPI_DOUBLE,
+                            val_data, P2PGraph_RecvCounts, P2PGraph_RecvDispls, MPI_DOUBLE,
+                            P2PGraphComm[0], &req_P2PGraph);
+  }
+  return;
+#endif
+  
+#if !(defined CODI_REVERSE_TYPE || defined CODI_FORWARD_TYPE)
+  if (P2PPersistent) {
+    unsigned short iSet = SetPersistentP2PComms_InPlace(val_data, val_nVar);
+    req_P2PSend[val_iSend] = reqPers_InPlaceSend[iSet][val_iSend];
+    SU2_MPI::Start(&(req_P2PSend[val_iSend]));
+    return;
+  }
+#endif
+  
+  /*--- The send buffer is loaded with val_nVar values per point. ---*/
+  
+  offset = val_nVar*nPoint_P2PSend[val_iSend];
+  count  = val_nVar*(nPoint_P2PSend[val_iSend+1] - nPoint_P2PSend[val_iSend]);
+  dest   = Neighbors_P2PSend[val_iSend];
+  tag    = rank + 1;
+  
+  SU2_MPI::Isend(&(bufD_P2PSend[offset]), count, MPI_DOUBLE,
+                 dest, tag, MPI_COMM_WORLD, &(req_P2PSend[val_iSend]));
+  
+}
+
+int CGeometry::WaitAnyP2PRecv(void) {
+  
+#ifdef HAVE_NEIGHBOR_COLLECTIVES
+  
+  /*--- The exchange is a single request, once it is complete the messages
+   are returned in the order of the neighbors. ---*/
+  
+  if (iP2PGraphRecv == 0) SU2_MPI::Wait(&req_P2PGraph, MPI_STATUS_IGNORE);
+  
+  return P2PGraph_Sources[iP2PGraphRecv++];
+  
+#else
+  
+  int ind;
+  SU2_MPI::Status status;
+  
+  SU2_MPI::Waitany(nP2PRecv, req_P2PRecv, &ind, &status);
+  
+  return status.MPI_SOURCE;
+  
+#endif
+  
+}
+
+void CGeometry::WaitAllP2PSends(void) {
+  
+  /*--- With the neighborhood collectives the sends completed with the
+   exchange in WaitAnyP2PRecv(). ---*/
+  
+#ifndef HAVE_NEIGHBOR_COLLECTIVES
+  SU2_MPI::Waitall(nP2PSend, req_P2PSend, MPI_STATUS_IGNORE);
+#endif
+  
+}
+
 void CGeometry::InitiateComms(CGeometry *geometry,
                               CConfig *config,
                               unsigned short commType) {
@@ -899,8 +1416,7 @@ void CGeometry::CompleteComms(CGeometry *geometry,
   unsigned short iDim;
   unsigned long iPoint, iRecv, nRecv, msg_offset, buf_offset;
   
-  int ind, source, iMessage, jRecv;
-  SU2_MPI::Status status;
+  int source, iMessage, jRecv;
   
   /*--- Set some local pointers to make access simpler. ---*/
   
@@ -917,13 +1433,9 @@ void CGeometry::CompleteComms(CGeometry *geometry,
     for (iMessage = 0; iMessage < nP2PRecv; iMessage++) {
       
       /*--- For efficiency, recv the messages dynamically based on
-       the order they arrive. ---*/
-      
-      SU2_MPI::Waitany(nP2PRecv, req_P2PRecv, &ind, &status);
+       the order they arrive, and get the source rank. ---*/
       
-      /*--- Once we have recv'd a message, get the source rank. ---*/
-      
-      source = status.MPI_SOURCE;
+      source = WaitAnyP2PRecv();
       
       /*--- We know the offsets based on the source rank. ---*/
       
@@ -981,9 +1493,7 @@ void CGeometry::CompleteComms(CGeometry *geometry,
      Note that this should be satisfied, as we have received all of the
      data in the loop above at this point. ---*/
     
-#ifdef HAVE_MPI
-    SU2_MPI::Waitall(nP2PSend, req_P2PSend, MPI_STATUS_IGNORE);
-#endif
+    WaitAllP2PSends();
     
   }
   
@@ -1578,57 +2088,226 @@ bool CGeometry::CheckEdge(unsigned long first_point, unsigned long second_point)
 }
 
 void CGeometry::SetEdges(void) {
-  unsigned long iPoint, jPoint;
-  long iEdge;
-  unsigned short jNode, iNode;
-  long TestEdge = 0;
+  unsigned long iPoint, jPoint, iEdge, iBucket;
+  unsigned short iNode, jNode;
+  
+  /*--- An edge belongs to its node with the smallest index, the edges are
+   numbered in the order of these nodes and of their lists of neighbors. The
+   number of edges of the other node (the largest index) is counted to sort
+   the edges by that node. ---*/
+  
+  /*--- The flat edge arrays and the coloring belong to the previous edges. ---*/
+  
+  if (EdgeNodes   != NULL) { delete [] EdgeNodes;   EdgeNodes   = NULL; }
+  if (EdgeNormals != NULL) { delete [] EdgeNormals; EdgeNormals = NULL; }
+  EdgeColorPtr.clear();
+  
+  vector<unsigned long> Bucket_Ptr(nPoint+1, 0);
   
   nEdge = 0;
   for (iPoint = 0; iPoint < nPoint; iPoint++)
     for (iNode = 0; iNode < node[iPoint]->GetnPoint(); iNode++) {
       jPoint = node[iPoint]->GetPoint(iNode);
-      for (jNode = 0; jNode < node[jPoint]->GetnPoint(); jNode++)
-        if (node[jPoint]->GetPoint(jNode) == iPoint) {
-          TestEdge = node[jPoint]->GetEdge(jNode);
-          break;
-        }
-      if (TestEdge == -1) {
-        node[iPoint]->SetEdge(nEdge, iNode);
-        node[jPoint]->SetEdge(nEdge, jNode);
-        nEdge++;
-      }
+      if (jPoint > iPoint) { nEdge++; Bucket_Ptr[jPoint+1]++; }
     }
   
+  for (iPoint = 0; iPoint < nPoint; iPoint++)
+    Bucket_Ptr[iPoint+1] += Bucket_Ptr[iPoint];
+  
   edge = new CEdge*[nEdge];
   
+  /*--- Create the edges at their first node, and store them in the bucket
+   of their second node (counting sort). ---*/
+  
+  vector<unsigned long> Bucket_Point(nEdge), Bucket_Edge(nEdge), Bucket_End(Bucket_Ptr.begin(), Bucket_Ptr.end()-1);
+  
+  iEdge = 0;
   for (iPoint = 0; iPoint < nPoint; iPoint++)
     for (iNode = 0; iNode < node[iPoint]->GetnPoint(); iNode++) {
       jPoint = node[iPoint]->GetPoint(iNode);
-      iEdge = FindEdge(iPoint, jPoint);
-      if (iPoint < jPoint) edge[iEdge] = new CEdge(iPoint, jPoint, nDim);
+      if (jPoint > iPoint) {
+        node[iPoint]->SetEdge(iEdge, iNode);
+        edge[iEdge] = new CEdge(iPoint, jPoint, nDim);
+        iBucket = Bucket_End[jPoint]++;
+        Bucket_Point[iBucket] = iPoint;
+        Bucket_Edge[iBucket]  = iEdge;
+        iEdge++;
+      }
+    }
+  
+  /*--- Set the edges at their second node, the position of the neighbors in
+   its list is marked first (instead of searching the list for each edge). ---*/
+  
+  vector<unsigned long> Mark(nPoint, nPoint);
+  vector<unsigned short> Position(nPoint, 0);
+  
+  for (jPoint = 0; jPoint < nPoint; jPoint++) {
+    for (jNode = 0; jNode < node[jPoint]->GetnPoint(); jNode++) {
+      iPoint = node[jPoint]->GetPoint(jNode);
+      Mark[iPoint] = jPoint;
+      Position[iPoint] = jNode;
+    }
+    for (iBucket = Bucket_Ptr[jPoint]; iBucket < Bucket_Ptr[jPoint+1]; iBucket++) {
+      iPoint = Bucket_Point[iBucket];
+      if (Mark[iPoint] == jPoint) node[jPoint]->SetEdge(Bucket_Edge[iBucket], Position[iPoint]);
     }
+  }
+  
 }
 
-void CGeometry::SetFaces(void) {
-  //	unsigned long iPoint, jPoint, iFace;
-  //	unsigned short jNode, iNode;
-  //	long TestFace = 0;
-  //
-  //	nFace = 0;
-  //	for (iPoint = 0; iPoint < nPoint; iPoint++)
-  //		for (iNode = 0; iNode < node[iPoint]->GetnPoint(); iNode++) {
-  //			jPoint = node[iPoint]->GetPoint(iNode);
-  //			for (jNode = 0; jNode < node[jPoint]->GetnPoint(); jNode++)
-  //				if (node[jPoint]->GetPoint(jNode) == iPoint) {
-  //					TestFace = node[jPoint]->GetFace(jNode);
-  //					break;
-  //				}
-  //			if (TestFace == -1) {
-  //				node[iPoint]->SetFace(nFace, iNode);
-  //				node[jPoint]->SetFace(nFace, jNode);
-  //				nFace++;
-  //			}
-  //		}
+void CGeometry::ReorderEdges(const vector<unsigned long> &Order) {
+
+  unsigned long iEdge, iPoint;
+  unsigned short iNeigh;
+  long kEdge;
+
+  vector<unsigned long> NewIndex(nEdge);
+  CEdge **new_edge = new CEdge*[nEdge];
+
+  for (iEdge = 0; iEdge < nEdge; iEdge++) {
+    new_edge[iEdge] = edge[Order[iEdge]];
+    NewIndex[Order[iEdge]] = iEdge;
+  }
+  delete [] edge;
+  edge = new_edge;
+
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    for (iNeigh = 0; iNeigh < node[iPoint]->GetnPoint(); iNeigh++) {
+      kEdge = node[iPoint]->GetEdge(iNeigh);
+      if (kEdge >= 0) node[iPoint]->SetEdge(NewIndex[kEdge], iNeigh);
+    }
+  }
+
+}
+
+/*--- Comparison of two edges by their nodes, used to sort the edge list. ---*/
+
+struct CEdgeNodeOrder {
+  CEdge **edge;
+  CEdgeNodeOrder(CEdge **val_edge) : edge(val_edge) {}
+  bool operator()(unsigned long iEdge, unsigned long jEdge) const {
+    if (edge[iEdge]->GetNode(0) != edge[jEdge]->GetNode(0))
+      return edge[iEdge]->GetNode(0) < edge[jEdge]->GetNode(0);
+    return edge[iEdge]->GetNode(1) < edge[jEdge]->GetNode(1);
+  }
+};
+
+void CGeometry::SetEdgeColoring(CConfig *config) {
+
+  unsigned long iEdge, kEdge, iPoint, iGroup, nGroup, iColor, nColor = 0;
+  unsigned short iNode, iNeigh;
+  long Color;
+
+  EdgeColorPtr.clear();
+
+  if (omp_get_max_threads() == 1) {
+
+    /*--- A single color with a single group, the edges are not renumbered
+     so that the sums over edges are done in the same order as before. ---*/
+
+    EdgeColorPtr.push_back(0);
+    EdgeColorPtr.push_back(nEdge);
+    EdgeColorGroupSize = max(nEdge, (unsigned long)(1));
+
+  }
+  else {
+
+    /*--- Sort the edges by their first and second node. Sorting the colored
+     edges of a previous call gives the same order, hence calling this again
+     reproduces the same numbering. ---*/
+
+    vector<unsigned long> Order(nEdge);
+    for (iEdge = 0; iEdge < nEdge; iEdge++) Order[iEdge] = iEdge;
+    sort(Order.begin(), Order.end(), CEdgeNodeOrder(edge));
+    ReorderEdges(Order);
+
+    EdgeColorGroupSize = max(config->GetEdge_Coloring_Group_Size(), (unsigned long)(1));
+    nGroup = (nEdge + EdgeColorGroupSize - 1) / EdgeColorGroupSize;
+
+    /*--- Greedy coloring of the groups, each group takes the smallest color
+     that is not used by the groups connected to any of its points. ---*/
+
+    vector<long> GroupColor(nGroup, -1);
+    vector<bool> ColorUsed;
+
+    for (iGroup = 0; iGroup < nGroup; iGroup++) {
+
+      ColorUsed.assign(nColor+1, false);
+
+      for (iEdge = iGroup*EdgeColorGroupSize; iEdge < min((iGroup+1)*EdgeColorGroupSize, nEdge); iEdge++) {
+        for (iNode = 0; iNode < 2; iNode++) {
+          iPoint = edge[iEdge]->GetNode(iNode);
+          for (iNeigh = 0; iNeigh < node[iPoint]->GetnPoint(); iNeigh++) {
+            kEdge = node[iPoint]->GetEdge(iNeigh);
+            Color = GroupColor[kEdge/EdgeColorGroupSize];
+            if (Color >= 0) ColorUsed[Color] = true;
+          }
+        }
+      }
+
+      for (Color = 0; ColorUsed[Color]; Color++) {}
+      GroupColor[iGroup] = Color;
+      nColor = max(nColor, (unsigned long)(Color+1));
+
+    }
+
+    /*--- Renumber the edges such that the groups of a color are contiguous,
+     keeping the relative order of the groups. The only incomplete group is
+     the last one, it is also the last of its color, hence the groups stay
+     aligned with chunks of EdgeColorGroupSize edges from the start of a color. ---*/
+
+    EdgeColorPtr.assign(nColor+1, 0);
+    Order.clear();
+
+    for (iColor = 0; iColor < nColor; iColor++) {
+      for (iGroup = 0; iGroup < nGroup; iGroup++) {
+        if (GroupColor[iGroup] != (long)iColor) continue;
+        for (iEdge = iGroup*EdgeColorGroupSize; iEdge < min((iGroup+1)*EdgeColorGroupSize, nEdge); iEdge++)
+          Order.push_back(iEdge);
+      }
+      EdgeColorPtr[iColor+1] = Order.size();
+    }
+    ReorderEdges(Order);
+
+  }
+
+  /*--- Move the nodes and normals of the edges to flat arrays in the final order,
+   the arrays of a previous call are released once their values are copied. ---*/
+
+  unsigned long *OldEdgeNodes = EdgeNodes;
+  su2double *OldEdgeNormals = EdgeNormals;
+
+  EdgeNodes   = new unsigned long [2*nEdge];
+  EdgeNormals = new su2double [nDim*nEdge];
+
+  for (iEdge = 0; iEdge < nEdge; iEdge++)
+    edge[iEdge]->SetExternalStorage(&EdgeNodes[2*iEdge], &EdgeNormals[nDim*iEdge]);
+
+  if (OldEdgeNodes   != NULL) delete [] OldEdgeNodes;
+  if (OldEdgeNormals != NULL) delete [] OldEdgeNormals;
+
+}
+
+void CGeometry::SetFaces(void) {
+  //	unsigned long iPoint, jPoint, iFace;
+  //	unsigned short jNode, iNode;
+  //	long TestFace = 0;
+  //
+  //	nFace = 0;
+  //	for (iPoint = 0; iPoint < nPoint; iPoint++)
+  //		for (iNode = 0; iNode < node[iPoint]->GetnPoint(); iNode++) {
+  //			jPoint = node[iPoint]->GetPoint(iNode);
+  //			for (jNode = 0; jNode < node[jPoint]->GetnPoint(); jNode++)
+  //				if (node[jPoint]->GetPoint(jNode) == iPoint) {
+  //					TestFace = node[jPoint]->GetFace(jNode);
+  //					break;
+  //				}
+  //			if (TestFace == -1) {
+  //				node[iPoint]->SetFace(nFace, iNode);
+  //				node[jPoint]->SetFace(nFace, jNode);
+  //				nFace++;
+  //			}
+  //		}
   //
   //	face = new CFace*[nFace];
   //
@@ -3682,6 +4361,9 @@ CPhysicalGeometry::CPhysicalGeometry(CConfig *config, unsigned short val_iZone,
       case CGNS:
         Read_CGNS_Format_Parallel(config, val_mesh_filename, val_iZone, val_nZone);
         break;
+      case SU2_BINARY:
+        Read_SU2_Binary_Format_Parallel(config, val_mesh_filename, val_iZone, val_nZone);
+        break;
       default:
         SU2_MPI::Error("Unrecognized mesh format specified!", CURRENT_FUNCTION);
         break;
@@ -5868,6 +6550,24 @@ void CPhysicalGeometry::LoadPoints(CConfig *config, CGeometry *geometry) {
   iPeriodic = nLocal_PointDomain;
   iGhost    = nLocal_PointDomain + nLocal_PointPeriodic;
 
+  /*--- The ghost points are numbered by the rank that owns them and then by
+   their global index, which is the order of the recv lists of SetSendReceive().
+   The halo of each neighbor rank is then a contiguous range of the local
+   numbering, and the solution can be received in place (see
+   CGeometry::PostP2PRecvs_InPlace()). ---*/
+
+  vector<pair<pair<unsigned long, unsigned long>, unsigned long> > Ghost_Order;
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    if (Local_Colors[iPoint] != (unsigned long)rank)
+      Ghost_Order.push_back(make_pair(make_pair(Local_Colors[iPoint],
+                                                Local_Points[iPoint]), iPoint));
+  }
+  sort(Ghost_Order.begin(), Ghost_Order.end());
+
+  vector<unsigned long> Ghost_Local(nPoint, 0);
+  for (jPoint = 0; jPoint < Ghost_Order.size(); jPoint++)
+    Ghost_Local[Ghost_Order[jPoint].second] = iGhost + jPoint;
+
   /*--- Loop over all of the points that we have recv'd and store the
    coordinates, global index, and colors ---*/
 
@@ -5880,7 +6580,7 @@ void CPhysicalGeometry::LoadPoints(CConfig *config, CGeometry *geometry) {
         jPoint = iOwned;
       else jPoint = iPeriodic;
     } else {
-      jPoint = iGhost;
+      jPoint = Ghost_Local[iPoint];
     }
 
     /*--- Get the global index ---*/
@@ -5909,8 +6609,6 @@ void CPhysicalGeometry::LoadPoints(CConfig *config, CGeometry *geometry) {
       if (Local_Points[iPoint] < geometry->GetGlobal_nPointDomain())
         iOwned++;
       else iPeriodic++;
-    } else {
-      iGhost++;
     }
   }
 
@@ -9259,6 +9957,687 @@ void CPhysicalGeometry::Read_SU2_Format_Parallel(CConfig *config, string val_mes
   
 }
 
+#ifdef HAVE_MPI
+typedef MPI_File SU2_MeshBinaryFile;
+#else
+typedef FILE* SU2_MeshBinaryFile;
+#endif
+
+/*!
+ * \brief Read a block of bytes at a given offset of an SU2_BINARY mesh file (independent
+ *        MPI I/O in parallel), large blocks are read in chunks to keep the counts in range.
+ */
+static void ReadMeshBinary(SU2_MeshBinaryFile fhw, unsigned long long disp, void *buf, unsigned long long nBytes) {
+
+  const unsigned long long MaxChunk = 1ULL<<30;
+  char *cbuf = static_cast<char*>(buf);
+  bool success = true;
+
+  for (unsigned long long offset = 0; offset < nBytes; offset += MaxChunk) {
+    int count = int(min(MaxChunk, nBytes-offset));
+#ifdef HAVE_MPI
+    MPI_Status status;
+    int nRead = 0;
+    if (MPI_File_read_at(fhw, MPI_Offset(disp+offset), cbuf+offset, count, MPI_BYTE, &status) != MPI_SUCCESS) success = false;
+    else { MPI_Get_count(&status, MPI_BYTE, &nRead); success = success && (nRead == count); }
+#else
+    if (fseek(fhw, long(disp+offset), SEEK_SET) != 0) success = false;
+    else success = success && (fread(cbuf+offset, 1, count, fhw) == (size_t)count);
+#endif
+  }
+
+  if (!success) SU2_MPI::Error("Error reading the SU2 binary mesh file.", CURRENT_FUNCTION);
+}
+
+void CPhysicalGeometry::Read_SU2_Binary_Format_Parallel(CConfig *config, string val_mesh_filename, unsigned short val_iZone, unsigned short val_nZone) {
+
+  string Marker_Tag;
+  unsigned short nMarker_Max = config->GetnMarker_Max();
+  unsigned short iDim, iNode, jNode, nNodes, nDest;
+  unsigned long iPoint, iElem, iElem_Bound, iMarker, GlobalIndex, VTK_Type, i;
+  unsigned long vnodes[N_POINTS_HEXAHEDRON];
+  int iRank, DestRank[N_POINTS_HEXAHEDRON];
+  long local_index;
+  su2double Coord[3], AoA_Offset, AoS_Offset, AoA_Current, AoS_Current;
+  bool multizone_file = config->GetMultizone_Mesh();
+  bool actuator_disk  = (((config->GetnMarker_ActDiskInlet() != 0) ||
+                          (config->GetnMarker_ActDiskOutlet() != 0)) &&
+                         ((config->GetKind_SU2() == SU2_CFD) ||
+                          ((config->GetKind_SU2() == SU2_DEF) && (config->GetActDisk_SU2_DEF()))));
+  if (config->GetActDisk_DoubleSurface()) actuator_disk = false;
+
+  nZone = val_nZone;
+
+  if (actuator_disk)
+    SU2_MPI::Error("The actuator disk surface splitting is not available for SU2_BINARY meshes.", CURRENT_FUNCTION);
+  if ((val_nZone > 1) && multizone_file)
+    SU2_MPI::Error("SU2_BINARY mesh files contain a single zone.", CURRENT_FUNCTION);
+
+  Global_nPoint  = 0; Global_nPointDomain   = 0; Global_nElem = 0; Global_nElemDomain = 0;
+  nelem_edge     = 0; Global_nelem_edge     = 0;
+  nelem_triangle = 0; Global_nelem_triangle = 0;
+  nelem_quad     = 0; Global_nelem_quad     = 0;
+  nelem_tetra    = 0; Global_nelem_tetra    = 0;
+  nelem_hexa     = 0; Global_nelem_hexa     = 0;
+  nelem_prism    = 0; Global_nelem_prism    = 0;
+  nelem_pyramid  = 0; Global_nelem_pyramid  = 0;
+
+  /*--- All ranks open the file, MPI I/O in parallel. ---*/
+
+  SU2_MeshBinaryFile fhw;
+#ifdef HAVE_MPI
+  char fname[MAX_STRING_SIZE];
+  strcpy(fname, val_mesh_filename.c_str());
+  if (MPI_File_open(MPI_COMM_WORLD, fname, MPI_MODE_RDONLY, MPI_INFO_NULL, &fhw))
+    SU2_MPI::Error(string("Unable to open SU2 binary mesh file ") + val_mesh_filename, CURRENT_FUNCTION);
+#else
+  fhw = fopen(val_mesh_filename.c_str(), "rb");
+  if (!fhw)
+    SU2_MPI::Error(string("Unable to open SU2 binary mesh file ") + val_mesh_filename, CURRENT_FUNCTION);
+#endif
+
+  /*--- The master reads the header and broadcasts it. ---*/
+
+  long long Mesh_Vars[MESH_BIN_NVARS], File_Size = 0;
+  passivedouble Mesh_Offsets[2];
+
+  if (rank == MASTER_NODE) {
+#ifdef HAVE_MPI
+    MPI_Offset file_size;
+    MPI_File_get_size(fhw, &file_size);
+    File_Size = file_size;
+#else
+    fseek(fhw, 0, SEEK_END);
+    File_Size = ftell(fhw);
+#endif
+    if (File_Size < (long long)(sizeof(Mesh_Vars)+sizeof(Mesh_Offsets)))
+      SU2_MPI::Error(string("File ") + val_mesh_filename + string(" is not an SU2 binary mesh file."), CURRENT_FUNCTION);
+    ReadMeshBinary(fhw, 0, Mesh_Vars, sizeof(Mesh_Vars));
+    ReadMeshBinary(fhw, sizeof(Mesh_Vars), Mesh_Offsets, sizeof(Mesh_Offsets));
+  }
+#ifdef HAVE_MPI
+  SU2_MPI::Bcast(Mesh_Vars, sizeof(Mesh_Vars), MPI_CHAR, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Bcast(Mesh_Offsets, sizeof(Mesh_Offsets), MPI_CHAR, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Bcast(&File_Size, sizeof(long long), MPI_CHAR, MASTER_NODE, MPI_COMM_WORLD);
+#endif
+
+  if (Mesh_Vars[MESH_BIN_MAGIC] != MESH_BIN_FORMAT_ID)
+    SU2_MPI::Error(string("File ") + val_mesh_filename + string(" is not an SU2 binary mesh file."), CURRENT_FUNCTION);
+  if (Mesh_Vars[MESH_BIN_VERSION] != MESH_BIN_FORMAT_VERSION)
+    SU2_MPI::Error(string("Unsupported version of the SU2 binary mesh file ") + val_mesh_filename, CURRENT_FUNCTION);
+
+  /*--- Check the sizes of the header against the size of the file before they
+   are used to compute offsets or to allocate anything. Each count is first
+   bounded by the number of 8 byte words of the file, so that the sums of the
+   sizes of the sections below cannot overflow. ---*/
+
+  const long long nWords = File_Size/8;
+  if ((Mesh_Vars[MESH_BIN_NDIM] != 2) && (Mesh_Vars[MESH_BIN_NDIM] != 3))
+    SU2_MPI::Error("Wrong number of dimensions in the SU2 binary mesh file.", CURRENT_FUNCTION);
+  if ((Mesh_Vars[MESH_BIN_NPOINT] < 0) || (Mesh_Vars[MESH_BIN_NPOINT] > nWords) ||
+      (Mesh_Vars[MESH_BIN_NPOINTDOMAIN] < 0) || (Mesh_Vars[MESH_BIN_NPOINTDOMAIN] > Mesh_Vars[MESH_BIN_NPOINT]) ||
+      (Mesh_Vars[MESH_BIN_NELEM] < 0) || (Mesh_Vars[MESH_BIN_NELEM] > nWords) ||
+      (Mesh_Vars[MESH_BIN_NELEMCONN] < 0) || (Mesh_Vars[MESH_BIN_NELEMCONN] > nWords) ||
+      (Mesh_Vars[MESH_BIN_NMARKER] < 0) || (Mesh_Vars[MESH_BIN_NMARKER] > nMarker_Max))
+    SU2_MPI::Error("Wrong sizes in the header of the SU2 binary mesh file.", CURRENT_FUNCTION);
+
+  nDim = Mesh_Vars[MESH_BIN_NDIM];
+  if (rank == MASTER_NODE) {
+    if (nDim == 2) cout << "Two dimensional problem." << endl;
+    if (nDim == 3) cout << "Three dimensional problem." << endl;
+  }
+
+  /*--- Offsets of the sections of the file (in bytes). ---*/
+
+  const unsigned long long disp_coord = sizeof(Mesh_Vars) + sizeof(Mesh_Offsets);
+  const unsigned long long disp_elem_ptr = disp_coord + Mesh_Vars[MESH_BIN_NPOINT]*nDim*sizeof(passivedouble);
+  const unsigned long long disp_elem_conn = disp_elem_ptr + (Mesh_Vars[MESH_BIN_NELEM]+1)*sizeof(long long);
+  const unsigned long long disp_marker = disp_elem_conn + Mesh_Vars[MESH_BIN_NELEMCONN]*sizeof(long long);
+
+  if (disp_marker > (unsigned long long)File_Size)
+    SU2_MPI::Error("The SU2 binary mesh file is truncated.", CURRENT_FUNCTION);
+
+  /*--- Angle of attack and sideslip offsets, as for the ASCII format (in deg). ---*/
+
+  AoA_Offset = Mesh_Offsets[0];
+  AoS_Offset = Mesh_Offsets[1];
+
+  if (config->GetDiscard_InFiles() == false) {
+    AoA_Current = config->GetAoA() + AoA_Offset;
+    AoS_Current = config->GetAoS() + AoS_Offset;
+    if ((rank == MASTER_NODE) && (AoA_Offset != 0.0))  {
+      cout.precision(6);
+      cout << fixed <<"WARNING: AoA in the config file (" << config->GetAoA() << " deg.) +" << endl;
+      cout << "         AoA offset in mesh file (" << AoA_Offset << " deg.) = " << AoA_Current << " deg." << endl;
+    }
+    if ((rank == MASTER_NODE) && (AoS_Offset != 0.0))  {
+      cout.precision(6);
+      cout << fixed <<"WARNING: AoS in the config file (" << config->GetAoS() << " deg.) +" << endl;
+      cout << "         AoS offset in mesh file (" << AoS_Offset << " deg.) = " << AoS_Current << " deg." << endl;
+    }
+    config->SetAoA_Offset(AoA_Offset); config->SetAoA(AoA_Current);
+    config->SetAoS_Offset(AoS_Offset); config->SetAoS(AoS_Current);
+  }
+  else if (rank == MASTER_NODE) {
+    if (AoA_Offset != 0.0) cout <<"WARNING: Discarding the AoA offset in the geometry file." << endl;
+    if (AoS_Offset != 0.0) cout <<"WARNING: Discarding the AoS offset in the geometry file." << endl;
+  }
+
+  /*--- Number of points and linear partitioning, as for the ASCII format. ---*/
+
+  Global_nPoint = Mesh_Vars[MESH_BIN_NPOINT];
+  Global_nPointDomain = Mesh_Vars[MESH_BIN_NPOINTDOMAIN];
+  nPointDomain = Global_nPointDomain;
+
+  if (rank == MASTER_NODE) {
+    cout << Global_nPointDomain << " points and " << Global_nPoint-Global_nPointDomain;
+    if (size > SINGLE_NODE) cout << " ghost points before parallel partitioning." << endl;
+    else cout << " ghost points." << endl;
+  }
+
+  if ((rank == MASTER_NODE) && (size > SINGLE_NODE))
+    cout << "Performing linear partitioning of the grid nodes." << endl;
+
+  starting_node = new unsigned long[size];
+  ending_node   = new unsigned long[size];
+  npoint_procs  = new unsigned long[size];
+  nPoint_Linear = new unsigned long[size+1];
+
+  for (i = 0; i < (unsigned long)size; i++)
+    npoint_procs[i] = Global_nPoint/size + ((i < Global_nPoint%size)? 1 : 0);
+
+  starting_node[0] = 0;
+  ending_node[0]   = npoint_procs[0];
+  nPoint_Linear[0] = 0;
+  for (i = 1; i < (unsigned long)size; i++) {
+    starting_node[i] = ending_node[i-1];
+    ending_node[i]   = starting_node[i] + npoint_procs[i];
+    nPoint_Linear[i] = nPoint_Linear[i-1] + npoint_procs[i-1];
+  }
+  nPoint_Linear[size] = Global_nPoint;
+
+  /*--- Each rank reads the coordinates of its linear partition. ---*/
+
+  nPoint = npoint_procs[rank];
+  nPointNode = nPoint;
+  node = new CPoint*[nPoint];
+
+  vector<passivedouble> CoordBuffer(nPoint*nDim);
+  if (nPoint > 0)
+    ReadMeshBinary(fhw, disp_coord + starting_node[rank]*nDim*sizeof(passivedouble),
+                   &CoordBuffer[0], nPoint*nDim*sizeof(passivedouble));
+
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    GlobalIndex = starting_node[rank] + iPoint;
+    for (iDim = 0; iDim < nDim; iDim++) Coord[iDim] = CoordBuffer[iPoint*nDim+iDim];
+    if (nDim == 2) node[iPoint] = new CPoint(Coord[0], Coord[1], GlobalIndex, config);
+    else           node[iPoint] = new CPoint(Coord[0], Coord[1], Coord[2], GlobalIndex, config);
+  }
+  CoordBuffer.clear();
+
+  /*--- Each rank reads a linear partition of the elements (offsets first, then
+   the connectivity), instead of scanning the whole list of elements. ---*/
+
+  Global_nElem = Mesh_Vars[MESH_BIN_NELEM];
+  Global_nElemDomain = Global_nElem;
+  if ((rank == MASTER_NODE) && (size > SINGLE_NODE))
+    cout << Global_nElem << " interior elements before parallel partitioning." << endl;
+
+  unsigned long elem_begin = (Global_nElem/size)*rank + min<unsigned long>(rank, Global_nElem%size);
+  unsigned long nElem_Read = Global_nElem/size + ((rank < (int)(Global_nElem%size))? 1 : 0);
+
+  vector<long long> ElemOffset(nElem_Read+1);
+  ReadMeshBinary(fhw, disp_elem_ptr + elem_begin*sizeof(long long), &ElemOffset[0], (nElem_Read+1)*sizeof(long long));
+
+  /*--- The offsets must be increasing and within the connectivity section,
+   the length of each element is checked against its type below. ---*/
+
+  if ((ElemOffset[0] < 0) || (ElemOffset[nElem_Read] > Mesh_Vars[MESH_BIN_NELEMCONN]))
+    SU2_MPI::Error("Element offsets out of range in the SU2 binary mesh file.", CURRENT_FUNCTION);
+  for (iElem = 0; iElem < nElem_Read; iElem++)
+    if (ElemOffset[iElem+1] <= ElemOffset[iElem])
+      SU2_MPI::Error("Element offsets are not increasing in the SU2 binary mesh file.", CURRENT_FUNCTION);
+
+  vector<long long> ElemConn(ElemOffset[nElem_Read]-ElemOffset[0]);
+  if (!ElemConn.empty())
+    ReadMeshBinary(fhw, disp_elem_conn + ElemOffset[0]*sizeof(long long), &ElemConn[0], ElemConn.size()*sizeof(long long));
+
+  /*--- Send each element (global index, type and nodes) to every rank that owns
+   one of its nodes, the same elements that the ASCII reader keeps on each rank. ---*/
+
+  vector<vector<unsigned long> > SendElem(size);
+
+  for (iElem = 0; iElem < nElem_Read; iElem++) {
+
+    const long long *conn = &ElemConn[ElemOffset[iElem]-ElemOffset[0]];
+    VTK_Type = conn[0];
+
+    switch (VTK_Type) {
+      case TRIANGLE:      nNodes = N_POINTS_TRIANGLE;      break;
+      case QUADRILATERAL: nNodes = N_POINTS_QUADRILATERAL; break;
+      case TETRAHEDRON:   nNodes = N_POINTS_TETRAHEDRON;   break;
+      case HEXAHEDRON:    nNodes = N_POINTS_HEXAHEDRON;    break;
+      case PRISM:         nNodes = N_POINTS_PRISM;         break;
+      case PYRAMID:       nNodes = N_POINTS_PYRAMID;       break;
+      default:
+        SU2_MPI::Error("Unknown element type in the SU2 binary mesh file.", CURRENT_FUNCTION);
+        nNodes = 0;
+    }
+
+    if (ElemOffset[iElem+1]-ElemOffset[iElem] != 1+nNodes)
+      SU2_MPI::Error("Wrong length of an element in the SU2 binary mesh file.", CURRENT_FUNCTION);
+
+    nDest = 0;
+    for (iNode = 0; iNode < nNodes; iNode++) {
+      if ((unsigned long)conn[iNode+1] >= Global_nPoint)
+        SU2_MPI::Error("Node index out of range in the SU2 binary mesh file.", CURRENT_FUNCTION);
+      iRank = int(upper_bound(ending_node, ending_node+size, (unsigned long)conn[iNode+1]) - ending_node);
+      for (jNode = 0; jNode < nDest; jNode++)
+        if (DestRank[jNode] == iRank) break;
+      if (jNode == nDest) DestRank[nDest++] = iRank;
+    }
+
+    for (jNode = 0; jNode < nDest; jNode++) {
+      vector<unsigned long> & buf = SendElem[DestRank[jNode]];
+      buf.push_back(elem_begin+iElem);
+      buf.push_back(VTK_Type);
+      for (iNode = 0; iNode < nNodes; iNode++) buf.push_back(conn[iNode+1]);
+    }
+  }
+
+  ElemOffset.clear();
+  ElemConn.clear();
+
+  vector<unsigned long> RecvElem;
+
+#ifdef HAVE_MPI
+
+  /*--- The counts and displacements of Alltoallv are int, check that the
+   buffers of this rank stay below INT_MAX entries before the exchange. ---*/
+
+  vector<int> nSend(size), nRecv(size), SendDispl(size+1, 0), RecvDispl(size+1, 0);
+  for (iRank = 0; iRank < size; iRank++) {
+    if (SendElem[iRank].size() > (unsigned long)(INT_MAX - SendDispl[iRank]))
+      SU2_MPI::Error("Too many elements to distribute from one rank, use more ranks to read this mesh.", CURRENT_FUNCTION);
+    nSend[iRank] = SendElem[iRank].size();
+    SendDispl[iRank+1] = SendDispl[iRank] + nSend[iRank];
+  }
+
+  SU2_MPI::Alltoall(&nSend[0], 1, MPI_INT, &nRecv[0], 1, MPI_INT, MPI_COMM_WORLD);
+
+  for (iRank = 0; iRank < size; iRank++) {
+    if (nRecv[iRank] > INT_MAX - RecvDispl[iRank])
+      SU2_MPI::Error("Too many elements to distribute to one rank, use more ranks to read this mesh.", CURRENT_FUNCTION);
+    RecvDispl[iRank+1] = RecvDispl[iRank] + nRecv[iRank];
+  }
+
+  vector<unsigned long> SendBuffer(SendDispl[size]+1);
+  for (iRank = 0; iRank < size; iRank++) {
+    copy(SendElem[iRank].begin(), SendElem[iRank].end(), SendBuffer.begin()+SendDispl[iRank]);
+    SendElem[iRank].clear();
+  }
+
+  RecvElem.resize(RecvDispl[size]+1);
+  SU2_MPI::Alltoallv(&SendBuffer[0], &nSend[0], &SendDispl[0], MPI_UNSIGNED_LONG,
+                     &RecvElem[0], &nRecv[0], &RecvDispl[0], MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+  RecvElem.resize(RecvDispl[size]);
+
+#else
+  RecvElem.swap(SendElem[MASTER_NODE]);
+#endif
+
+  /*--- The chunks of elements are ordered by rank, hence the received elements are
+   sorted by global index. Count them, then store them and build the adjacency. ---*/
+
+  nElem = 0;
+  for (i = 0; i < RecvElem.size(); i += 2+nNodes) {
+    switch (RecvElem[i+1]) {
+      case TRIANGLE:      nNodes = N_POINTS_TRIANGLE;      break;
+      case QUADRILATERAL: nNodes = N_POINTS_QUADRILATERAL; break;
+      case TETRAHEDRON:   nNodes = N_POINTS_TETRAHEDRON;   break;
+      case HEXAHEDRON:    nNodes = N_POINTS_HEXAHEDRON;    break;
+      case PRISM:         nNodes = N_POINTS_PRISM;         break;
+      default:            nNodes = N_POINTS_PYRAMID;       break;
+    }
+    nElem++;
+  }
+
+  if ((rank == MASTER_NODE) && (size > SINGLE_NODE))
+    cout << "Distributing elements across all ranks." << endl;
+
+  elem = new CPrimalGrid*[nElem];
+  Global_to_Local_Elem.clear();
+
+#ifdef HAVE_MPI
+#ifdef HAVE_PARMETIS
+  vector< vector<unsigned long> > adj_nodes(nPoint, vector<unsigned long>(0));
+#endif
+#endif
+
+  iElem = 0;
+  for (i = 0; i < RecvElem.size(); i += 2+nNodes) {
+
+    GlobalIndex = RecvElem[i];
+    VTK_Type = RecvElem[i+1];
+    const unsigned long *conn = &RecvElem[i+2];
+
+    switch (VTK_Type) {
+      case TRIANGLE:
+        nNodes = N_POINTS_TRIANGLE;
+        elem[iElem] = new CTriangle(conn[0], conn[1], conn[2], 2);
+        nelem_triangle++; break;
+      case QUADRILATERAL:
+        nNodes = N_POINTS_QUADRILATERAL;
+        elem[iElem] = new CQuadrilateral(conn[0], conn[1], conn[2], conn[3], 2);
+        nelem_quad++; break;
+      case TETRAHEDRON:
+        nNodes = N_POINTS_TETRAHEDRON;
+        elem[iElem] = new CTetrahedron(conn[0], conn[1], conn[2], conn[3]);
+        nelem_tetra++; break;
+      case HEXAHEDRON:
+        nNodes = N_POINTS_HEXAHEDRON;
+        elem[iElem] = new CHexahedron(conn[0], conn[1], conn[2], conn[3], conn[4], conn[5], conn[6], conn[7]);
+        nelem_hexa++; break;
+      case PRISM:
+        nNodes = N_POINTS_PRISM;
+        elem[iElem] = new CPrism(conn[0], conn[1], conn[2], conn[3], conn[4], conn[5]);
+        nelem_prism++; break;
+      default:
+        nNodes = N_POINTS_PYRAMID;
+        elem[iElem] = new CPyramid(conn[0], conn[1], conn[2], conn[3], conn[4]);
+        nelem_pyramid++; break;
+    }
+    Global_to_Local_Elem[GlobalIndex] = iElem;
+
+#ifdef HAVE_MPI
+#ifdef HAVE_PARMETIS
+    /*--- Build adjacency assuming the VTK connectivity ---*/
+    for (iNode = 0; iNode < nNodes; iNode++) {
+      local_index = conn[iNode]-starting_node[rank];
+      if ((local_index >= 0) && (local_index < (long)nPoint)) {
+        for (jNode = 0; jNode < nNodes; jNode++)
+          if (iNode != jNode) adj_nodes[local_index].push_back(conn[jNode]);
+      }
+    }
+#endif
+#endif
+
+    iElem++;
+  }
+
+  RecvElem.clear();
+
+#ifdef HAVE_MPI
+#ifdef HAVE_PARMETIS
+
+  if ((rank == MASTER_NODE) && (size > SINGLE_NODE))
+    cout << "Building the graph adjacency structure." << endl;
+
+  /*--- Sort the adjacency of each node and remove the repeated entries, then
+   store it in the compressed format expected by ParMETIS. ---*/
+
+  vector<unsigned long> adjac_vec;
+  vector<unsigned long>::iterator it;
+
+  xadj = new idx_t [npoint_procs[rank]+1];
+  xadj[0] = 0;
+
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    sort(adj_nodes[iPoint].begin(), adj_nodes[iPoint].end());
+    it = unique(adj_nodes[iPoint].begin(), adj_nodes[iPoint].end());
+    xadj[iPoint+1] = xadj[iPoint] + (it - adj_nodes[iPoint].begin());
+    adjac_vec.insert(adjac_vec.end(), adj_nodes[iPoint].begin(), it);
+    vector<unsigned long>().swap(adj_nodes[iPoint]);
+  }
+
+  adjacency = new idx_t [xadj[npoint_procs[rank]]];
+  copy(adjac_vec.begin(), adjac_vec.end(), adjacency);
+
+  xadj_size = npoint_procs[rank]+1;
+  adjacency_size = xadj[npoint_procs[rank]];
+
+#endif
+#endif
+
+  /*--- The markers are small compared with the volume, the master reads them and
+   broadcasts them, every rank keeps all the boundary elements (as for ASCII). ---*/
+
+  long long nBytes_Marker = File_Size - (long long)disp_marker;
+
+  if (nBytes_Marker > INT_MAX)
+    SU2_MPI::Error("Wrong size of the marker section of the SU2 binary mesh file.", CURRENT_FUNCTION);
+
+  vector<char> MarkerBuffer(nBytes_Marker+1);
+  if ((rank == MASTER_NODE) && (nBytes_Marker > 0))
+    ReadMeshBinary(fhw, disp_marker, &MarkerBuffer[0], nBytes_Marker);
+#ifdef HAVE_MPI
+  SU2_MPI::Bcast(&MarkerBuffer[0], int(nBytes_Marker), MPI_CHAR, MASTER_NODE, MPI_COMM_WORLD);
+#endif
+
+#ifdef HAVE_MPI
+  MPI_File_close(&fhw);
+#else
+  fclose(fhw);
+#endif
+
+  nMarker = Mesh_Vars[MESH_BIN_NMARKER];
+  if (rank == MASTER_NODE) cout << nMarker << " surface markers." << endl;
+  config->SetnMarker_All(nMarker);
+  bound = new CPrimalGrid**[nMarker];
+  nElem_Bound = new unsigned long [nMarker];
+  Tag_to_Marker = new string [nMarker_Max];
+
+  PrintingToolbox::CTablePrinter BoundaryTable(&std::cout);
+  BoundaryTable.AddColumn("Index", 6);
+  BoundaryTable.AddColumn("Marker", 35);
+  BoundaryTable.AddColumn("Elements", 14);
+  if (rank == MASTER_NODE) BoundaryTable.PrintHeader();
+
+  /*--- Every size read from the file is checked against the bytes left in the
+   buffer before it is used to copy anything out of it. ---*/
+
+  const unsigned long nBytes = nBytes_Marker;
+  unsigned long pos = 0;
+  for (iMarker = 0; iMarker < nMarker; iMarker++) {
+
+    /*--- Tag length, number of elements and length of the connectivity. ---*/
+
+    long long Marker_Vars[3];
+    if (sizeof(Marker_Vars) > nBytes-pos)
+      SU2_MPI::Error("The marker section of the SU2 binary mesh file is truncated.", CURRENT_FUNCTION);
+    memcpy(Marker_Vars, &MarkerBuffer[pos], sizeof(Marker_Vars)); pos += sizeof(Marker_Vars);
+
+    if ((Marker_Vars[0] < 0) || (Marker_Vars[1] < 0) || (Marker_Vars[2] < 0) ||
+        (Marker_Vars[1] > Marker_Vars[2]))
+      SU2_MPI::Error("Wrong marker sizes in the SU2 binary mesh file.", CURRENT_FUNCTION);
+
+    if ((unsigned long)Marker_Vars[0] > nBytes-pos)
+      SU2_MPI::Error("The marker section of the SU2 binary mesh file is truncated.", CURRENT_FUNCTION);
+    Marker_Tag.assign(&MarkerBuffer[pos], Marker_Vars[0]); pos += Marker_Vars[0];
+
+    if ((unsigned long)Marker_Vars[2] > (nBytes-pos)/sizeof(long long))
+      SU2_MPI::Error("The marker section of the SU2 binary mesh file is truncated.", CURRENT_FUNCTION);
+    vector<long long> BoundConn(Marker_Vars[2]+1);
+    memcpy(&BoundConn[0], &MarkerBuffer[pos], Marker_Vars[2]*sizeof(long long)); pos += Marker_Vars[2]*sizeof(long long);
+
+    nElem_Bound[iMarker] = Marker_Vars[1];
+    bound[iMarker] = new CPrimalGrid* [nElem_Bound[iMarker]];
+
+    if (rank == MASTER_NODE) BoundaryTable << iMarker << Marker_Tag << nElem_Bound[iMarker];
+
+    unsigned long iConn = 0, nConn = Marker_Vars[2];
+    for (iElem_Bound = 0; iElem_Bound < nElem_Bound[iMarker]; iElem_Bound++) {
+      VTK_Type = BoundConn[iConn++];
+      switch (VTK_Type) {
+        case LINE:          nNodes = N_POINTS_LINE;          break;
+        case TRIANGLE:      nNodes = N_POINTS_TRIANGLE;      break;
+        case QUADRILATERAL: nNodes = N_POINTS_QUADRILATERAL; break;
+        default:            nNodes = 0;                      break;
+      }
+      if (iConn+nNodes > nConn)
+        SU2_MPI::Error("The marker connectivity of the SU2 binary mesh file is truncated.", CURRENT_FUNCTION);
+      for (iNode = 0; iNode < nNodes; iNode++)
+        if ((unsigned long)BoundConn[iConn+iNode] >= Global_nPoint)
+          SU2_MPI::Error("Node index out of range in the SU2 binary mesh file.", CURRENT_FUNCTION);
+      switch (VTK_Type) {
+        case LINE:
+          if (nDim == 3)
+            SU2_MPI::Error("Please remove line boundary conditions from the mesh file!", CURRENT_FUNCTION);
+          for (iNode = 0; iNode < N_POINTS_LINE; iNode++) vnodes[iNode] = BoundConn[iConn++];
+          bound[iMarker][iElem_Bound] = new CLine(vnodes[0], vnodes[1], 2);
+          break;
+        case TRIANGLE:
+          for (iNode = 0; iNode < N_POINTS_TRIANGLE; iNode++) vnodes[iNode] = BoundConn[iConn++];
+          bound[iMarker][iElem_Bound] = new CTriangle(vnodes[0], vnodes[1], vnodes[2], 3);
+          break;
+        case QUADRILATERAL:
+          for (iNode = 0; iNode < N_POINTS_QUADRILATERAL; iNode++) vnodes[iNode] = BoundConn[iConn++];
+          bound[iMarker][iElem_Bound] = new CQuadrilateral(vnodes[0], vnodes[1], vnodes[2], vnodes[3], 3);
+          break;
+        default:
+          SU2_MPI::Error("Unknown boundary element type in the SU2 binary mesh file.", CURRENT_FUNCTION);
+      }
+    }
+
+    /*--- Update config information storing the boundary information in the right place ---*/
+
+    Tag_to_Marker[config->GetMarker_CfgFile_TagBound(Marker_Tag)] = Marker_Tag;
+    config->SetMarker_All_TagBound(iMarker, Marker_Tag);
+    config->SetMarker_All_KindBC(iMarker, config->GetMarker_CfgFile_KindBC(Marker_Tag));
+    config->SetMarker_All_Monitoring(iMarker, config->GetMarker_CfgFile_Monitoring(Marker_Tag));
+    config->SetMarker_All_GeoEval(iMarker, config->GetMarker_CfgFile_GeoEval(Marker_Tag));
+    config->SetMarker_All_Designing(iMarker, config->GetMarker_CfgFile_Designing(Marker_Tag));
+    config->SetMarker_All_Plotting(iMarker, config->GetMarker_CfgFile_Plotting(Marker_Tag));
+    config->SetMarker_All_Analyze(iMarker, config->GetMarker_CfgFile_Analyze(Marker_Tag));
+    config->SetMarker_All_ZoneInterface(iMarker, config->GetMarker_CfgFile_ZoneInterface(Marker_Tag));
+    config->SetMarker_All_DV(iMarker, config->GetMarker_CfgFile_DV(Marker_Tag));
+    config->SetMarker_All_Moving(iMarker, config->GetMarker_CfgFile_Moving(Marker_Tag));
+    config->SetMarker_All_PyCustom(iMarker, config->GetMarker_CfgFile_PyCustom(Marker_Tag));
+    config->SetMarker_All_PerBound(iMarker, config->GetMarker_CfgFile_PerBound(Marker_Tag));
+    config->SetMarker_All_SendRecv(iMarker, NONE);
+    config->SetMarker_All_Turbomachinery(iMarker, config->GetMarker_CfgFile_Turbomachinery(Marker_Tag));
+    config->SetMarker_All_TurbomachineryFlag(iMarker, config->GetMarker_CfgFile_TurbomachineryFlag(Marker_Tag));
+    config->SetMarker_All_MixingPlaneInterface(iMarker, config->GetMarker_CfgFile_MixingPlaneInterface(Marker_Tag));
+
+  }
+
+  if (rank == MASTER_NODE) BoundaryTable.PrintFooter();
+
+}
+
+#ifdef HAVE_CGNS
+
+/*!
+ * \brief Read the entries [dataBegin, dataBegin+nData) of the connectivity array of a CGNS
+ *        section with a low level (cgio) block read. cg_elements_partial_read reads (and
+ *        keeps in memory) the whole section when it is MIXED or when it is stored with another
+ *        integer size than cgsize_t, which is the case of most files (I4 with a 64 bit build).
+ */
+static void ReadCGNSConnectivity(int fn, string val_path, cgsize_t dataBegin, cgsize_t nData, cgsize_t *conn) {
+
+  if (nData <= 0) return;
+
+  int cgio, ierr = 0;
+  double rootID, nodeID;
+  char dataType[CGIO_MAX_DATATYPE_LENGTH+1];
+
+  if (cg_get_cgio(fn, &cgio) != CG_OK) cg_error_exit();
+  if (cg_root_id(fn, &rootID) != CG_OK) cg_error_exit();
+
+  if ((cgio_get_node_id(cgio, rootID, val_path.c_str(), &nodeID) != CG_OK) ||
+      (cgio_get_data_type(cgio, nodeID, dataType) != CG_OK))
+    SU2_MPI::Error(string("Could not access the CGNS node ") + val_path, CURRENT_FUNCTION);
+
+  /*--- Contiguous block read, much faster than the general (strided) partial read. ---*/
+
+  cgsize_t s_start = dataBegin+1, s_end = dataBegin+nData;
+
+  bool isInt = (strcmp(dataType, "I4") == 0), isLong = (strcmp(dataType, "I8") == 0);
+
+  if ((isInt && (sizeof(cgsize_t) == sizeof(int))) || (isLong && (sizeof(cgsize_t) == sizeof(long long)))) {
+    ierr = cgio_read_block_data(cgio, nodeID, s_start, s_end, conn);
+  }
+  else if (isInt) {
+    int *buf = new int[nData];
+    ierr = cgio_read_block_data(cgio, nodeID, s_start, s_end, buf);
+    for (cgsize_t i = 0; i < nData; i++) conn[i] = buf[i];
+    delete [] buf;
+  }
+  else if (isLong) {
+    long long *buf = new long long[nData];
+    ierr = cgio_read_block_data(cgio, nodeID, s_start, s_end, buf);
+    for (cgsize_t i = 0; i < nData; i++) conn[i] = cgsize_t(buf[i]);
+    delete [] buf;
+  }
+  else {
+    SU2_MPI::Error(string("Unsupported integer type ") + dataType + " in " + val_path, CURRENT_FUNCTION);
+  }
+
+  if (ierr != CG_OK)
+    SU2_MPI::Error(string("Partial read of ") + val_path + " failed.", CURRENT_FUNCTION);
+}
+
+/*!
+ * \brief Position in the connectivity array of a MIXED section of the first element of each rank
+ *        (and of the end of the section). The sizes of the elements follow from their types,
+ *        hence the master scans the section from the start, in chunks of bounded size, and
+ *        broadcasts the positions.
+ * \param[in] nData - Size of the connectivity array of the section.
+ * \param[in] nElem_Linear - Number of elements of the section read by each rank.
+ * \param[out] offsets - Positions of the first element of each rank (size+1 values).
+ */
+static void ScanCGNSMixedOffsets(int fn, string val_path, cgsize_t nData, const unsigned long *nElem_Linear,
+                                 int rank, int size, unsigned long *offsets) {
+
+  if (rank == MASTER_NODE) {
+
+    const cgsize_t nChunk = 1<<20;
+    cgsize_t *chunk = new cgsize_t[nChunk];
+    cgsize_t chunkBegin = 0, chunkEnd = 0, pos = 0;
+    unsigned long iElem = 0, nElem = 0, nextBound = 0;
+    int iRank = 0, npe = 0;
+
+    for (iRank = 0; iRank < size; iRank++) nElem += nElem_Linear[iRank];
+
+    iRank = 0;
+    for (iElem = 0; iElem <= nElem; iElem++) {
+
+      /*--- Record the ranks whose first element is this one. ---*/
+
+      while ((iRank < size) && (iElem == nextBound)) {
+        offsets[iRank] = pos;
+        nextBound += nElem_Linear[iRank];
+        iRank++;
+      }
+      if (iElem == nElem) break;
+
+      /*--- Only the type of each element is needed, the window of the
+       section in memory is moved when the type is not in it. ---*/
+
+      if (pos >= chunkEnd) {
+        if (pos >= nData)
+          SU2_MPI::Error(string("Inconsistent size of the MIXED section ") + val_path, CURRENT_FUNCTION);
+        chunkBegin = pos;
+        chunkEnd   = min(chunkBegin + nChunk, nData);
+        ReadCGNSConnectivity(fn, val_path, chunkBegin, chunkEnd-chunkBegin, chunk);
+      }
+
+      if (cg_npe(ElementType_t(chunk[pos-chunkBegin]), &npe) || (npe <= 0))
+        SU2_MPI::Error(string("Unsupported element in the MIXED section ") + val_path, CURRENT_FUNCTION);
+
+      pos += 1 + npe;
+    }
+
+    for (; iRank <= size; iRank++) offsets[iRank] = pos;
+
+    delete [] chunk;
+  }
+
+  SU2_MPI::Bcast(offsets, size+1, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
+}
+
+#endif
+
 void CPhysicalGeometry::Read_CGNS_Format_Parallel(CConfig *config, string val_mesh_filename, unsigned short val_iZone, unsigned short val_nZone) {
   
   /*--- Original CGNS reader implementation by Thomas D. Economon,
@@ -9670,6 +11049,23 @@ void CPhysicalGeometry::Read_CGNS_Format_Parallel(CConfig *config, string val_me
         isMixed = new bool[nElems[j-1][s-1]];
         for ( int ii = 0; ii < nElems[j-1][s-1]; ii++ ) isMixed[ii] = false;
 
+        /*--- Position of the elements of this rank in the connectivity array
+         of the section, only that range is read from the file. In MIXED
+         sections it follows from the element types, scanned by the master. ---*/
+
+        string connPath = string("/") + basename + "/" + zonename + "/" +
+                          sectionNames[j-1][s-1] + "/ElementConnectivity";
+        unsigned long *dataOffset = new unsigned long[size+1];
+
+        if (elemType == MIXED) {
+          if (cg_ElementDataSize(fn, i, j, s, &ElementDataSize)) cg_error_exit();
+          ScanCGNSMixedOffsets(fn, connPath, ElementDataSize, nElem_Linear, rank, size, dataOffset);
+        } else {
+          if (cg_npe(elemType, &npe)) cg_error_exit();
+          dataOffset[rank]   = (elemB[rank]-startE)*npe;
+          dataOffset[rank+1] = dataOffset[rank] + nElem_Linear[rank]*npe;
+        }
+
         /*--- Protect against the situation where there are fewer elements
         in a section than number of ranks, or the linear partitioning will
         fail. For now, assume that these must be surfaces, and we will 
@@ -9686,9 +11082,8 @@ void CPhysicalGeometry::Read_CGNS_Format_Parallel(CConfig *config, string val_me
          we are only accessing our rank's piece of the data here in the
          partial read function in the CGNS API. ---*/
 
-        if (cg_elements_partial_read(fn, i, j, s, (cgsize_t)elemB[rank],
-                                    (cgsize_t)elemE[rank], connElemCGNS,
-                                    parentData) != CG_OK) cg_error_exit();
+        ReadCGNSConnectivity(fn, connPath, (cgsize_t)dataOffset[rank],
+                             (cgsize_t)(dataOffset[rank+1]-dataOffset[rank]), connElemCGNS);
         
         /*--- Find the number of nodes required to represent
          this type of element. ---*/
@@ -9831,6 +11226,8 @@ void CPhysicalGeometry::Read_CGNS_Format_Parallel(CConfig *config, string val_me
        
         } 
         
+        delete [] dataOffset;
+        
          /*--- If we have found that this is a boundary section (we assume
          that internal cells and boundary cells do not exist in the same
          section together), the master node reads the boundary section.
@@ -11573,9 +12970,18 @@ void CPhysicalGeometry::SetPoint_Connectivity(void) {
       node[iPoint]->SetElem(iElem);
     }
 
-  /*--- Loop over all the points ---*/
+  /*--- Loop over all the points, the neighbors already in the list are
+   marked to skip the duplicates without searching the list. ---*/
   
-  for (iPoint = 0; iPoint < nPoint; iPoint++)
+  vector<unsigned long> Mark(nPoint, nPoint), Neighbors;
+  
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    
+    Neighbors.clear();
+    for (iNeighbor = 0; iNeighbor < node[iPoint]->GetnPoint(); iNeighbor++) {
+      Neighbors.push_back(node[iPoint]->GetPoint(iNeighbor));
+      Mark[Neighbors.back()] = iPoint;
+    }
     
   /*--- Loop over all elements shared by the point ---*/
     
@@ -11597,9 +13003,16 @@ void CPhysicalGeometry::SetPoint_Connectivity(void) {
             
             /*--- Store the point into the point ---*/
             
-            node[iPoint]->SetPoint(Point_Neighbor);
+            if (Mark[Point_Neighbor] != iPoint) {
+              Mark[Point_Neighbor] = iPoint;
+              Neighbors.push_back(Point_Neighbor);
+            }
           }
     }
+    
+    node[iPoint]->SetPoints(Neighbors);
+    
+  }
   
   /*--- Set the number of neighbors variable, this is
    important for JST and multigrid in parallel ---*/
@@ -15456,6 +16869,417 @@ void CPhysicalGeometry::SetColorGrid(CConfig *config) {
   
 }
 
+#ifdef HAVE_MPI
+
+/*--- Header of the partition weights files: format id and number of points
+ of the grid, followed by the weight of every point (float) in the order of
+ the global index. ---*/
+
+static const unsigned long long PARTITION_WEIGHTS_ID = 535534;
+static const int PARTITION_WEIGHTS_NVARS = 2;
+
+#endif
+
+#if defined(HAVE_MPI) && defined(HAVE_PARMETIS)
+
+/*--- Header of the partition cache files: format id, number of points of
+ the grid, number of ranks and hash of the graph, followed by the color of
+ every point (int) in the order of the linear partition. ---*/
+
+static const unsigned long long PARTITION_CACHE_ID = 535533;
+static const int PARTITION_CACHE_NVARS = 4;
+
+/*!
+ * \brief FNV-1a hash of a block of 64 bit values, continued from val_hash.
+ */
+static unsigned long long HashPartitionData(unsigned long long val_hash, const unsigned long long *data, unsigned long nData) {
+  for (unsigned long i = 0; i < nData; i++) {
+    for (int iByte = 0; iByte < 8; iByte++) {
+      val_hash ^= (data[i] >> (8*iByte)) & 0xFF;
+      val_hash *= 1099511628211ULL;
+    }
+  }
+  return val_hash;
+}
+
+/*!
+ * \brief Hash of the (distributed) graph given to ParMETIS, the same on all ranks. The
+ *        graph only depends on the topology of the grid and on the vertex weights (if
+ *        any), the coordinates are not used.
+ */
+static unsigned long long HashPartitionGraph(const idx_t *vtxdist, const idx_t *xadj, const idx_t *adjacency,
+                                             const idx_t *vwgt, int rank, int size) {
+
+  /*--- Local hash of the adjacency of the points of this rank (already sorted). ---*/
+
+  unsigned long long val_hash = 14695981039346656037ULL, val;
+  unsigned long nLocal = vtxdist[rank+1]-vtxdist[rank];
+
+  for (unsigned long iPoint = 0; iPoint < nLocal; iPoint++) {
+    val = xadj[iPoint+1]-xadj[iPoint];
+    val_hash = HashPartitionData(val_hash, &val, 1);
+    for (idx_t iAdj = xadj[iPoint]; iAdj < xadj[iPoint+1]; iAdj++) {
+      val = adjacency[iAdj];
+      val_hash = HashPartitionData(val_hash, &val, 1);
+    }
+    if (vwgt != NULL) {
+      val = vwgt[iPoint];
+      val_hash = HashPartitionData(val_hash, &val, 1);
+    }
+  }
+
+  /*--- Combine the local hashes in rank order, with the size of the graph. ---*/
+
+  unsigned long long *rank_hash = new unsigned long long[size+2];
+  SU2_MPI::Allgather(&val_hash, 1, MPI_UNSIGNED_LONG_LONG, rank_hash, 1, MPI_UNSIGNED_LONG_LONG, MPI_COMM_WORLD);
+  rank_hash[size]   = vtxdist[size];
+  rank_hash[size+1] = size;
+
+  val_hash = HashPartitionData(14695981039346656037ULL, rank_hash, size+2);
+
+  delete [] rank_hash;
+
+  return val_hash;
+}
+
+/*!
+ * \brief Read the colors of the points of this rank from a partition cache file.
+ * \return <code>TRUE</code> if the file exists and matches the graph (on all ranks).
+ */
+static bool ReadPartitionCache(string val_filename, unsigned long long val_hash,
+                               const idx_t *vtxdist, idx_t *part, int rank, int size) {
+
+  MPI_File fhw;
+  char fname[MAX_STRING_SIZE];
+  strcpy(fname, val_filename.c_str());
+
+  /*--- A missing file is not an error, the partition is computed and stored. ---*/
+
+  if (MPI_File_open(MPI_COMM_WORLD, fname, MPI_MODE_RDONLY, MPI_INFO_NULL, &fhw) != MPI_SUCCESS)
+    return false;
+
+  /*--- Check the header, a hash collision with a different grid of the same
+   size is then the only way to get a wrong partition. ---*/
+
+  unsigned long long header[PARTITION_CACHE_NVARS] = {0, 0, 0, 0};
+  if (rank == MASTER_NODE)
+    MPI_File_read_at(fhw, 0, header, PARTITION_CACHE_NVARS, MPI_UNSIGNED_LONG_LONG, MPI_STATUS_IGNORE);
+  SU2_MPI::Bcast(header, PARTITION_CACHE_NVARS, MPI_UNSIGNED_LONG_LONG, MASTER_NODE, MPI_COMM_WORLD);
+
+  bool match = ((header[0] == PARTITION_CACHE_ID) && (header[1] == (unsigned long long)vtxdist[size]) &&
+                (header[2] == (unsigned long long)size) && (header[3] == val_hash));
+
+  int nLocal = int(vtxdist[rank+1]-vtxdist[rank]), nRead = 0;
+  int local_ok = 1, global_ok = 0;
+
+  if (match) {
+    int *color = new int[nLocal];
+    MPI_Offset disp = PARTITION_CACHE_NVARS*sizeof(unsigned long long) + vtxdist[rank]*sizeof(int);
+    MPI_Status status;
+    MPI_File_read_at_all(fhw, disp, color, nLocal, MPI_INT, &status);
+    MPI_Get_count(&status, MPI_INT, &nRead);
+    local_ok = (nRead == nLocal);
+    for (int iPoint = 0; iPoint < nLocal && local_ok; iPoint++) {
+      local_ok = (color[iPoint] >= 0) && (color[iPoint] < size);
+      part[iPoint] = color[iPoint];
+    }
+    delete [] color;
+  }
+
+  MPI_File_close(&fhw);
+
+  if (!match) return false;
+
+  SU2_MPI::Allreduce(&local_ok, &global_ok, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+  return (global_ok == 1);
+}
+
+/*!
+ * \brief Write the colors of the points of all ranks to a partition cache file.
+ */
+static void WritePartitionCache(string val_filename, unsigned long long val_hash,
+                                const idx_t *vtxdist, const idx_t *part, int rank, int size) {
+
+  MPI_File fhw;
+  char fname[MAX_STRING_SIZE];
+  strcpy(fname, val_filename.c_str());
+
+  /*--- Remove a stale file first (e.g. a larger grid with a colliding name). ---*/
+
+  if (rank == MASTER_NODE) MPI_File_delete(fname, MPI_INFO_NULL);
+  SU2_MPI::Barrier(MPI_COMM_WORLD);
+
+  /*--- The cache is only an optimization, a failure to write it is not fatal. ---*/
+
+  if (MPI_File_open(MPI_COMM_WORLD, fname, MPI_MODE_CREATE|MPI_MODE_WRONLY, MPI_INFO_NULL, &fhw) != MPI_SUCCESS) {
+    if (rank == MASTER_NODE)
+      cout << "Warning: could not write the partition cache file " << val_filename << "." << endl;
+    return;
+  }
+
+  unsigned long long header[PARTITION_CACHE_NVARS] = {PARTITION_CACHE_ID, (unsigned long long)vtxdist[size],
+                                                      (unsigned long long)size, val_hash};
+  if (rank == MASTER_NODE)
+    MPI_File_write_at(fhw, 0, header, PARTITION_CACHE_NVARS, MPI_UNSIGNED_LONG_LONG, MPI_STATUS_IGNORE);
+
+  int nLocal = int(vtxdist[rank+1]-vtxdist[rank]);
+  int *color = new int[nLocal];
+  for (int iPoint = 0; iPoint < nLocal; iPoint++) color[iPoint] = int(part[iPoint]);
+
+  MPI_Offset disp = PARTITION_CACHE_NVARS*sizeof(unsigned long long) + vtxdist[rank]*sizeof(int);
+  MPI_File_write_at_all(fhw, disp, color, nLocal, MPI_INT, MPI_STATUS_IGNORE);
+
+  delete [] color;
+
+  MPI_File_close(&fhw);
+}
+
+/*!
+ * \brief Read the weights of the points of this rank from a partition weights file.
+ * \return <code>TRUE</code> if the file exists and matches the grid (on all ranks).
+ */
+static bool ReadPartitionWeights(string val_filename, const idx_t *vtxdist, passivedouble *weight, int rank, int size) {
+
+  MPI_File fhw;
+  char fname[MAX_STRING_SIZE];
+  strcpy(fname, val_filename.c_str());
+
+  if (MPI_File_open(MPI_COMM_WORLD, fname, MPI_MODE_RDONLY, MPI_INFO_NULL, &fhw) != MPI_SUCCESS)
+    return false;
+
+  unsigned long long header[PARTITION_WEIGHTS_NVARS] = {0, 0};
+  if (rank == MASTER_NODE)
+    MPI_File_read_at(fhw, 0, header, PARTITION_WEIGHTS_NVARS, MPI_UNSIGNED_LONG_LONG, MPI_STATUS_IGNORE);
+  SU2_MPI::Bcast(header, PARTITION_WEIGHTS_NVARS, MPI_UNSIGNED_LONG_LONG, MASTER_NODE, MPI_COMM_WORLD);
+
+  bool match = ((header[0] == PARTITION_WEIGHTS_ID) && (header[1] == (unsigned long long)vtxdist[size]));
+
+  int nLocal = int(vtxdist[rank+1]-vtxdist[rank]), nRead = 0;
+  int local_ok = 1, global_ok = 0;
+
+  if (match) {
+    float *buffer = new float[nLocal];
+    MPI_Offset disp = PARTITION_WEIGHTS_NVARS*sizeof(unsigned long long) + vtxdist[rank]*sizeof(float);
+    MPI_Status status;
+    MPI_File_read_at_all(fhw, disp, buffer, nLocal, MPI_FLOAT, &status);
+    MPI_Get_count(&status, MPI_FLOAT, &nRead);
+    local_ok = (nRead == nLocal);
+    for (int iPoint = 0; iPoint < nLocal && local_ok; iPoint++) {
+      local_ok = (buffer[iPoint] > 0.0);
+      weight[iPoint] = buffer[iPoint];
+    }
+    delete [] buffer;
+  }
+
+  MPI_File_close(&fhw);
+
+  if (!match) return false;
+
+  SU2_MPI::Allreduce(&local_ok, &global_ok, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+  return (global_ok == 1);
+}
+
+#endif
+
+/*!
+ * \brief Index of a point along a Hilbert curve of nDim dimensions with nBits bits per
+ *        dimension (J. Skilling, "Programming the Hilbert curve", AIP Conf. Proc. 707, 2004).
+ * \param[in,out] X - Integer coordinates of the point (overwritten).
+ */
+static unsigned long long HilbertIndex(unsigned long *X, unsigned short nDim, unsigned short nBits) {
+
+  unsigned long M = 1UL << (nBits-1), P, Q, t;
+  unsigned short iDim;
+
+  /*--- Inverse undo of the excess work. ---*/
+
+  for (Q = M; Q > 1; Q >>= 1) {
+    P = Q - 1;
+    for (iDim = 0; iDim < nDim; iDim++) {
+      if (X[iDim] & Q) X[0] ^= P;
+      else { t = (X[0] ^ X[iDim]) & P; X[0] ^= t; X[iDim] ^= t; }
+    }
+  }
+
+  /*--- Gray encoding. ---*/
+
+  for (iDim = 1; iDim < nDim; iDim++) X[iDim] ^= X[iDim-1];
+  t = 0;
+  for (Q = M; Q > 1; Q >>= 1)
+    if (X[nDim-1] & Q) t ^= Q - 1;
+  for (iDim = 0; iDim < nDim; iDim++) X[iDim] ^= t;
+
+  /*--- Interleave the bits of the (transposed) index. ---*/
+
+  unsigned long long index = 0;
+  for (int iBit = nBits-1; iBit >= 0; iBit--)
+    for (iDim = 0; iDim < nDim; iDim++)
+      index = (index << 1) | ((X[iDim] >> iBit) & 1UL);
+
+  return index;
+}
+
+void CPhysicalGeometry::SetColorGrid_Hilbert(CConfig *config) {
+
+  unsigned long iPoint, Global_nPoint_Linear = 0;
+  unsigned short iDim;
+  int iSplit, nSplit = size-1;
+
+  /*--- The index must fit in 64 bits. ---*/
+
+  const unsigned short nBits = (nDim == 2)? 31 : 21;
+
+  if (rank == MASTER_NODE) cout << "Partitioning along a Hilbert curve...";
+
+  /*--- Bounding box of the grid, the same scale is used in all the directions
+   to keep the locality of the curve in stretched domains. ---*/
+
+  passivedouble Local_Min[3] = {0.0,0.0,0.0}, Local_Max[3] = {0.0,0.0,0.0};
+  passivedouble Min[3] = {0.0,0.0,0.0}, Max[3] = {0.0,0.0,0.0};
+
+  for (iDim = 0; iDim < nDim; iDim++) {
+    Local_Min[iDim] =  1E30;
+    Local_Max[iDim] = -1E30;
+  }
+
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    for (iDim = 0; iDim < nDim; iDim++) {
+      passivedouble Coord = SU2_TYPE::GetValue(node[iPoint]->GetCoord(iDim));
+      Local_Min[iDim] = min(Local_Min[iDim], Coord);
+      Local_Max[iDim] = max(Local_Max[iDim], Coord);
+    }
+  }
+
+  SU2_MPI::Allreduce(Local_Min, Min, nDim, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(Local_Max, Max, nDim, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&nPoint, &Global_nPoint_Linear, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+
+  passivedouble Length = 0.0;
+  for (iDim = 0; iDim < nDim; iDim++) Length = max(Length, Max[iDim]-Min[iDim]);
+  if (Length <= 0.0) Length = 1.0;
+
+  const unsigned long MaxInt = (1UL << nBits) - 1;
+  const passivedouble Scale = passivedouble(MaxInt)/Length;
+
+  /*--- Index of the local points along the curve (sorted for the counts). ---*/
+
+  vector<unsigned long long> Index(nPoint);
+  unsigned long X[3] = {0,0,0};
+
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    for (iDim = 0; iDim < nDim; iDim++) {
+      passivedouble Coord = SU2_TYPE::GetValue(node[iPoint]->GetCoord(iDim));
+      X[iDim] = min(MaxInt, (unsigned long)((Coord-Min[iDim])*Scale));
+    }
+    Index[iPoint] = HilbertIndex(X, nDim, nBits);
+  }
+
+  vector<unsigned long long> Sorted(Index);
+  sort(Sorted.begin(), Sorted.end());
+
+  /*--- Split the curve in parts with the same number of points. Splitter k is
+   the smallest index with at least (k+1)*N/size points before it, all the
+   splitters are found together by bisection of the range of the index, with
+   one reduction of the counts per bit of the index. ---*/
+
+  vector<unsigned long long> Lower(nSplit, 0), Upper(nSplit, 1ULL << (nDim*nBits)), Middle(nSplit, 0);
+  vector<unsigned long> Target(nSplit), Local_Count(nSplit), Count(nSplit);
+
+  for (iSplit = 0; iSplit < nSplit; iSplit++)
+    Target[iSplit] = ((iSplit+1)*Global_nPoint_Linear)/size;
+
+  while (true) {
+
+    bool converged = true;
+    for (iSplit = 0; iSplit < nSplit; iSplit++) {
+      Local_Count[iSplit] = 0;
+      if (Lower[iSplit] < Upper[iSplit]) {
+        converged = false;
+        Middle[iSplit] = Lower[iSplit] + (Upper[iSplit]-Lower[iSplit])/2;
+        Local_Count[iSplit] = lower_bound(Sorted.begin(), Sorted.end(), Middle[iSplit]) - Sorted.begin();
+      }
+    }
+
+    /*--- The bounds are the same on all ranks, so is the convergence. ---*/
+
+    if (converged) break;
+
+    SU2_MPI::Allreduce(Local_Count.data(), Count.data(), nSplit, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+
+    for (iSplit = 0; iSplit < nSplit; iSplit++) {
+      if (Lower[iSplit] < Upper[iSplit]) {
+        if (Count[iSplit] >= Target[iSplit]) Upper[iSplit] = Middle[iSplit];
+        else Lower[iSplit] = Middle[iSplit]+1;
+      }
+    }
+  }
+
+  /*--- The color of a point is the number of splitters before it on the curve. ---*/
+
+  for (iPoint = 0; iPoint < nPoint; iPoint++)
+    node[iPoint]->SetColor(upper_bound(Lower.begin(), Lower.end(), Index[iPoint]) - Lower.begin());
+
+  if (rank == MASTER_NODE) cout << " partitioning complete." << endl;
+
+}
+
+void CPhysicalGeometry::ComputePartitionWeights(CConfig *config, passivedouble *val_weight) {
+
+#if defined(HAVE_MPI) && defined(HAVE_PARMETIS)
+
+  unsigned long iPoint, iElem, iVertex;
+  unsigned short iMarker, iNode;
+  int iRank;
+
+  /*--- One block for the point and one for each neighbor. ---*/
+
+  for (iPoint = 0; iPoint < nPoint; iPoint++)
+    val_weight[iPoint] = 1.0 + passivedouble(xadj[iPoint+1]-xadj[iPoint]);
+
+  /*--- Plus one for each marker of the point. The markers are held by the
+   master, which sends the local index of the vertices to their ranks. ---*/
+
+  vector<vector<unsigned long> > Vertex_Send(size);
+  vector<unsigned long> nVertex_Send(size, 0), Vertex_Recv, Marker_Points;
+  unsigned long nVertex_Recv = 0;
+
+  if (rank == MASTER_NODE) {
+    for (iMarker = 0; iMarker < nMarker; iMarker++) {
+      if (config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) continue;
+      Marker_Points.clear();
+      for (iElem = 0; iElem < nElem_Bound[iMarker]; iElem++)
+        for (iNode = 0; iNode < bound[iMarker][iElem]->GetnNodes(); iNode++)
+          Marker_Points.push_back(bound[iMarker][iElem]->GetNode(iNode));
+      sort(Marker_Points.begin(), Marker_Points.end());
+      Marker_Points.erase(unique(Marker_Points.begin(), Marker_Points.end()), Marker_Points.end());
+      for (iVertex = 0; iVertex < Marker_Points.size(); iVertex++) {
+        iRank = upper_bound(ending_node, ending_node+size, Marker_Points[iVertex]) - ending_node;
+        if (iRank < size) Vertex_Send[iRank].push_back(Marker_Points[iVertex]-starting_node[iRank]);
+      }
+    }
+    for (iRank = 0; iRank < size; iRank++) nVertex_Send[iRank] = Vertex_Send[iRank].size();
+  }
+
+  SU2_MPI::Scatter(nVertex_Send.data(), 1, MPI_UNSIGNED_LONG, &nVertex_Recv, 1, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
+
+  if (rank == MASTER_NODE) {
+    Vertex_Recv = Vertex_Send[MASTER_NODE];
+    for (iRank = 0; iRank < size; iRank++) {
+      if ((iRank != MASTER_NODE) && (nVertex_Send[iRank] > 0))
+        SU2_MPI::Send(Vertex_Send[iRank].data(), int(nVertex_Send[iRank]), MPI_UNSIGNED_LONG, iRank, iRank, MPI_COMM_WORLD);
+    }
+  } else if (nVertex_Recv > 0) {
+    Vertex_Recv.resize(nVertex_Recv);
+    SU2_MPI::Recv(Vertex_Recv.data(), int(nVertex_Recv), MPI_UNSIGNED_LONG, MASTER_NODE, rank, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+  }
+
+  for (iVertex = 0; iVertex < Vertex_Recv.size(); iVertex++)
+    if (Vertex_Recv[iVertex] < nPoint) val_weight[Vertex_Recv[iVertex]] += 1.0;
+
+#endif
+
+}
+
 void CPhysicalGeometry::SetColorGrid_Parallel(CConfig *config) {
   
   /*--- Initialize the color vector ---*/
@@ -15464,9 +17288,18 @@ void CPhysicalGeometry::SetColorGrid_Parallel(CConfig *config) {
     node[iPoint]->SetColor(0);
   
   /*--- This routine should only ever be called if we have parallel support
-   with MPI and have the ParMETIS library compiled and linked. ---*/
+   with MPI. The geometric partitioner is used when it is selected or when
+   the ParMETIS library is not compiled and linked. ---*/
   
 #ifdef HAVE_MPI
+  
+  bool hilbert = (config->GetKind_Partitioner() == HILBERT_PARTITIONER);
+#ifndef HAVE_PARMETIS
+  hilbert = true;
+#endif
+  
+  if (hilbert && (size > SINGLE_NODE)) SetColorGrid_Hilbert(config);
+  
 #ifdef HAVE_PARMETIS
   
   unsigned long iPoint;
@@ -15474,7 +17307,7 @@ void CPhysicalGeometry::SetColorGrid_Parallel(CConfig *config) {
 
   /*--- Only call ParMETIS if we have more than one rank to avoid errors ---*/
   
-  if (size > SINGLE_NODE) {
+  if ((size > SINGLE_NODE) && !hilbert) {
     
     /*--- Create some structures that ParMETIS needs for partitioning. ---*/
     
@@ -15510,14 +17343,76 @@ void CPhysicalGeometry::SetColorGrid_Parallel(CConfig *config) {
       vtxdist[i+1] = (idx_t)ending_node[i];
     }
     
+    /*--- Vertex weights, from the cost model of the points or measured in a
+     previous run. ParMETIS needs integers, the weights are scaled to a mean
+     of 100 (or less, to keep their sum in the range of idx_t). ---*/
+    
+    idx_t *vwgt = NULL;
+    
+    if (config->GetKind_Partition_Weights() != NO_PARTITION_WEIGHTS) {
+      
+      passivedouble *weight = new passivedouble[nPoint];
+      bool measured = false;
+      
+      if (config->GetKind_Partition_Weights() == MEASURED_WEIGHTS) {
+        string weights_filename = config->GetMultizone_FileName(config->GetPartition_Weights_FileName(), config->GetiZone());
+        measured = ReadPartitionWeights(weights_filename, vtxdist, weight, rank, size);
+        if (rank == MASTER_NODE) {
+          if (measured) cout << "Read the partition weights from " << weights_filename << "." << endl;
+          else cout << "Warning: could not read the partition weights from " << weights_filename << ", using the cost model." << endl;
+        }
+      }
+      if (!measured) ComputePartitionWeights(config, weight);
+      
+      passivedouble Local_Weight = 0.0, Total_Weight = 0.0;
+      for (iPoint = 0; iPoint < nPoint; iPoint++) Local_Weight += weight[iPoint];
+      SU2_MPI::Allreduce(&Local_Weight, &Total_Weight, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+      
+      passivedouble Scale = min(100.0*passivedouble(vtxdist[size])/Total_Weight, 0.25*passivedouble(IDX_MAX)/Total_Weight);
+      
+      vwgt = new idx_t[nPoint];
+      for (iPoint = 0; iPoint < nPoint; iPoint++)
+        vwgt[iPoint] = max((idx_t)1, (idx_t)ceil(weight[iPoint]*Scale));
+      
+      wgtflag = 2;
+      delete [] weight;
+    }
+    
+    /*--- Reuse the partition computed in a previous run for the same graph
+     and number of ranks, the hash of the graph is part of the file name.
+     Only the colors are cached, i.e. the cache saves the ParMETIS call but not
+     the rest of the preprocessing. The distribution of the volume connectivity,
+     the point connectivity, the edges, the send/receive lists and the multigrid
+     agglomeration only depend on the topology too, but they are still rebuilt
+     from the colors in every run. ---*/
+
+    bool cached = false;
+    unsigned long long graph_hash = 0;
+    string cache_filename;
+
+    if (config->GetPartition_Cache()) {
+      graph_hash = HashPartitionGraph(vtxdist, xadj, adjacency, vwgt, rank, size);
+      stringstream cache_name;
+      cache_name << config->GetPartition_Cache_FileName() << "_" << hex << graph_hash << dec << "_" << size << ".dat";
+      cache_filename = cache_name.str();
+      cached = ReadPartitionCache(cache_filename, graph_hash, vtxdist, part, rank, size);
+      if (cached && (rank == MASTER_NODE))
+        cout << "Read the graph partition from " << cache_filename << "." << endl;
+    }
+
     /*--- Calling ParMETIS ---*/
-    if (rank == MASTER_NODE) cout << "Calling ParMETIS...";
-    ParMETIS_V3_PartKway(vtxdist,xadj, adjacency, NULL, NULL, &wgtflag,
-                         &numflag, &ncon, &nparts, tpwgts, &ubvec, options,
-                         &edgecut, part, &comm);
-    if (rank == MASTER_NODE) {
-      cout << " graph partitioning complete (";
-      cout << edgecut << " edge cuts)." << endl;
+
+    if (!cached) {
+      if (rank == MASTER_NODE) cout << "Calling ParMETIS...";
+      ParMETIS_V3_PartKway(vtxdist,xadj, adjacency, vwgt, NULL, &wgtflag,
+                           &numflag, &ncon, &nparts, tpwgts, &ubvec, options,
+                           &edgecut, part, &comm);
+      if (rank == MASTER_NODE) {
+        cout << " graph partitioning complete (";
+        cout << edgecut << " edge cuts)." << endl;
+      }
+      if (config->GetPartition_Cache())
+        WritePartitionCache(cache_filename, graph_hash, vtxdist, part, rank, size);
     }
     
     /*--- Store the results of the partitioning (note that this is local
@@ -15533,6 +17428,7 @@ void CPhysicalGeometry::SetColorGrid_Parallel(CConfig *config) {
     delete [] vtxdist;
     delete [] part;
     delete [] tpwgts;
+    if (vwgt != NULL) delete [] vwgt;
     
   }
   
@@ -15547,6 +17443,89 @@ void CPhysicalGeometry::SetColorGrid_Parallel(CConfig *config) {
   
 }
 
+void CPhysicalGeometry::WritePartitionWeights(CConfig *config, passivedouble val_time) {
+
+#ifdef HAVE_MPI
+
+  unsigned long iPoint;
+  unsigned short iMarker;
+  int nLocal = int(nPointDomain);
+
+  /*--- Cost model of the points of this rank, as in the partitioning. ---*/
+
+  vector<pair<unsigned long, passivedouble> > Weight(nPointDomain);
+  passivedouble Local_Model = 0.0, Total_Time = 0.0;
+
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    passivedouble Model = 1.0 + passivedouble(node[iPoint]->GetnPoint());
+    for (iMarker = 0; iMarker < nMarker; iMarker++)
+      if ((config->GetMarker_All_KindBC(iMarker) != SEND_RECEIVE) && (node[iPoint]->GetVertex(iMarker) != -1))
+        Model += 1.0;
+    Weight[iPoint] = make_pair(node[iPoint]->GetGlobalIndex(), Model);
+    Local_Model += Model;
+  }
+
+  /*--- The time of the rank is distributed over its points with the model,
+   the weights are normalized with the mean time per point of all ranks. ---*/
+
+  SU2_MPI::Allreduce(&val_time, &Total_Time, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+
+  passivedouble Scale = 1.0;
+  if ((Total_Time > 0.0) && (Local_Model > 0.0))
+    Scale = (val_time/Local_Model)*passivedouble(Global_nPointDomain)/Total_Time;
+
+  sort(Weight.begin(), Weight.end());
+
+  /*--- Each rank writes its points at the position of their global index. ---*/
+
+  float *buffer = new float[nLocal];
+  int *blocklen = new int[nLocal];
+  MPI_Aint *disp = new MPI_Aint[nLocal];
+
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    buffer[iPoint]   = max(float(Weight[iPoint].second*Scale), 1E-6f);
+    blocklen[iPoint] = 1;
+    disp[iPoint]     = MPI_Aint(PARTITION_WEIGHTS_NVARS*sizeof(unsigned long long) + Weight[iPoint].first*sizeof(float));
+  }
+
+  MPI_Datatype filetype;
+  MPI_Type_create_hindexed(nLocal, blocklen, disp, MPI_FLOAT, &filetype);
+  MPI_Type_commit(&filetype);
+
+  string weights_filename = config->GetMultizone_FileName(config->GetPartition_Weights_FileName(), config->GetiZone());
+  char fname[MAX_STRING_SIZE];
+  strcpy(fname, weights_filename.c_str());
+
+  if (rank == MASTER_NODE) MPI_File_delete(fname, MPI_INFO_NULL);
+  SU2_MPI::Barrier(MPI_COMM_WORLD);
+
+  MPI_File fhw;
+  if (MPI_File_open(MPI_COMM_WORLD, fname, MPI_MODE_CREATE|MPI_MODE_WRONLY, MPI_INFO_NULL, &fhw) == MPI_SUCCESS) {
+
+    unsigned long long header[PARTITION_WEIGHTS_NVARS] = {PARTITION_WEIGHTS_ID, Global_nPointDomain};
+    if (rank == MASTER_NODE)
+      MPI_File_write_at(fhw, 0, header, PARTITION_WEIGHTS_NVARS, MPI_UNSIGNED_LONG_LONG, MPI_STATUS_IGNORE);
+
+    MPI_File_set_view(fhw, 0, MPI_FLOAT, filetype, (char*)"native", MPI_INFO_NULL);
+    MPI_File_write_all(fhw, buffer, nLocal, MPI_FLOAT, MPI_STATUS_IGNORE);
+    MPI_File_close(&fhw);
+
+    if (rank == MASTER_NODE) cout << "Writing the partition weights file (" << weights_filename << ")." << endl;
+
+  } else if (rank == MASTER_NODE) {
+    cout << "Warning: could not write the partition weights file " << weights_filename << "." << endl;
+  }
+
+  MPI_Type_free(&filetype);
+
+  delete [] buffer;
+  delete [] blocklen;
+  delete [] disp;
+
+#endif
+
+}
+
 void CPhysicalGeometry::GetQualityStatistics(su2double *statistics) {
   unsigned long jPoint, Point_2, Point_3, iElem;
   su2double *Coord_j, *Coord_2, *Coord_3;
@@ -19049,17 +21028,29 @@ void CMultiGridGeometry::SetPoint_Connectivity(CGeometry *fine_grid) {
   unsigned long iFinePoint, iFinePoint_Neighbor, iParent, iCoarsePoint;
   unsigned short iChildren, iNode;
   
-  /*--- Set the point surrounding a point ---*/
+  /*--- Set the point surrounding a point, the neighbors already in the list
+   are marked to skip the duplicates without searching the list. ---*/
+  
+  vector<unsigned long> Mark(nPoint, nPoint), Neighbors;
   
   for (iCoarsePoint = 0; iCoarsePoint < nPoint; iCoarsePoint ++) {
+    Neighbors.clear();
+    for (iNode = 0; iNode < node[iCoarsePoint]->GetnPoint(); iNode ++) {
+      Neighbors.push_back(node[iCoarsePoint]->GetPoint(iNode));
+      Mark[Neighbors.back()] = iCoarsePoint;
+    }
     for (iChildren = 0; iChildren <  node[iCoarsePoint]->GetnChildren_CV(); iChildren ++) {
       iFinePoint = node[iCoarsePoint]->GetChildren_CV(iChildren);
       for (iNode = 0; iNode < fine_grid->node[iFinePoint]->GetnPoint(); iNode ++) {
         iFinePoint_Neighbor = fine_grid->node[iFinePoint]->GetPoint(iNode);
         iParent = fine_grid->node[iFinePoint_Neighbor]->GetParent_CV();
-        if (iParent != iCoarsePoint) node[iCoarsePoint]->SetPoint(iParent);
+        if ((iParent != iCoarsePoint) && (Mark[iParent] != iCoarsePoint)) {
+          Mark[iParent] = iCoarsePoint;
+          Neighbors.push_back(iParent);
+        }
       }
     }
+    node[iCoarsePoint]->SetPoints(Neighbors);
   }
   
   /*--- Set the number of neighbors variable, this is
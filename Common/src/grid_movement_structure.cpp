@@ -224,6 +224,12 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
     		mat_vec = new CSysMatrixVectorProduct<su2double>(StiffMatrix, geometry, config);
     		precond = new CJacobiPreconditioner<su2double>(StiffMatrix, geometry, config);
     	}
+      if (config->GetKind_Deform_Linear_Solver_Prec() == AMG) {
+        if ((rank == MASTER_NODE) && Screen_Output) cout << "\n# AMG preconditioner." << endl;
+        StiffMatrix.BuildAMGPreconditioner(config);
+        mat_vec = new CSysMatrixVectorProduct<su2double>(StiffMatrix, geometry, config);
+        precond = new CAMGPreconditioner<su2double>(StiffMatrix, geometry, config);
+      }
 
     } else if (Derivative && (config->GetKind_SU2() == SU2_DOT)) {
 
@@ -242,6 +248,12 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
     		mat_vec = new CSysMatrixVectorProductTransposed<su2double>(StiffMatrix, geometry, config);
     		precond = new CJacobiPreconditioner<su2double>(StiffMatrix, geometry, config);
     	}
+      if (config->GetKind_Deform_Linear_Solver_Prec() == AMG) {
+        if ((rank == MASTER_NODE) && Screen_Output) cout << "\n# AMG preconditioner." << endl;
+        StiffMatrix.BuildAMGPreconditioner(config, true);
+        mat_vec = new CSysMatrixVectorProductTransposed<su2double>(StiffMatrix, geometry, config);
+        precond = new CAMGPreconditioner<su2double>(StiffMatrix, geometry, config);
+      }
 
     }
     
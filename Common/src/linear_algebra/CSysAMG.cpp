@@ -0,0 +1,712 @@
+/*!
+ * \file CSysAMG.cpp
+ * \brief Build and application of the smoothed aggregation multigrid hierarchy.
+ * \version 6.2.0 "Falcon"
+ *
+ * The current SU2 release has been coordinated by the
+ * SU2 International Developers Society <www.su2devsociety.org>
+ * with selected contributions from the open-source community.
+ *
+ * The main research teams contributing to the current release are:
+ *  - Prof. Juan J. Alonso's group at Stanford University.
+ *  - Prof. Piero Colonna's group at Delft University of Technology.
+ *  - Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+ *  - Prof. Alberto Guardone's group at Polytechnic University of Milan.
+ *  - Prof. Rafael Palacios' group at Imperial College London.
+ *  - Prof. Vincent Terrapon's group at the University of Liege.
+ *  - Prof. Edwin van der Weide's group at the University of Twente.
+ *  - Lab. of New Concepts in Aeronautics at Tech. Institute of Aeronautics.
+ *
+ * Copyright 2012-2019, Francisco D. Palacios, Thomas D. Economon,
+ *                      Tim Albring, and the SU2 contributors.
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/linear_algebra/CSysAMG.hpp"
+#include "../../include/linear_algebra/CSysMatrix.inl"
+
+#include <limits>
+
+/*--- Levels with fewer points than this are not coarsened further. ---*/
+const unsigned long AMG_MIN_COARSE_POINTS = 100;
+
+/*--- Largest coarsest level (number of unknowns) that is solved with a dense LU. ---*/
+const unsigned long AMG_MAX_DIRECT_DOF = 1500;
+
+/*--- Marker of the points that do not belong to any aggregate. ---*/
+const unsigned long AMG_NO_AGGREGATE = numeric_limits<unsigned long>::max();
+
+template<class ScalarType>
+CSysAMG<ScalarType>::CSysAMG(void) {
+
+  nVar = 0;
+  nLevel = 0;
+  nCoarseDOF = 0;
+  direct_coarse = false;
+
+}
+
+template<class ScalarType>
+CSysAMG<ScalarType>::~CSysAMG(void) { }
+
+template<class ScalarType>
+void CSysAMG<ScalarType>::Build(unsigned long nPointDomain, unsigned long val_nVar, const su2sparseidx *row_ptr,
+                                const su2sparseidx *col_ind, const ScalarType *matrix, bool transposed,
+                                unsigned short max_levels, passivedouble strength) {
+
+  unsigned long iPoint, index, iVar, nAggregate;
+  unsigned short iLevel;
+
+  nVar = val_nVar;
+  const unsigned long bs = nVar*nVar;
+
+  block.resize(bs);
+  block_aux.resize(bs);
+  work.resize(bs);
+
+  Level.clear();
+  Level.resize(1);
+
+  /*--- Copy the rows of the fine level owned by the rank, without the couplings to the halo. ---*/
+
+  CLevel & fine = Level[0];
+  fine.nPoint = nPointDomain;
+  fine.row_ptr.assign(nPointDomain+1, 0);
+  fine.col_ind.clear();
+  fine.matrix.clear();
+
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++) {
+      if (col_ind[index] < nPointDomain) {
+        fine.col_ind.push_back(col_ind[index]);
+        for (iVar = 0; iVar < bs; iVar++)
+          fine.matrix.push_back(matrix[index*bs+iVar]);
+      }
+    }
+    fine.row_ptr[iPoint+1] = fine.col_ind.size();
+  }
+
+  if (transposed) {
+    vector<unsigned long> t_row_ptr, t_col_ind;
+    vector<ScalarType> t_val;
+    BlockSparseTranspose(nPointDomain, nPointDomain, fine.row_ptr, fine.col_ind, fine.matrix, t_row_ptr, t_col_ind, t_val);
+    fine.row_ptr.swap(t_row_ptr);
+    fine.col_ind.swap(t_col_ind);
+    fine.matrix.swap(t_val);
+  }
+
+  SetDiagonal(fine);
+
+  /*--- Coarsen until the level is small enough, the maximum number of
+   levels is reached, or the aggregation stagnates. The threshold of the
+   strength of connection is halved on each level (Vanek et al.). ---*/
+
+  vector<unsigned long> aggregate;
+
+  for (iLevel = 0; iLevel+1 < max_levels; iLevel++) {
+
+    if (Level[iLevel].nPoint <= AMG_MIN_COARSE_POINTS) break;
+
+    nAggregate = Aggregate(Level[iLevel], strength, aggregate);
+    strength *= 0.5;
+
+    if ((nAggregate == 0) || (10*nAggregate > 9*Level[iLevel].nPoint)) break;
+
+    Level.resize(iLevel+2);
+
+    SetProlongation(Level[iLevel], aggregate, nAggregate);
+    SetCoarseOperator(Level[iLevel], Level[iLevel+1]);
+    SetDiagonal(Level[iLevel+1]);
+  }
+
+  nLevel = Level.size();
+
+  for (iLevel = 0; iLevel < nLevel; iLevel++) {
+    Level[iLevel].sol.assign(Level[iLevel].nPoint*nVar, 0.0);
+    Level[iLevel].rhs.assign(Level[iLevel].nPoint*nVar, 0.0);
+    Level[iLevel].res.assign(Level[iLevel].nPoint*nVar, 0.0);
+  }
+
+  FactorizeCoarse();
+
+}
+
+template<class ScalarType>
+void CSysAMG<ScalarType>::BlockSparseTranspose(unsigned long nRow, unsigned long nCol,
+                                               const vector<unsigned long> & row_ptr, const vector<unsigned long> & col_ind,
+                                               const vector<ScalarType> & val, vector<unsigned long> & t_row_ptr,
+                                               vector<unsigned long> & t_col_ind, vector<ScalarType> & t_val) const {
+
+  unsigned long iRow, jCol, index, pos, iVar, jVar;
+  const unsigned long bs = nVar*nVar;
+
+  /*--- Count the blocks of each column, the rows are then visited in order
+   hence the columns of the transposed matrix are sorted. ---*/
+
+  t_row_ptr.assign(nCol+1, 0);
+  for (index = 0; index < row_ptr[nRow]; index++)
+    t_row_ptr[col_ind[index]+1]++;
+  for (jCol = 0; jCol < nCol; jCol++)
+    t_row_ptr[jCol+1] += t_row_ptr[jCol];
+
+  t_col_ind.resize(row_ptr[nRow]);
+  t_val.resize(row_ptr[nRow]*bs);
+
+  vector<unsigned long> next(t_row_ptr.begin(), t_row_ptr.end()-1);
+
+  for (iRow = 0; iRow < nRow; iRow++) {
+    for (index = row_ptr[iRow]; index < row_ptr[iRow+1]; index++) {
+      pos = next[col_ind[index]]++;
+      t_col_ind[pos] = iRow;
+      for (iVar = 0; iVar < nVar; iVar++)
+        for (jVar = 0; jVar < nVar; jVar++)
+          t_val[pos*bs+jVar*nVar+iVar] = val[index*bs+iVar*nVar+jVar];
+    }
+  }
+
+}
+
+template<class ScalarType>
+void CSysAMG<ScalarType>::BlockSparseProduct(unsigned long nRow, unsigned long nCol,
+                                             const vector<unsigned long> & a_row_ptr, const vector<unsigned long> & a_col_ind,
+                                             const vector<ScalarType> & a_val, const vector<unsigned long> & b_row_ptr,
+                                             const vector<unsigned long> & b_col_ind, const vector<ScalarType> & b_val,
+                                             vector<unsigned long> & c_row_ptr, vector<unsigned long> & c_col_ind,
+                                             vector<ScalarType> & c_val) {
+
+  unsigned long iRow, kCol, jCol, a_index, b_index, pos, iVar, nRowBlocks;
+  const unsigned long bs = nVar*nVar;
+
+  /*--- Row by row with a dense accumulator (marker of the position of each
+   column in the current row of C). ---*/
+
+  vector<unsigned long> marker(nCol, AMG_NO_AGGREGATE);
+
+  c_row_ptr.assign(nRow+1, 0);
+  c_col_ind.clear();
+  c_val.clear();
+
+  for (iRow = 0; iRow < nRow; iRow++) {
+
+    nRowBlocks = 0;
+
+    for (a_index = a_row_ptr[iRow]; a_index < a_row_ptr[iRow+1]; a_index++) {
+      kCol = a_col_ind[a_index];
+
+      for (b_index = b_row_ptr[kCol]; b_index < b_row_ptr[kCol+1]; b_index++) {
+        jCol = b_col_ind[b_index];
+
+        if (marker[jCol] == AMG_NO_AGGREGATE) {
+          marker[jCol] = c_col_ind.size();
+          c_col_ind.push_back(jCol);
+          c_val.resize(c_val.size()+bs, 0.0);
+          nRowBlocks++;
+        }
+        pos = marker[jCol];
+
+        gemm_impl<ScalarType>(nVar, &a_val[a_index*bs], &b_val[b_index*bs], &block[0]);
+        for (iVar = 0; iVar < bs; iVar++)
+          c_val[pos*bs+iVar] += block[iVar];
+      }
+    }
+
+    c_row_ptr[iRow+1] = c_col_ind.size();
+
+    for (pos = c_row_ptr[iRow]; pos < c_row_ptr[iRow+1]; pos++)
+      marker[c_col_ind[pos]] = AMG_NO_AGGREGATE;
+  }
+
+}
+
+template<class ScalarType>
+void CSysAMG<ScalarType>::SetDiagonal(CLevel & lvl) {
+
+  unsigned long iPoint, index, iVar;
+  const unsigned long bs = nVar*nVar;
+
+  lvl.dia_ptr.resize(lvl.nPoint);
+  lvl.invDiag.resize(lvl.nPoint*bs);
+
+  for (iPoint = 0; iPoint < lvl.nPoint; iPoint++) {
+
+    /*--- A missing diagonal block is treated as the identity. ---*/
+
+    for (iVar = 0; iVar < bs; iVar++) block[iVar] = 0.0;
+    for (iVar = 0; iVar < nVar; iVar++) block[iVar*nVar+iVar] = 1.0;
+
+    lvl.dia_ptr[iPoint] = AMG_NO_AGGREGATE;
+    for (index = lvl.row_ptr[iPoint]; index < lvl.row_ptr[iPoint+1]; index++) {
+      if (lvl.col_ind[index] == iPoint) {
+        lvl.dia_ptr[iPoint] = index;
+        for (iVar = 0; iVar < bs; iVar++) block[iVar] = lvl.matrix[index*bs+iVar];
+        break;
+      }
+    }
+
+    matrix_inverse_impl<ScalarType>(nVar, &block[0], &lvl.invDiag[iPoint*bs], &work[0]);
+  }
+
+}
+
+template<class ScalarType>
+unsigned long CSysAMG<ScalarType>::Aggregate(const CLevel & lvl, passivedouble strength, vector<unsigned long> & aggregate) const {
+
+  unsigned long iPoint, jPoint, index, iVar, nAggregate = 0;
+  const unsigned long bs = nVar*nVar;
+  const unsigned long nPoint = lvl.nPoint;
+  passivedouble norm, max_norm;
+  bool free_neighbors;
+
+  /*--- Frobenius norms of the blocks, a connection i-j is strong if
+   |A_ij| > strength * sqrt(|A_ii| |A_jj|). ---*/
+
+  vector<passivedouble> blockNorm(lvl.row_ptr[nPoint]), diagNorm(nPoint, 0.0);
+  vector<bool> strong(lvl.row_ptr[nPoint], false), isolated(nPoint, true);
+
+  for (index = 0; index < lvl.row_ptr[nPoint]; index++) {
+    norm = 0.0;
+    for (iVar = 0; iVar < bs; iVar++)
+      norm += pow(SU2_TYPE::GetValue(lvl.matrix[index*bs+iVar]), 2);
+    blockNorm[index] = sqrt(norm);
+  }
+
+  for (iPoint = 0; iPoint < nPoint; iPoint++)
+    if (lvl.dia_ptr[iPoint] != AMG_NO_AGGREGATE)
+      diagNorm[iPoint] = blockNorm[lvl.dia_ptr[iPoint]];
+
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    for (index = lvl.row_ptr[iPoint]; index < lvl.row_ptr[iPoint+1]; index++) {
+      jPoint = lvl.col_ind[index];
+      if ((jPoint != iPoint) && (blockNorm[index] > strength*sqrt(diagNorm[iPoint]*diagNorm[jPoint]))) {
+        strong[index] = true;
+        isolated[iPoint] = false;
+      }
+    }
+  }
+
+  aggregate.assign(nPoint, AMG_NO_AGGREGATE);
+
+  /*--- Phase 1, the points whose strong neighbors are all free form an
+   aggregate with them. ---*/
+
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    if (isolated[iPoint] || (aggregate[iPoint] != AMG_NO_AGGREGATE)) continue;
+
+    free_neighbors = true;
+    for (index = lvl.row_ptr[iPoint]; index < lvl.row_ptr[iPoint+1]; index++)
+      if (strong[index] && (aggregate[lvl.col_ind[index]] != AMG_NO_AGGREGATE)) {
+        free_neighbors = false;
+        break;
+      }
+    if (!free_neighbors) continue;
+
+    aggregate[iPoint] = nAggregate;
+    for (index = lvl.row_ptr[iPoint]; index < lvl.row_ptr[iPoint+1]; index++)
+      if (strong[index]) aggregate[lvl.col_ind[index]] = nAggregate;
+    nAggregate++;
+  }
+
+  /*--- Phase 2, the remaining points join the aggregate (from phase 1) of
+   their strongest neighbor. ---*/
+
+  vector<unsigned long> aggregate_phase1(aggregate);
+
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    if (isolated[iPoint] || (aggregate[iPoint] != AMG_NO_AGGREGATE)) continue;
+
+    max_norm = 0.0;
+    for (index = lvl.row_ptr[iPoint]; index < lvl.row_ptr[iPoint+1]; index++) {
+      jPoint = lvl.col_ind[index];
+      if (strong[index] && (aggregate_phase1[jPoint] != AMG_NO_AGGREGATE) && (blockNorm[index] > max_norm)) {
+        max_norm = blockNorm[index];
+        aggregate[iPoint] = aggregate_phase1[jPoint];
+      }
+    }
+  }
+
+  /*--- Phase 3, what is left forms aggregates with its free strong neighbors.
+   Isolated points (e.g. Dirichlet rows) are not represented on the coarse
+   level, the smoother takes care of them. ---*/
+
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    if (isolated[iPoint] || (aggregate[iPoint] != AMG_NO_AGGREGATE)) continue;
+
+    aggregate[iPoint] = nAggregate;
+    for (index = lvl.row_ptr[iPoint]; index < lvl.row_ptr[iPoint+1]; index++)
+      if (strong[index] && (aggregate[lvl.col_ind[index]] == AMG_NO_AGGREGATE))
+        aggregate[lvl.col_ind[index]] = nAggregate;
+    nAggregate++;
+  }
+
+  return nAggregate;
+
+}
+
+template<class ScalarType>
+ScalarType CSysAMG<ScalarType>::SpectralRadius(const CLevel & lvl) {
+
+  unsigned long iPoint, index, iVar, iIter;
+  const unsigned long bs = nVar*nVar;
+  const unsigned long nDOF = lvl.nPoint*nVar;
+  ScalarType norm = 0.0, rho = 1.0;
+
+  if (nDOF == 0) return rho;
+
+  /*--- Power iterations on D^-1 A from a (deterministic) non smooth vector. ---*/
+
+  vector<ScalarType> x(nDOF), y(nDOF);
+
+  for (iVar = 0; iVar < nDOF; iVar++) x[iVar] = 1.0 + 0.1*ScalarType(iVar % 7);
+
+  for (iIter = 0; iIter < 10; iIter++) {
+
+    norm = 0.0;
+    for (iVar = 0; iVar < nDOF; iVar++) norm += x[iVar]*x[iVar];
+    norm = sqrt(norm);
+    if (norm == 0.0) break;
+    for (iVar = 0; iVar < nDOF; iVar++) x[iVar] /= norm;
+
+    for (iPoint = 0; iPoint < lvl.nPoint; iPoint++) {
+      for (iVar = 0; iVar < nVar; iVar++) block[iVar] = 0.0;
+      for (index = lvl.row_ptr[iPoint]; index < lvl.row_ptr[iPoint+1]; index++)
+        gemv_impl<ScalarType,true,true,false>(nVar, &lvl.matrix[index*bs], &x[lvl.col_ind[index]*nVar], &block[0]);
+      gemv_impl<ScalarType,true,false,false>(nVar, &lvl.invDiag[iPoint*bs], &block[0], &y[iPoint*nVar]);
+    }
+
+    rho = 0.0;
+    for (iVar = 0; iVar < nDOF; iVar++) rho += y[iVar]*y[iVar];
+    rho = sqrt(rho);
+
+    x.swap(y);
+  }
+
+  return (rho > 0.0)? rho : ScalarType(1.0);
+
+}
+
+template<class ScalarType>
+void CSysAMG<ScalarType>::SetProlongation(CLevel & lvl, const vector<unsigned long> & aggregate, unsigned long nAggregate) {
+
+  unsigned long iPoint, index, iAgg, pos, iVar, begin;
+  const unsigned long bs = nVar*nVar;
+
+  /*--- Tentative prolongation, orthonormal columns that are constant over
+   each aggregate (one per variable). ---*/
+
+  vector<ScalarType> scale(nAggregate, 0.0);
+  for (iPoint = 0; iPoint < lvl.nPoint; iPoint++)
+    if (aggregate[iPoint] != AMG_NO_AGGREGATE) scale[aggregate[iPoint]] += 1.0;
+  for (iAgg = 0; iAgg < nAggregate; iAgg++)
+    scale[iAgg] = 1.0/sqrt(scale[iAgg]);
+
+  /*--- Damping of the Jacobi smoothing of the tentative prolongation. ---*/
+
+  const ScalarType omega = 4.0/(3.0*SpectralRadius(lvl));
+
+  /*--- Row i of P = P_tent - omega * D_i^-1 * (A P_tent)_i, with a dense
+   accumulator for the blocks of (A P_tent)_i. ---*/
+
+  vector<unsigned long> marker(nAggregate, AMG_NO_AGGREGATE);
+
+  lvl.P_row_ptr.assign(lvl.nPoint+1, 0);
+  lvl.P_col_ind.clear();
+  lvl.P_matrix.clear();
+
+  for (iPoint = 0; iPoint < lvl.nPoint; iPoint++) {
+
+    begin = lvl.P_col_ind.size();
+
+    for (index = lvl.row_ptr[iPoint]; index < lvl.row_ptr[iPoint+1]; index++) {
+      iAgg = aggregate[lvl.col_ind[index]];
+      if (iAgg == AMG_NO_AGGREGATE) continue;
+
+      if (marker[iAgg] == AMG_NO_AGGREGATE) {
+        marker[iAgg] = lvl.P_col_ind.size();
+        lvl.P_col_ind.push_back(iAgg);
+        lvl.P_matrix.resize(lvl.P_matrix.size()+bs, 0.0);
+      }
+      pos = marker[iAgg];
+
+      for (iVar = 0; iVar < bs; iVar++)
+        lvl.P_matrix[pos*bs+iVar] += scale[iAgg]*lvl.matrix[index*bs+iVar];
+    }
+
+    for (pos = begin; pos < lvl.P_col_ind.size(); pos++) {
+
+      gemm_impl<ScalarType>(nVar, &lvl.invDiag[iPoint*bs], &lvl.P_matrix[pos*bs], &block[0]);
+      for (iVar = 0; iVar < bs; iVar++)
+        lvl.P_matrix[pos*bs+iVar] = -omega*block[iVar];
+
+      iAgg = lvl.P_col_ind[pos];
+      if (iAgg == aggregate[iPoint])
+        for (iVar = 0; iVar < nVar; iVar++)
+          lvl.P_matrix[pos*bs+iVar*nVar+iVar] += scale[iAgg];
+
+      marker[iAgg] = AMG_NO_AGGREGATE;
+    }
+
+    lvl.P_row_ptr[iPoint+1] = lvl.P_col_ind.size();
+  }
+
+}
+
+template<class ScalarType>
+void CSysAMG<ScalarType>::SetCoarseOperator(const CLevel & fine, CLevel & coarse) {
+
+  unsigned long nCoarse = 0, index;
+
+  for (index = 0; index < fine.P_col_ind.size(); index++)
+    nCoarse = max(nCoarse, fine.P_col_ind[index]+1);
+
+  /*--- A_c = P^T (A P) ---*/
+
+  vector<unsigned long> ap_row_ptr, ap_col_ind, pt_row_ptr, pt_col_ind;
+  vector<ScalarType> ap_val, pt_val;
+
+  BlockSparseProduct(fine.nPoint, nCoarse, fine.row_ptr, fine.col_ind, fine.matrix,
+                     fine.P_row_ptr, fine.P_col_ind, fine.P_matrix, ap_row_ptr, ap_col_ind, ap_val);
+
+  BlockSparseTranspose(fine.nPoint, nCoarse, fine.P_row_ptr, fine.P_col_ind, fine.P_matrix,
+                       pt_row_ptr, pt_col_ind, pt_val);
+
+  coarse.nPoint = nCoarse;
+
+  BlockSparseProduct(nCoarse, nCoarse, pt_row_ptr, pt_col_ind, pt_val, ap_row_ptr, ap_col_ind, ap_val,
+                     coarse.row_ptr, coarse.col_ind, coarse.matrix);
+
+}
+
+template<class ScalarType>
+void CSysAMG<ScalarType>::FactorizeCoarse(void) {
+
+  unsigned long iPoint, index, iVar, jVar;
+  const unsigned long bs = nVar*nVar;
+  const CLevel & lvl = Level[nLevel-1];
+
+  nCoarseDOF = lvl.nPoint*nVar;
+  direct_coarse = (nCoarseDOF <= AMG_MAX_DIRECT_DOF);
+
+  CoarseLU.clear();
+  CoarsePivot.clear();
+
+  if (!direct_coarse) return;
+
+  /*--- Dense copy of the operator. ---*/
+
+  const unsigned long n = nCoarseDOF;
+  CoarseLU.assign(n*n, 0.0);
+
+  for (iPoint = 0; iPoint < lvl.nPoint; iPoint++)
+    for (index = lvl.row_ptr[iPoint]; index < lvl.row_ptr[iPoint+1]; index++)
+      for (iVar = 0; iVar < nVar; iVar++)
+        for (jVar = 0; jVar < nVar; jVar++)
+          CoarseLU[(iPoint*nVar+iVar)*n + lvl.col_ind[index]*nVar+jVar] = lvl.matrix[index*bs+iVar*nVar+jVar];
+
+  /*--- Zero pivots come from points without couplings. ---*/
+
+  DenseLUFactorize(n, CoarseLU, CoarsePivot);
+
+}
+
+template<class ScalarType>
+void CSysAMG<ScalarType>::DenseLUFactorize(unsigned long n, vector<ScalarType> & lu, vector<unsigned long> & pivot) {
+
+  unsigned long iRow, jRow, kRow, iPivot;
+  ScalarType weight;
+
+  pivot.resize(n);
+
+  for (kRow = 0; kRow < n; kRow++) {
+
+    iPivot = kRow;
+    for (iRow = kRow+1; iRow < n; iRow++)
+      if (fabs(lu[iRow*n+kRow]) > fabs(lu[iPivot*n+kRow])) iPivot = iRow;
+
+    pivot[kRow] = iPivot;
+    if (iPivot != kRow)
+      for (jRow = 0; jRow < n; jRow++)
+        swap(lu[kRow*n+jRow], lu[iPivot*n+jRow]);
+
+    if (lu[kRow*n+kRow] == 0.0) lu[kRow*n+kRow] = 1.0;
+
+    for (iRow = kRow+1; iRow < n; iRow++) {
+      weight = lu[iRow*n+kRow] / lu[kRow*n+kRow];
+      lu[iRow*n+kRow] = weight;
+      for (jRow = kRow+1; jRow < n; jRow++)
+        lu[iRow*n+jRow] -= weight*lu[kRow*n+jRow];
+    }
+  }
+
+}
+
+template<class ScalarType>
+void CSysAMG<ScalarType>::DenseLUSolve(unsigned long n, const vector<ScalarType> & lu,
+                                       const vector<unsigned long> & pivot, ScalarType *x) {
+
+  unsigned long iRow, jRow;
+
+  /*--- The multipliers of L were swapped with the rows, hence all the row
+   swaps are applied to the right hand side before the forward substitution. ---*/
+
+  for (iRow = 0; iRow < n; iRow++)
+    swap(x[iRow], x[pivot[iRow]]);
+
+  for (iRow = 0; iRow < n; iRow++)
+    for (jRow = iRow+1; jRow < n; jRow++)
+      x[jRow] -= lu[jRow*n+iRow]*x[iRow];
+
+  for (iRow = n; iRow-- > 0; ) {
+    for (jRow = iRow+1; jRow < n; jRow++)
+      x[iRow] -= lu[iRow*n+jRow]*x[jRow];
+    x[iRow] /= lu[iRow*n+iRow];
+  }
+
+}
+
+template<class ScalarType>
+void CSysAMG<ScalarType>::Smooth(CLevel & lvl, bool forward) {
+
+  unsigned long iPoint, index, iVar, iStep;
+  const unsigned long bs = nVar*nVar;
+
+  /*--- Block Gauss-Seidel, x_i += D_i^-1 (b_i - sum_j A_ij x_j). ---*/
+
+  for (iStep = 0; iStep < lvl.nPoint; iStep++) {
+
+    iPoint = forward? iStep : lvl.nPoint-1-iStep;
+
+    for (iVar = 0; iVar < nVar; iVar++)
+      block[iVar] = lvl.rhs[iPoint*nVar+iVar];
+
+    for (index = lvl.row_ptr[iPoint]; index < lvl.row_ptr[iPoint+1]; index++)
+      gemv_impl<ScalarType,false,true,false>(nVar, &lvl.matrix[index*bs], &lvl.sol[lvl.col_ind[index]*nVar], &block[0]);
+
+    gemv_impl<ScalarType,true,true,false>(nVar, &lvl.invDiag[iPoint*bs], &block[0], &lvl.sol[iPoint*nVar]);
+  }
+
+}
+
+template<class ScalarType>
+void CSysAMG<ScalarType>::Residual(CLevel & lvl) {
+
+  unsigned long iPoint, index, iVar;
+  const unsigned long bs = nVar*nVar;
+
+  for (iPoint = 0; iPoint < lvl.nPoint; iPoint++) {
+    for (iVar = 0; iVar < nVar; iVar++)
+      lvl.res[iPoint*nVar+iVar] = lvl.rhs[iPoint*nVar+iVar];
+
+    for (index = lvl.row_ptr[iPoint]; index < lvl.row_ptr[iPoint+1]; index++)
+      gemv_impl<ScalarType,false,true,false>(nVar, &lvl.matrix[index*bs], &lvl.sol[lvl.col_ind[index]*nVar], &lvl.res[iPoint*nVar]);
+  }
+
+}
+
+template<class ScalarType>
+void CSysAMG<ScalarType>::VCycle(unsigned short iLevel) {
+
+  unsigned long iPoint, index, iVar;
+  const unsigned long bs = nVar*nVar;
+  CLevel & lvl = Level[iLevel];
+
+  for (iVar = 0; iVar < lvl.sol.size(); iVar++) lvl.sol[iVar] = 0.0;
+
+  /*--- Coarsest level, exact solve or (if too large) a few symmetric sweeps. ---*/
+
+  if (iLevel == nLevel-1) {
+
+    if (direct_coarse) {
+      for (iVar = 0; iVar < nCoarseDOF; iVar++) lvl.sol[iVar] = lvl.rhs[iVar];
+      DenseLUSolve(nCoarseDOF, CoarseLU, CoarsePivot, &lvl.sol[0]);
+    }
+    else {
+      for (unsigned short iSweep = 0; iSweep < 5; iSweep++) {
+        Smooth(lvl, true);
+        Smooth(lvl, false);
+      }
+    }
+    return;
+  }
+
+  CLevel & coarse = Level[iLevel+1];
+
+  /*--- Pre-smoothing (forward) and restriction of the residual, r_c = P^T r. ---*/
+
+  Smooth(lvl, true);
+  Residual(lvl);
+
+  for (iVar = 0; iVar < coarse.rhs.size(); iVar++) coarse.rhs[iVar] = 0.0;
+
+  for (iPoint = 0; iPoint < lvl.nPoint; iPoint++)
+    for (index = lvl.P_row_ptr[iPoint]; index < lvl.P_row_ptr[iPoint+1]; index++)
+      gemv_impl<ScalarType,true,true,true>(nVar, &lvl.P_matrix[index*bs], &lvl.res[iPoint*nVar], &coarse.rhs[lvl.P_col_ind[index]*nVar]);
+
+  VCycle(iLevel+1);
+
+  /*--- Prolongation of the correction and post-smoothing (backward, so
+   that the cycle is symmetric for symmetric matrices). ---*/
+
+  for (iPoint = 0; iPoint < lvl.nPoint; iPoint++)
+    for (index = lvl.P_row_ptr[iPoint]; index < lvl.P_row_ptr[iPoint+1]; index++)
+      gemv_impl<ScalarType,true,true,false>(nVar, &lvl.P_matrix[index*bs], &coarse.sol[lvl.P_col_ind[index]*nVar], &lvl.sol[iPoint*nVar]);
+
+  Smooth(lvl, false);
+
+}
+
+template<class ScalarType>
+void CSysAMG<ScalarType>::Apply(const ScalarType *vec, ScalarType *prod) {
+
+  if (nLevel == 0) return;
+
+  CLevel & fine = Level[0];
+
+  for (unsigned long iVar = 0; iVar < fine.nPoint*nVar; iVar++)
+    fine.rhs[iVar] = vec[iVar];
+
+  VCycle(0);
+
+  for (unsigned long iVar = 0; iVar < fine.nPoint*nVar; iVar++)
+    prod[iVar] = fine.sol[iVar];
+
+}
+
+template<class ScalarType>
+void CSysAMG<ScalarType>::GetLevel(unsigned short iLevel, vector<unsigned long> & row_ptr, vector<unsigned long> & col_ind,
+                                   vector<ScalarType> & val, vector<unsigned long> & p_row_ptr, vector<unsigned long> & p_col_ind,
+                                   vector<ScalarType> & p_val) const {
+
+  const CLevel & lvl = Level[iLevel];
+
+  row_ptr = lvl.row_ptr; col_ind = lvl.col_ind; val = lvl.matrix;
+
+  if (iLevel+1 < nLevel) {
+    p_row_ptr = lvl.P_row_ptr; p_col_ind = lvl.P_col_ind; p_val = lvl.P_matrix;
+  }
+  else {
+    p_row_ptr.clear(); p_col_ind.clear(); p_val.clear();
+  }
+
+}
+
+template class CSysAMG<su2double>;
+
+#ifdef CODI_REVERSE_TYPE
+template class CSysAMG<passivedouble>;
+#endif
+
+#ifdef SU2_MIXED_PRECISION
+template class CSysAMG<su2mixedfloat>;
+#endif
@@ -36,6 +36,7 @@
  */
 
 #include "../../include/linear_algebra/CSysMatrix.inl"
+#include "../../include/linear_algebra/CSysAMG.hpp"
 
 template<class ScalarType>
 CSysMatrix<ScalarType>::CSysMatrix(void) {
@@ -51,8 +52,10 @@ CSysMatrix<ScalarType>::CSysMatrix(void) {
   ILU_matrix        = NULL;
   row_ptr           = NULL;
   col_ind           = NULL;
+  dia_ptr           = NULL;
   row_ptr_ilu       = NULL;
   col_ind_ilu       = NULL;
+  dia_ptr_ilu       = NULL;
   block             = NULL;
   prod_row_vector   = NULL;
   aux_vector        = NULL;
@@ -61,6 +64,14 @@ CSysMatrix<ScalarType>::CSysMatrix(void) {
   block_weight      = NULL;
   block_inverse     = NULL;
 
+  product_rows_ready     = false;
+  nProductRowsComm       = 0;
+  nProductTranspRowsComm = 0;
+
+  ilu_levels_ready = false;
+
+  amg = NULL;
+
 #ifdef USE_MKL
   MatrixMatrixProductJitter              = NULL;
   MatrixVectorProductJitterBetaOne       = NULL;
@@ -81,10 +92,12 @@ CSysMatrix<ScalarType>::~CSysMatrix(void) {
   if (ILU_matrix != NULL)         delete [] ILU_matrix;
   if (row_ptr != NULL)            delete [] row_ptr;
   if (col_ind != NULL)            delete [] col_ind;
+  if (dia_ptr != NULL)            delete [] dia_ptr;
 
   if (ilu_fill_in != 0) {
     if (row_ptr_ilu != NULL) delete [] row_ptr_ilu;
     if (col_ind_ilu != NULL) delete [] col_ind_ilu;
+    if (dia_ptr_ilu != NULL) delete [] dia_ptr_ilu;
   }
 
   if (block != NULL)              delete [] block;
@@ -96,6 +109,8 @@ CSysMatrix<ScalarType>::~CSysMatrix(void) {
   if (sum_vector != NULL)         delete [] sum_vector;
   if (invM != NULL)               delete [] invM;
 
+  if (amg != NULL)                delete amg;
+
 #ifdef USE_MKL
   if ( MatrixMatrixProductJitter != NULL )              mkl_jit_destroy( MatrixMatrixProductJitter );
   if ( MatrixVectorProductJitterBetaZero != NULL )      mkl_jit_destroy( MatrixVectorProductJitterBetaZero );
@@ -115,7 +130,8 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long nPoint, unsigned long nPoi
   /*--- Don't delete *row_ptr, *col_ind because they are
    asigned to the Jacobian structure. ---*/
 
-  unsigned long iPoint, *row_ptr, *col_ind, index, nnz, Elem, iVar;
+  unsigned long iPoint, index, nnz, Elem, iVar;
+  su2sparseidx *row_ptr, *col_ind;
   unsigned short iNeigh, iElem, iNode, *nNeigh, *nNeigh_ilu;
   vector<unsigned long>::iterator it;
   vector<unsigned long> vneighs, vneighs_ilu;
@@ -151,15 +167,21 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long nPoint, unsigned long nPoi
 
   /*--- Create row_ptr structure, using the number of neighbors ---*/
 
-  row_ptr = new unsigned long [nPoint+1];
+  nnz = 0;
+  for (iPoint = 0; iPoint < nPoint; iPoint++)
+    nnz += nNeigh[iPoint];
+
+  if (nnz > numeric_limits<su2sparseidx>::max())
+    SU2_MPI::Error("The sparse structure of this rank does not fit in 32 bit indices, use more ranks or configure with --enable-long-sparse-index.", CURRENT_FUNCTION);
+
+  row_ptr = new su2sparseidx [nPoint+1];
   row_ptr[0] = 0;
   for (iPoint = 0; iPoint < nPoint; iPoint++)
     row_ptr[iPoint+1] = row_ptr[iPoint] + nNeigh[iPoint];
-  nnz = row_ptr[nPoint];
 
   /*--- Create col_ind structure ---*/
 
-  col_ind = new unsigned long [nnz];
+  col_ind = new su2sparseidx [nnz];
   for (iPoint = 0; iPoint < nPoint; iPoint++) {
 
     vneighs.clear();
@@ -194,6 +216,9 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long nPoint, unsigned long nPoi
 
   SetIndexes(nPoint, nPointDomain, nVar, nEqn, row_ptr, col_ind, nnz, config);
 
+  product_rows_ready = false;
+  ilu_levels_ready   = false;
+
   /*--- Generate MKL Kernels ---*/
 
 #ifdef USE_MKL
@@ -237,15 +262,21 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long nPoint, unsigned long nPoi
 
     }
 
-    row_ptr_ilu = new unsigned long [nPoint+1];
+    nnz_ilu = 0;
+    for (iPoint = 0; iPoint < nPoint; iPoint++)
+      nnz_ilu += nNeigh_ilu[iPoint];
+
+    if (nnz_ilu > numeric_limits<su2sparseidx>::max())
+      SU2_MPI::Error("The ILU structure of this rank does not fit in 32 bit indices, reduce the fill in or configure with --enable-long-sparse-index.", CURRENT_FUNCTION);
+
+    row_ptr_ilu = new su2sparseidx [nPoint+1];
     row_ptr_ilu[0] = 0;
     for (iPoint = 0; iPoint < nPoint; iPoint++)
       row_ptr_ilu[iPoint+1] = row_ptr_ilu[iPoint] + nNeigh_ilu[iPoint];
-    nnz_ilu = row_ptr_ilu[nPoint];
 
     /*--- Create col_ind structure ---*/
 
-    col_ind_ilu = new unsigned long [nnz_ilu];
+    col_ind_ilu = new su2sparseidx [nnz_ilu];
     for (iPoint = 0; iPoint < nPoint; iPoint++) {
 
       vneighs_ilu.clear();
@@ -262,6 +293,8 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long nPoint, unsigned long nPoi
 
     }
 
+    dia_ptr_ilu = SetDiagonalPointers(row_ptr_ilu, col_ind_ilu);
+
     ILU_matrix = new ScalarType [nnz_ilu*nVar*nEqn];
     for (iVar = 0; iVar < nnz_ilu*nVar*nEqn; iVar++) ILU_matrix[iVar] = 0.0;
 
@@ -300,7 +333,26 @@ void CSysMatrix<ScalarType>::SetNeighbours(CGeometry *geometry, unsigned long iP
 }
 
 template<class ScalarType>
-void CSysMatrix<ScalarType>::SetIndexes(unsigned long val_nPoint, unsigned long val_nPointDomain, unsigned short val_nVar, unsigned short val_nEq, unsigned long* val_row_ptr, unsigned long* val_col_ind, unsigned long val_nnz, CConfig *config) {
+su2sparseidx *CSysMatrix<ScalarType>::SetDiagonalPointers(const su2sparseidx *ptr, const su2sparseidx *ind) const {
+
+  /*--- The diagonal is always part of the structure (the point is its own neighbour). ---*/
+
+  su2sparseidx *dia = new su2sparseidx [nPoint];
+
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+    for (unsigned long index = ptr[iPoint]; index < ptr[iPoint+1]; index++) {
+      if (ind[index] == iPoint) {
+        dia[iPoint] = index;
+        break;
+      }
+    }
+  }
+
+  return dia;
+}
+
+template<class ScalarType>
+void CSysMatrix<ScalarType>::SetIndexes(unsigned long val_nPoint, unsigned long val_nPointDomain, unsigned short val_nVar, unsigned short val_nEq, su2sparseidx* val_row_ptr, su2sparseidx* val_col_ind, unsigned long val_nnz, CConfig *config) {
 
   unsigned long iVar;
 
@@ -312,10 +364,12 @@ void CSysMatrix<ScalarType>::SetIndexes(unsigned long val_nPoint, unsigned long
   row_ptr      = val_row_ptr;       // Assign row values in the spare system structure (Jacobian structure)
   col_ind      = val_col_ind;       // Assign colums values in the spare system structure (Jacobian structure)
   nnz          = val_nnz;           // Assign number of possible non zero blocks in the spare system structure (Jacobian structure)
+  dia_ptr      = SetDiagonalPointers(row_ptr, col_ind);
 
   if (ilu_fill_in == 0) {
     row_ptr_ilu  = val_row_ptr;       // Assign row values in the spare system structure (ILU structure)
     col_ind_ilu  = val_col_ind;       // Assign colums values in the spare system structure (ILU structure)
+    dia_ptr_ilu  = dia_ptr;           // The ILU(0) structure is the one of the Jacobian
     nnz_ilu      = val_nnz;           // Assign number of possible non zero blocks in the spare system structure (ILU structure)
   }
 
@@ -541,8 +595,7 @@ void CSysMatrix<ScalarType>::CompleteComms(CSysVector<OtherType> & x,
   unsigned short iVar;
   unsigned long iPoint, iRecv, nRecv, msg_offset, buf_offset;
 
-  int ind, source, iMessage, jRecv;
-  SU2_MPI::Status status;
+  int source, iMessage, jRecv;
 
   /*--- Set some local pointers to make access simpler. ---*/
 
@@ -556,14 +609,9 @@ void CSysMatrix<ScalarType>::CompleteComms(CSysVector<OtherType> & x,
     for (iMessage = 0; iMessage < geometry->nP2PRecv; iMessage++) {
 
       /*--- For efficiency, recv the messages dynamically based on
-       the order they arrive. ---*/
-
-      SU2_MPI::Waitany(geometry->nP2PRecv, geometry->req_P2PRecv,
-                       &ind, &status);
-
-      /*--- Once we have recv'd a message, get the source rank. ---*/
+       the order they arrive, and get the source rank. ---*/
 
-      source = status.MPI_SOURCE;
+      source = geometry->WaitAnyP2PRecv();
 
       switch (commType) {
         case SOLUTION_MATRIX:
@@ -648,9 +696,7 @@ void CSysMatrix<ScalarType>::CompleteComms(CSysVector<OtherType> & x,
      Note that this should be satisfied, as we have received all of the
      data in the loop above at this point. ---*/
 
-#ifdef HAVE_MPI
-    SU2_MPI::Waitall(geometry->nP2PSend, geometry->req_P2PSend, MPI_STATUS_IGNORE);
-#endif
+    geometry->WaitAllP2PSends();
 
   }
 
@@ -663,12 +709,11 @@ void CSysMatrix<ScalarType>::DeleteValsRowi(unsigned long i) {
   unsigned long row = i - block_i*nVar;
   unsigned long index, iVar;
 
-  for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
+  for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++)
     for (iVar = 0; iVar < nVar; iVar++)
       matrix[index*nVar*nVar+row*nVar+iVar] = 0.0; // Delete row values in the block
-    if (col_ind[index] == block_i)
-      matrix[index*nVar*nVar+row*nVar+row] = 1.0; // Set 1 to the diagonal element
-  }
+
+  matrix[dia_ptr[block_i]*nVar*nVar+row*nVar+row] = 1.0; // Set 1 to the diagonal element
 
 }
 
@@ -680,11 +725,9 @@ void CSysMatrix<ScalarType>::UpperProduct(const CSysVector<ScalarType> & vec, un
   for (iVar = 0; iVar < nVar; iVar++)
     prod_row_vector[iVar] = 0;
 
-  for (index = row_ptr[row_i]; index < row_ptr[row_i+1]; index++) {
+  for (index = dia_ptr[row_i]+1; index < row_ptr[row_i+1]; index++) {
     col_j = col_ind[index];
-    if (col_j > row_i) {
-      MatrixVectorProductAdd(&matrix[index*nVar*nVar], &vec[col_j*nVar], prod_row_vector);
-    }
+    MatrixVectorProductAdd(&matrix[index*nVar*nVar], &vec[col_j*nVar], prod_row_vector);
   }
 
 }
@@ -697,11 +740,9 @@ void CSysMatrix<ScalarType>::LowerProduct(const CSysVector<ScalarType> & vec, un
   for (iVar = 0; iVar < nVar; iVar++)
     prod_row_vector[iVar] = 0;
 
-  for (index = row_ptr[row_i]; index < row_ptr[row_i+1]; index++) {
+  for (index = row_ptr[row_i]; index < dia_ptr[row_i]; index++) {
     col_j = col_ind[index];
-    if (col_j < row_i) {
-      MatrixVectorProductAdd(&matrix[index*nVar*nVar], &vec[col_j*nVar], prod_row_vector);
-    }
+    MatrixVectorProductAdd(&matrix[index*nVar*nVar], &vec[col_j*nVar], prod_row_vector);
   }
 
 }
@@ -709,12 +750,7 @@ void CSysMatrix<ScalarType>::LowerProduct(const CSysVector<ScalarType> & vec, un
 template<class ScalarType>
 void CSysMatrix<ScalarType>::DiagonalProduct(const CSysVector<ScalarType> & vec, unsigned long row_i) {
 
-  for (unsigned long index = row_ptr[row_i]; index < row_ptr[row_i+1]; index++) {
-    if (col_ind[index] == row_i) {
-      MatrixVectorProduct(&matrix[index*nVar*nVar], &vec[row_i*nVar], prod_row_vector);
-      break;
-    }
-  }
+  MatrixVectorProduct(&matrix[dia_ptr[row_i]*nVar*nVar], &vec[row_i*nVar], prod_row_vector);
 
 }
 
@@ -736,8 +772,6 @@ void CSysMatrix<ScalarType>::RowProduct(const CSysVector<ScalarType> & vec, unsi
 template<class ScalarType>
 void CSysMatrix<ScalarType>::MatrixVectorProduct(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod, CGeometry *geometry, CConfig *config) {
 
-  unsigned long prod_begin, vec_begin, mat_begin, index, row_i;
-
   /*--- Some checks for consistency between CSysMatrix and the CSysVector<ScalarType>s ---*/
   if ( (nVar != vec.GetNVar()) || (nVar != prod.GetNVar()) ) {
     cerr << "CSysMatrix<ScalarType>::MatrixVectorProduct(const CSysVector<ScalarType>&, CSysVector<ScalarType>): "
@@ -750,19 +784,20 @@ void CSysMatrix<ScalarType>::MatrixVectorProduct(const CSysVector<ScalarType> &
     throw(-1);
   }
 
+  if (!product_rows_ready) SetProductRows(geometry);
+
   prod = ScalarType(0.0); // set all entries of prod to zero
-  for (row_i = 0; row_i < nPointDomain; row_i++) {
-    prod_begin = row_i*nVar; // offset to beginning of block row_i
-    for (index = row_ptr[row_i]; index < row_ptr[row_i+1]; index++) {
-      vec_begin = col_ind[index]*nVar; // offset to beginning of block col_ind[index]
-      mat_begin = (index*nVar*nVar); // offset to beginning of matrix block[row_i][col_ind[indx]]
-      MatrixVectorProductAdd(&matrix[mat_begin], &vec[vec_begin], &prod[prod_begin]);
-    }
-  }
 
-  /*--- MPI Parallelization ---*/
+  /*--- Compute first the rows that are sent to other ranks and start their
+   non-blocking communication, the product of the interior rows is computed
+   while the messages are in flight. ---*/
+
+  RowsVectorProduct(vec, prod, ProductRows, 0, nProductRowsComm, false);
 
   InitiateComms(prod, geometry, config, SOLUTION_MATRIX);
+
+  RowsVectorProduct(vec, prod, ProductRows, nProductRowsComm, nPointDomain, false);
+
   CompleteComms(prod, geometry, config, SOLUTION_MATRIX);
 
 }
@@ -770,8 +805,6 @@ void CSysMatrix<ScalarType>::MatrixVectorProduct(const CSysVector<ScalarType> &
 template<class ScalarType>
 void CSysMatrix<ScalarType>::MatrixVectorProductTransposed(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod, CGeometry *geometry, CConfig *config) {
 
-  unsigned long prod_begin, vec_begin, mat_begin, index, row_i;
-
   /*--- Some checks for consistency between CSysMatrix and the CSysVector<ScalarType>s ---*/
   if ( (nVar != vec.GetNVar()) || (nVar != prod.GetNVar()) ) {
     SU2_MPI::Error("nVar values incompatible.", CURRENT_FUNCTION);
@@ -780,23 +813,75 @@ void CSysMatrix<ScalarType>::MatrixVectorProductTransposed(const CSysVector<Scal
     SU2_MPI::Error("nPoint and nBlk values incompatible.", CURRENT_FUNCTION);
   }
 
+  if (!product_rows_ready) SetProductRows(geometry);
+
   prod = ScalarType(0.0); // set all entries of prod to zero
-  for (row_i = 0; row_i < nPointDomain; row_i++) {
-    vec_begin = row_i*nVar; // offset to beginning of block col_ind[index]
-    for (index = row_ptr[row_i]; index < row_ptr[row_i+1]; index++) {
-      prod_begin = col_ind[index]*nVar; // offset to beginning of block row_i
-      mat_begin = (index*nVar*nVar); // offset to beginning of matrix block[row_i][col_ind[indx]]
-      MatrixVectorProductTransp(&matrix[mat_begin], &vec[vec_begin], &prod[prod_begin]);
-    }
-  }
 
-  /*--- MPI Parallelization ---*/
+  /*--- The contributions to the halo points come from the rows coupled to
+   them, which are computed first. The rest overlaps with the (reverse)
+   communication, which adds the halo contributions to the domain points. ---*/
+
+  RowsVectorProduct(vec, prod, ProductTranspRows, 0, nProductTranspRowsComm, true);
 
   InitiateComms(prod, geometry, config, SOLUTION_MATRIXTRANS);
+
+  RowsVectorProduct(vec, prod, ProductTranspRows, nProductTranspRowsComm, nPointDomain, true);
+
   CompleteComms(prod, geometry, config, SOLUTION_MATRIXTRANS);
 
 }
 
+template<class ScalarType>
+void CSysMatrix<ScalarType>::SetProductRows(CGeometry *geometry) {
+
+  unsigned long iPoint, index;
+  int iMessage, iSend;
+
+  vector<bool> isCommRow(nPointDomain, false);
+
+  /*--- Direct product, the rows of the points that are sent to other ranks. ---*/
+
+  for (iMessage = 0; iMessage < geometry->nP2PSend; iMessage++) {
+    for (iSend = geometry->nPoint_P2PSend[iMessage]; iSend < geometry->nPoint_P2PSend[iMessage+1]; iSend++) {
+      iPoint = geometry->Local_Point_P2PSend[iSend];
+      if (iPoint < nPointDomain) isCommRow[iPoint] = true;
+    }
+  }
+
+  ProductRows.clear();
+  ProductRows.reserve(nPointDomain);
+
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+    if (isCommRow[iPoint]) ProductRows.push_back(iPoint);
+
+  nProductRowsComm = ProductRows.size();
+
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+    if (!isCommRow[iPoint]) ProductRows.push_back(iPoint);
+
+  /*--- Transposed product, the rows with a column of a halo point. ---*/
+
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    isCommRow[iPoint] = false;
+    for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++)
+      if (col_ind[index] >= nPointDomain) isCommRow[iPoint] = true;
+  }
+
+  ProductTranspRows.clear();
+  ProductTranspRows.reserve(nPointDomain);
+
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+    if (isCommRow[iPoint]) ProductTranspRows.push_back(iPoint);
+
+  nProductTranspRowsComm = ProductTranspRows.size();
+
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+    if (!isCommRow[iPoint]) ProductTranspRows.push_back(iPoint);
+
+  product_rows_ready = true;
+
+}
+
 template<class ScalarType>
 void CSysMatrix<ScalarType>::BuildJacobiPreconditioner(bool transpose) {
 
@@ -820,137 +905,233 @@ void CSysMatrix<ScalarType>::ComputeJacobiPreconditioner(const CSysVector<Scalar
 }
 
 template<class ScalarType>
-void CSysMatrix<ScalarType>::BuildILUPreconditioner(bool transposed) {
+void CSysMatrix<ScalarType>::SetILULevels(void) {
 
-  unsigned long index, index_, iVar;
-  ScalarType *Block_ij;
-  const ScalarType *Block_jk;
-  long iPoint, jPoint, kPoint;
-
-  /*--- Copy block matrix, note that the original matrix
-   is modified by the algorithm, so that we have the factorization stored
-   in the ILUMatrix at the end of this preprocessing. ---*/
-
-  for (iVar = 0; iVar < nnz_ilu*nVar*nEqn; iVar++) ILU_matrix[iVar] = 0.0;
-
-  for (iPoint = 0; iPoint < (long)nPointDomain; iPoint++) {
-    for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++) {
-      jPoint = col_ind[index];
-      if (transposed) {
-        Block_ij = GetBlock(jPoint, iPoint);
-        SetBlockTransposed_ILUMatrix(iPoint, jPoint, Block_ij);
-      } else {
-        Block_ij = GetBlock(iPoint, jPoint);
-        SetBlock_ILUMatrix(iPoint, jPoint, Block_ij);
-      }
+  unsigned long iPoint, jPoint, index, iLevel, nLevel;
+  long lPoint;
+
+  vector<unsigned long> level(nPointDomain, 0);
+
+  /*--- Forward sweeps, the level of a row is one more than the largest level
+   of the (lower) rows it depends on. ---*/
+
+  nLevel = 0;
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    for (index = row_ptr_ilu[iPoint]; index < row_ptr_ilu[iPoint+1]; index++) {
+      jPoint = col_ind_ilu[index];
+      if (jPoint < iPoint) level[iPoint] = max(level[iPoint], level[jPoint]+1);
     }
+    nLevel = max(nLevel, level[iPoint]+1);
   }
 
-  /*--- Transform system in Upper Matrix ---*/
+  ILULowerLevelPtr.assign(nLevel+1, 0);
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) ILULowerLevelPtr[level[iPoint]+1]++;
+  for (iLevel = 0; iLevel < nLevel; iLevel++) ILULowerLevelPtr[iLevel+1] += ILULowerLevelPtr[iLevel];
 
-  for (iPoint = 1; iPoint < (long)nPointDomain; iPoint++) {
+  ILULowerRows.resize(nPointDomain);
+  vector<unsigned long> next(ILULowerLevelPtr.begin(), ILULowerLevelPtr.end()-1);
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) ILULowerRows[next[level[iPoint]]++] = iPoint;
 
-    /*--- Invert and store the previous diagonal block to later compute the weight. ---*/
+  /*--- Backward sweep, same thing with the upper rows (halo columns excluded). ---*/
 
-    InverseDiagonalBlock_ILUMatrix(iPoint-1, &invM[(iPoint-1)*nVar*nVar]);
-
-    /*--- For each row (unknown), loop over all entries in A on this row
-     row_ptr_ilu[iPoint+1] will have the index for the first entry on the next
-     row. ---*/
+  level.assign(nPointDomain, 0);
 
+  nLevel = 0;
+  for (lPoint = long(nPointDomain)-1; lPoint >= 0; lPoint--) {
+    iPoint = lPoint;
     for (index = row_ptr_ilu[iPoint]; index < row_ptr_ilu[iPoint+1]; index++) {
+      jPoint = col_ind_ilu[index];
+      if ((jPoint > iPoint) && (jPoint < nPointDomain)) level[iPoint] = max(level[iPoint], level[jPoint]+1);
+    }
+    nLevel = max(nLevel, level[iPoint]+1);
+  }
 
-      /*--- jPoint here is the column for each entry on this row ---*/
+  ILUUpperLevelPtr.assign(nLevel+1, 0);
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) ILUUpperLevelPtr[level[iPoint]+1]++;
+  for (iLevel = 0; iLevel < nLevel; iLevel++) ILUUpperLevelPtr[iLevel+1] += ILUUpperLevelPtr[iLevel];
 
-      jPoint = col_ind_ilu[index];
+  ILUUpperRows.resize(nPointDomain);
+  next.assign(ILUUpperLevelPtr.begin(), ILUUpperLevelPtr.end()-1);
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) ILUUpperRows[next[level[iPoint]]++] = iPoint;
 
-      /*--- Check that this column is in the lower triangular portion ---*/
+  /*--- Work arrays for each thread ---*/
 
-      if (jPoint < iPoint) {
+  ILU_work.resize(omp_get_max_threads()*3*nVar*nVar);
 
-        /*--- If we're in the lower triangle, multiply the block by
-         the inverse of the corresponding diagonal block. ---*/
+  ilu_levels_ready = true;
+
+}
 
-        Block_ij = &ILU_matrix[index*nVar*nEqn];
-        MatrixMatrixProduct(Block_ij, &invM[jPoint*nVar*nVar], block_weight);
+template<class ScalarType>
+void CSysMatrix<ScalarType>::FactorizeILURow(unsigned long iPoint, ScalarType *work) {
 
-        /*--- block_weight holds Aij*inv(Ajj). Jump to the row for jPoint ---*/
+  unsigned long index, index_, index_ik, iVar, jPoint, kPoint;
+  ScalarType *Block_ij;
+  const ScalarType *Block_jk;
 
-        for (index_ = row_ptr_ilu[jPoint]; index_ < row_ptr_ilu[jPoint+1]; index_++) {
+  ScalarType *weight = work;
+  ScalarType *prod = &work[nVar*nEqn];
+  ScalarType *inv_work = &work[2*nVar*nEqn];
 
-          /*--- Get the column of the entry ---*/
+  /*--- For each row (unknown), loop over the entries of the lower
+   triangular portion, which end at the diagonal of the row. ---*/
 
-          kPoint = col_ind_ilu[index_];
+  for (index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
 
-          /*--- If the column is greater than or equal to jPoint, i.e., the
-           upper triangular part, then multiply and modify the matrix.
-           Here, Aik' = Aik - Aij*inv(Ajj)*Ajk. ---*/
+    /*--- jPoint here is the column for each entry on this row ---*/
 
-          if (kPoint > jPoint) {
+    jPoint = col_ind_ilu[index];
 
-            Block_jk = &ILU_matrix[index_*nVar*nEqn];
-            MatrixMatrixProduct(block_weight, Block_jk, block);
-            SubtractBlock_ILUMatrix(iPoint, kPoint, block);
+    /*--- Multiply the block by the inverse of the corresponding diagonal block. ---*/
 
-          }
-        }
+    Block_ij = &ILU_matrix[index*nVar*nEqn];
+    MatrixMatrixProduct(Block_ij, &invM[jPoint*nVar*nVar], weight);
 
-        /*--- Lastly, store block_weight in the lower triangular part, which
-         will be reused during the forward solve in the precon/smoother. ---*/
+    /*--- weight holds Aij*inv(Ajj). Jump to the upper triangular part of the
+     row for jPoint, multiply and modify the matrix, Aik' = Aik - Aij*inv(Ajj)*Ajk.
+     The columns of both rows are sorted, Aik is found by advancing through
+     row iPoint (from Aij) instead of searching the row for each kPoint. ---*/
 
-        for (iVar = 0; iVar < nVar*nEqn; ++iVar)
-          Block_ij[iVar] = block_weight[iVar];
+    index_ik = index+1;
 
+    for (index_ = dia_ptr_ilu[jPoint]+1; index_ < row_ptr_ilu[jPoint+1]; index_++) {
+
+      kPoint = col_ind_ilu[index_];
+
+      while ((index_ik < row_ptr_ilu[iPoint+1]) && (col_ind_ilu[index_ik] < kPoint)) index_ik++;
+
+      if ((index_ik < row_ptr_ilu[iPoint+1]) && (col_ind_ilu[index_ik] == kPoint)) {
+        Block_jk = &ILU_matrix[index_*nVar*nEqn];
+        MatrixMatrixProduct(weight, Block_jk, prod);
+        MatrixSubtraction(&ILU_matrix[index_ik*nVar*nEqn], prod, &ILU_matrix[index_ik*nVar*nEqn]);
       }
     }
+
+    /*--- Lastly, store weight in the lower triangular part, which
+     will be reused during the forward solve in the precon/smoother. ---*/
+
+    for (iVar = 0; iVar < nVar*nEqn; ++iVar)
+      Block_ij[iVar] = weight[iVar];
+
   }
 
-  InverseDiagonalBlock_ILUMatrix(nPointDomain-1, &invM[(nPointDomain-1)*nVar*nVar]);
+  /*--- The row is final, invert and store its diagonal block to later
+   compute the weights of the rows that depend on it. The thread private
+   work array is used instead of the shared "block". ---*/
+
+  block_matrix_inverse<ScalarType>(nVar, &ILU_matrix[dia_ptr_ilu[iPoint]*nVar*nEqn], &invM[iPoint*nVar*nVar], inv_work);
+
+}
+
+template<class ScalarType>
+void CSysMatrix<ScalarType>::BuildILUPreconditioner(bool transposed) {
+
+  if (!ilu_levels_ready) SetILULevels();
+
+  /*--- The rows of a level are independent, each thread factorizes a part
+   of each level. The level order is a reordering of the sequential sweep
+   (the rows a row depends on are still factorized before it), so the
+   factorization does not depend on the number of threads. ---*/
+
+  SU2_OMP_PARALLEL
+  {
+    ScalarType *work = &ILU_work[omp_get_thread_num()*3*nVar*nVar];
+
+    /*--- Copy block matrix, note that the original matrix
+     is modified by the algorithm, so that we have the factorization stored
+     in the ILUMatrix at the end of this preprocessing. The pattern of the
+     matrix is contained in the ILU pattern (equal for ILU(0)) and both are
+     sorted, the position of each block in the ILU row is found by advancing
+     through it rather than by searching. ---*/
+
+    SU2_OMP_FOR_STAT
+    for (unsigned long iVar = 0; iVar < nnz_ilu*nVar*nEqn; iVar++) ILU_matrix[iVar] = 0.0;
+
+    SU2_OMP_FOR_STAT
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      unsigned long index_ilu = row_ptr_ilu[iPoint];
+      for (unsigned long index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++) {
+        unsigned long jPoint = col_ind[index];
+        while (col_ind_ilu[index_ilu] != jPoint) index_ilu++;
+
+        ScalarType *ilu_ij = &ILU_matrix[index_ilu*nVar*nEqn];
+        if (transposed) {
+          const ScalarType *mat_ji = MatrixBlock(jPoint, iPoint);
+          for (unsigned long iVar = 0; iVar < nVar; iVar++)
+            for (unsigned long jVar = 0; jVar < nEqn; jVar++)
+              ilu_ij[iVar*nEqn+jVar] = mat_ji[jVar*nVar+iVar];
+        } else {
+          const ScalarType *mat_ij = &matrix[index*nVar*nEqn];
+          for (unsigned long iVar = 0; iVar < nVar*nEqn; iVar++)
+            ilu_ij[iVar] = mat_ij[iVar];
+        }
+      }
+    }
+
+    /*--- Transform system in Upper Matrix, level by level ---*/
+
+    for (unsigned long iLevel = 0; iLevel+1 < ILULowerLevelPtr.size(); iLevel++) {
+
+      SU2_OMP_FOR_STAT
+      for (unsigned long iRow = ILULowerLevelPtr[iLevel]; iRow < ILULowerLevelPtr[iLevel+1]; iRow++)
+        FactorizeILURow(ILULowerRows[iRow], work);
+    }
+  }
 
 }
 
 template<class ScalarType>
 void CSysMatrix<ScalarType>::ComputeILUPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod, CGeometry *geometry, CConfig *config) {
 
-  unsigned long index, iVar;
-  const ScalarType *Block_ij;
-  long iPoint, jPoint;
+  if (!ilu_levels_ready) SetILULevels();
 
-  /*--- Copy vector to then work on prod in place ---*/
+  SU2_OMP_PARALLEL
+  {
+    ScalarType *sum = &ILU_work[omp_get_thread_num()*3*nVar*nVar];
 
-  for (iPoint = 0; iPoint < long(nPointDomain*nVar); iPoint++)
-    prod[iPoint] = vec[iPoint];
+    /*--- Copy vector to then work on prod in place ---*/
 
-  /*--- Forward solve the system using the lower matrix entries that
-   were computed and stored during the ILU preprocessing. Note
-   that we are overwriting the residual vector as we go. ---*/
+    SU2_OMP_FOR_STAT
+    for (unsigned long iVar = 0; iVar < nPointDomain*nVar; iVar++)
+      prod[iVar] = vec[iVar];
 
-  for (iPoint = 1; iPoint < (long)nPointDomain; iPoint++) {
-    for (index = row_ptr_ilu[iPoint]; index < row_ptr_ilu[iPoint+1]; index++) {
-      jPoint = col_ind_ilu[index];
-      if (jPoint < iPoint) {
-        Block_ij = &ILU_matrix[index*nVar*nEqn];
-        MatrixVectorProductSub(Block_ij, &prod[jPoint*nVar], &prod[iPoint*nVar]);
+    /*--- Forward solve the system using the lower matrix entries that
+     were computed and stored during the ILU preprocessing. Note
+     that we are overwriting the residual vector as we go. The rows
+     of each level only depend on rows of previous levels. ---*/
+
+    for (unsigned long iLevel = 0; iLevel+1 < ILULowerLevelPtr.size(); iLevel++) {
+
+      SU2_OMP_FOR_STAT
+      for (unsigned long iRow = ILULowerLevelPtr[iLevel]; iRow < ILULowerLevelPtr[iLevel+1]; iRow++) {
+        unsigned long iPoint = ILULowerRows[iRow];
+        for (unsigned long index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
+          unsigned long jPoint = col_ind_ilu[index];
+          MatrixVectorProductSub(&ILU_matrix[index*nVar*nEqn], &prod[jPoint*nVar], &prod[iPoint*nVar]);
+        }
       }
     }
-  }
 
-  /*--- Backwards substitution (starts at the last row) ---*/
+    /*--- Backwards substitution, same idea with the levels of the upper part ---*/
 
-  for (iPoint = nPointDomain-1; iPoint >= 0; iPoint--) {
+    for (unsigned long iLevel = 0; iLevel+1 < ILUUpperLevelPtr.size(); iLevel++) {
 
-    for (iVar = 0; iVar < nVar; iVar++)
-      sum_vector[iVar] = prod[iPoint*nVar+iVar];
+      SU2_OMP_FOR_STAT
+      for (unsigned long iRow = ILUUpperLevelPtr[iLevel]; iRow < ILUUpperLevelPtr[iLevel+1]; iRow++) {
+        unsigned long iPoint = ILUUpperRows[iRow];
 
-    for (index = row_ptr_ilu[iPoint]; index < row_ptr_ilu[iPoint+1]; index++) {
-      jPoint = col_ind_ilu[index];
-      if ((jPoint >= iPoint+1) && (jPoint < (long)nPointDomain)) {
-        Block_ij = &ILU_matrix[index*nVar*nEqn];
-        MatrixVectorProductSub(Block_ij, &prod[jPoint*nVar], sum_vector);
+        for (unsigned long iVar = 0; iVar < nVar; iVar++)
+          sum[iVar] = prod[iPoint*nVar+iVar];
+
+        for (unsigned long index = dia_ptr_ilu[iPoint]+1; index < row_ptr_ilu[iPoint+1]; index++) {
+          unsigned long jPoint = col_ind_ilu[index];
+          if (jPoint < nPointDomain)
+            MatrixVectorProductSub(&ILU_matrix[index*nVar*nEqn], &prod[jPoint*nVar], sum);
+        }
+
+        MatrixVectorProduct(&invM[iPoint*nVar*nVar], sum, &prod[iPoint*nVar]);
       }
     }
-
-    MatrixVectorProduct(&invM[iPoint*nVar*nVar], sum_vector, &prod[iPoint*nVar]);
   }
 
   /*--- MPI Parallelization ---*/
@@ -1276,6 +1457,35 @@ void CSysMatrix<ScalarType>::ComputeLineletPreconditioner(const CSysVector<Scala
 
 }
 
+template<class ScalarType>
+void CSysMatrix<ScalarType>::BuildAMGPreconditioner(CConfig *config, bool transposed) {
+
+  /*--- The hierarchy is allocated on the first call and rebuilt (the
+   pattern of the matrix may be the same but the values are not). ---*/
+
+  if (amg == NULL) amg = new CSysAMG<ScalarType>();
+
+  amg->Build(nPointDomain, nVar, row_ptr, col_ind, matrix, transposed,
+             config->GetLinear_Solver_AMG_Levels(),
+             SU2_TYPE::GetValue(config->GetLinear_Solver_AMG_Strength()));
+
+}
+
+template<class ScalarType>
+void CSysMatrix<ScalarType>::ComputeAMGPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+                                                      CGeometry *geometry, CConfig *config) {
+
+  /*--- One V-cycle on the rows owned by the rank ---*/
+
+  amg->Apply(&vec[0], &prod[0]);
+
+  /*--- MPI Parallelization ---*/
+
+  InitiateComms(prod, geometry, config, SOLUTION_MATRIX);
+  CompleteComms(prod, geometry, config, SOLUTION_MATRIX);
+
+}
+
 template<class ScalarType>
 void CSysMatrix<ScalarType>::ComputeResidual(const CSysVector<ScalarType> & sol, const CSysVector<ScalarType> & f, CSysVector<ScalarType> & res) {
 
@@ -1293,30 +1503,27 @@ void CSysMatrix<ScalarType>::EnforceSolutionAtNode(const unsigned long node_i, c
   /*--- Both row and column associated with node i are eliminated (Block_ii = I and all else 0) to preserve eventual symmetry. ---*/
   /*--- The vector is updated with the product of column i by the known (enforced) solution at node i. ---*/
 
-  unsigned long iPoint, iVar, jVar, index, mat_begin;
+  unsigned long iPoint, iVar, jVar, index;
 
   /*--- Delete whole row first. ---*/
   for (index = row_ptr[node_i]*nVar*nVar; index < row_ptr[node_i+1]*nVar*nVar; ++index)
     matrix[index] = 0.0;
 
-  /*--- Update b with the column product and delete column. ---*/
-  for (iPoint = 0; iPoint < nPoint; ++iPoint) {
-    for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; ++index) {
-      if (col_ind[index] == node_i)
-      {
-        mat_begin = index*nVar*nVar;
-
-        for(iVar = 0; iVar < nVar; ++iVar)
-          for(jVar = 0; jVar < nVar; ++jVar)
-            b[iPoint*nVar+iVar] -= matrix[mat_begin+iVar*nVar+jVar] * x_i[jVar];
-
-        /*--- If on diagonal, set diagonal of block to 1, else delete block. ---*/
-        if (iPoint == node_i)
-          for (iVar = 0; iVar < nVar; ++iVar) matrix[mat_begin+iVar*(nVar+1)] = 1.0;
-        else
-          for (iVar = 0; iVar < nVar*nVar; iVar++) matrix[mat_begin+iVar] = 0.0;
-      }
-    }
+  /*--- Update b with the column product and delete column. The structure is
+   symmetric, the rows with a block in column i are the columns of row i. ---*/
+  for (index = row_ptr[node_i]; index < row_ptr[node_i+1]; ++index) {
+    iPoint = col_ind[index];
+    ScalarType *mat_ij = MatrixBlock(iPoint, node_i);
+
+    for(iVar = 0; iVar < nVar; ++iVar)
+      for(jVar = 0; jVar < nVar; ++jVar)
+        b[iPoint*nVar+iVar] -= mat_ij[iVar*nVar+jVar] * x_i[jVar];
+
+    /*--- If on diagonal, set diagonal of block to 1, else delete block. ---*/
+    if (iPoint == node_i)
+      for (iVar = 0; iVar < nVar; ++iVar) mat_ij[iVar*(nVar+1)] = 1.0;
+    else
+      for (iVar = 0; iVar < nVar*nVar; iVar++) mat_ij[iVar] = 0.0;
   }
 
   /*--- Set know solution in rhs vector. ---*/
@@ -1339,3 +1546,13 @@ template void  CSysMatrix<passivedouble>::CompleteComms(CSysVector<su2double>&,
 template void  CSysMatrix<passivedouble>::EnforceSolutionAtNode(unsigned long, const passivedouble*, CSysVector<passivedouble>&);
 template void  CSysMatrix<passivedouble>::EnforceSolutionAtNode(unsigned long, const su2double*, CSysVector<su2double>&);
 #endif
+
+#ifdef SU2_MIXED_PRECISION
+template class CSysMatrix<su2mixedfloat>;
+template void  CSysMatrix<su2mixedfloat>::InitiateComms(CSysVector<su2mixedfloat>&, CGeometry*, CConfig*, unsigned short);
+template void  CSysMatrix<su2mixedfloat>::InitiateComms(CSysVector<su2double>&, CGeometry*, CConfig*, unsigned short);
+template void  CSysMatrix<su2mixedfloat>::CompleteComms(CSysVector<su2mixedfloat>&, CGeometry*, CConfig*, unsigned short);
+template void  CSysMatrix<su2mixedfloat>::CompleteComms(CSysVector<su2double>&, CGeometry*, CConfig*, unsigned short);
+template void  CSysMatrix<su2mixedfloat>::EnforceSolutionAtNode(unsigned long, const su2mixedfloat*, CSysVector<su2mixedfloat>&);
+template void  CSysMatrix<su2mixedfloat>::EnforceSolutionAtNode(unsigned long, const su2double*, CSysVector<su2double>&);
+#endif
@@ -39,11 +39,14 @@
 #include "../../include/linear_algebra/CSysSolve_b.hpp"
 
 template<class ScalarType>
-CSysSolve<ScalarType>::CSysSolve(const bool mesh_deform_mode) : cg_ready(false), bcg_ready(false),
+CSysSolve<ScalarType>::CSysSolve(const bool mesh_deform_mode) : prec_ready(false), Prec_Kind(0), Prec_Age(0),
+                                                                Prec_Builds(0), Prec_Rate(0.0),
+                                                                cg_ready(false), bcg_ready(false),
                                                                 gmres_ready(false), smooth_ready(false) {
   mesh_deform = mesh_deform_mode;
   LinSysRes_ptr = NULL;
   LinSysSol_ptr = NULL;
+  ActiveRecycle = NULL;
 }
 
 template<class ScalarType>
@@ -189,6 +192,253 @@ void CSysSolve<ScalarType>::ModGramSchmidt(int i, vector<vector<ScalarType> > &
 
 }
 
+template<class ScalarType>
+void CSysSolve<ScalarType>::StartReduction(int count) {
+
+  if ((int)RedGlobal.size() < count) {
+    RedGlobal.resize(count);
+    RedSendBuf.resize(count);
+    RedRecvBuf.resize(count);
+  }
+
+#ifdef HAVE_MPI
+
+  if (is_same<ReductionType, passivedouble>::value) {
+
+    /*--- The partial sums are passive, the reduction proceeds in the background
+     until FinishReduction is called. ---*/
+
+    for (int k = 0; k < count; k++)
+      RedSendBuf[k] = SU2_TYPE::GetValue(RedLocal[k]);
+
+    CBaseMPIWrapper::Iallreduce(&RedSendBuf[0], &RedRecvBuf[0], count, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD, &RedRequest);
+  }
+  else {
+
+    /*--- Active (AD) types, the derivatives are reduced with the values by the
+     AD-aware wrapper, as in dotProd, which is blocking. ---*/
+
+    SelectMPIWrapper<ReductionType>::W::Allreduce(&RedLocal[0], &RedGlobal[0], count, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  }
+
+#else
+
+  for (int k = 0; k < count; k++)
+    RedGlobal[k] = RedLocal[k];
+
+#endif
+
+}
+
+template<class ScalarType>
+void CSysSolve<ScalarType>::FinishReduction(int count) {
+
+#ifdef HAVE_MPI
+
+  if (is_same<ReductionType, passivedouble>::value) {
+
+    CBaseMPIWrapper::Wait(&RedRequest, MPI_STATUS_IGNORE);
+
+    for (int k = 0; k < count; k++)
+      RedGlobal[k] = RedRecvBuf[k];
+  }
+
+#endif
+
+}
+
+template<class ScalarType>
+void CSysSolve<ScalarType>::ClassicalGramSchmidt(int i, vector<vector<ScalarType> > & Hsbg, vector<VectorType> & w) {
+
+  int k, nVec = i+1;
+  ReductionType nrm, proj;
+
+  RedLocal.resize(nVec+1);
+
+  /*--- First pass, the projections of w[i+1] on the basis and its norm in a
+   single reduction. ---*/
+
+  for (k = 0; k < nVec; k++)
+    RedLocal[k] = LocalDotProd(w[i+1], w[k]);
+  RedLocal[nVec] = LocalDotProd(w[i+1], w[i+1]);
+
+  StartReduction(nVec+1);
+  FinishReduction(nVec+1);
+
+  /*--- The norm of w[i+1] < 0.0 or w[i+1] = NaN, the value is global hence
+   all ranks agree without further synchronization. ---*/
+
+  nrm = RedGlobal[nVec];
+  if ((nrm <= 0.0) || (nrm != nrm)) {
+    SU2_MPI::Error("SU2 has diverged.", CURRENT_FUNCTION);
+  }
+
+  for (k = 0; k < nVec; k++) {
+    Hsbg[k][i] = RedGlobal[k];
+    w[i+1].Plus_AX(-Hsbg[k][i], w[k]);
+  }
+
+  /*--- Second pass, classical Gram-Schmidt loses orthogonality without it.
+   The norm of the final vector follows from the norm before this pass and
+   the (small) projections removed by it. ---*/
+
+  for (k = 0; k < nVec; k++)
+    RedLocal[k] = LocalDotProd(w[i+1], w[k]);
+  RedLocal[nVec] = LocalDotProd(w[i+1], w[i+1]);
+
+  StartReduction(nVec+1);
+  FinishReduction(nVec+1);
+
+  nrm = RedGlobal[nVec];
+
+  for (k = 0; k < nVec; k++) {
+    proj = RedGlobal[k];
+    Hsbg[k][i] += proj;
+    w[i+1].Plus_AX(-ScalarType(proj), w[k]);
+    nrm -= proj*proj;
+  }
+
+  nrm = sqrt(max(nrm, ReductionType(0.0)));
+  Hsbg[i+1][i] = nrm;
+
+  /*--- Scale the resulting vector ---*/
+
+  w[i+1] /= ScalarType(nrm);
+
+}
+
+template<class ScalarType>
+void CSysSolve<ScalarType>::PrepareRecycledSpace(CRecycledSpace & space, ProductType & mat_vec,
+                                                 const VectorType & x, unsigned long nVec) {
+
+  unsigned long iVec, jVec, nKept = 0;
+  ScalarType proj, nrm, nrm0;
+
+  /*--- Threshold below which a vector is considered dependent on the others ---*/
+
+  static const ScalarType dep_tol = 1e-6;
+
+  if (space.U.size() != nVec) {
+    space.U.resize(nVec, x);
+    space.C.resize(nVec, x);
+    space.size = 0;
+    space.next = 0;
+  }
+
+  /*--- The operator has changed since the subspace was built, compute its image
+   and orthonormalize it with modified Gram-Schmidt, applying the same operations
+   to U. Dependent vectors are dropped and the others compacted. ---*/
+
+  for (iVec = 0; iVec < space.size; iVec++) {
+
+    if (nKept != iVec) space.U[nKept] = space.U[iVec];
+
+    mat_vec(space.U[nKept], space.C[nKept]);
+    nrm0 = space.C[nKept].norm();
+
+    for (jVec = 0; jVec < nKept; jVec++) {
+      proj = dotProd(space.C[nKept], space.C[jVec]);
+      space.C[nKept].Plus_AX(-proj, space.C[jVec]);
+      space.U[nKept].Plus_AX(-proj, space.U[jVec]);
+    }
+
+    nrm = space.C[nKept].norm();
+
+    if ((nrm > dep_tol*nrm0) && (nrm == nrm)) {
+      space.C[nKept] /= nrm;
+      space.U[nKept] /= nrm;
+      nKept++;
+    }
+  }
+
+  if (nKept < space.size) space.next = nKept;
+  space.size = nKept;
+
+}
+
+template<class ScalarType>
+void CSysSolve<ScalarType>::AddToRecycledSpace(CRecycledSpace & space, ProductType & mat_vec,
+                                               VectorType & u, VectorType & Au) {
+
+  unsigned long jVec, slot = space.next;
+  ScalarType proj, nrm, nrm0;
+
+  static const ScalarType dep_tol = 1e-6;
+
+  /*--- Orthonormalize the image of the new vector against the vectors that are
+   kept, when the subspace is full the vector in "slot" is replaced. ---*/
+
+  mat_vec(u, Au);
+  nrm0 = Au.norm();
+
+  for (jVec = 0; jVec < space.size; jVec++) {
+    if (jVec == slot) continue;
+    proj = dotProd(Au, space.C[jVec]);
+    Au.Plus_AX(-proj, space.C[jVec]);
+    u.Plus_AX(-proj, space.U[jVec]);
+  }
+
+  nrm = Au.norm();
+
+  if ((nrm <= dep_tol*nrm0) || (nrm != nrm)) return;
+
+  Au /= nrm;
+  u /= nrm;
+
+  space.U[slot] = u;
+  space.C[slot] = Au;
+
+  space.size = min(space.size+1, (unsigned long)space.U.size());
+  space.next = (slot+1) % space.U.size();
+
+}
+
+template<class ScalarType>
+bool CSysSolve<ScalarType>::ReusePreconditioner(unsigned short KindPrecond, CConfig *config) const {
+
+  unsigned long MaxAge = config->GetLinear_Solver_Prec_Reuse();
+
+  /*--- Only the preconditioners with their own storage can be lagged, LU_SGS and
+   LINELET work with the matrix directly. The discrete adjoint overwrites the
+   preconditioner with the one of the transposed system after each solve. ---*/
+
+  if ((MaxAge == 0) || mesh_deform || config->GetDiscrete_Adjoint()) return false;
+
+  if ((KindPrecond != JACOBI) && (KindPrecond != ILU) && (KindPrecond != AMG)) return false;
+
+  return (prec_ready && (KindPrecond == Prec_Kind) && (Prec_Age < MaxAge));
+
+}
+
+template<class ScalarType>
+void CSysSolve<ScalarType>::UpdatePreconditionerStats(bool built, unsigned short KindPrecond, unsigned long iter,
+                                                      ScalarType res0, CConfig *config) {
+
+  if (built) {
+    Prec_Builds++;
+    Prec_Age = 0;
+    Prec_Kind = KindPrecond;
+    prec_ready = true;
+  }
+  else {
+    Prec_Age++;
+  }
+
+  if (config->GetLinear_Solver_Prec_Reuse() == 0) return;
+
+  /*--- Systems solved by the initial guess say nothing about the preconditioner ---*/
+
+  if ((iter == 0) || (res0 <= 0.0) || (Residual <= 0.0)) return;
+
+  ScalarType Rate = log(res0/Residual)/ScalarType(iter);
+
+  if (built)
+    Prec_Rate = Rate;
+  else if (Rate*SU2_TYPE::GetValue(config->GetLinear_Solver_Prec_Degradation()) < Prec_Rate)
+    prec_ready = false;
+
+}
+
 template<class ScalarType>
 void CSysSolve<ScalarType>::WriteHeader(const string & solver, const ScalarType & restol, const ScalarType & resinit) {
 
@@ -379,6 +629,12 @@ unsigned long CSysSolve<ScalarType>::FGMRES_LinSolver(const CSysVector<ScalarTyp
   vector<ScalarType> y(m, 0.0);
   vector<vector<ScalarType> > H(m+1, vector<ScalarType>(m, 0.0));
 
+  /*---  Recycled subspace (GCRO), B holds the projections of the new directions on C ---*/
+
+  CRecycledSpace *rec = ActiveRecycle;
+  unsigned long j, nRec = (rec != NULL)? rec->size : 0;
+  vector<vector<ScalarType> > B(nRec, vector<ScalarType>(m, 0.0));
+
   /*---  Calculate the norm of the rhs vector ---*/
 
   ScalarType norm0 = b.norm();
@@ -388,6 +644,17 @@ unsigned long CSysSolve<ScalarType>::FGMRES_LinSolver(const CSysVector<ScalarTyp
   mat_vec(x, W[0]);
   W[0] -= b;
 
+  /*---  Remove the components of the residual in span(C), x is corrected in span(U).
+   The convergence is measured relative to the residual before the projection. ---*/
+
+  ScalarType norm_r0 = (nRec > 0)? W[0].norm() : ScalarType(0.0);
+
+  for (j = 0; j < nRec; j++) {
+    ScalarType alpha = -dotProd(W[0], rec->C[j]);
+    x.Plus_AX(alpha, rec->U[j]);
+    W[0].Plus_AX(alpha, rec->C[j]);
+  }
+
   ScalarType beta = W[0].norm();
 
   if ( (beta < tol*norm0) || (beta < eps) ) {
@@ -410,7 +677,7 @@ unsigned long CSysSolve<ScalarType>::FGMRES_LinSolver(const CSysVector<ScalarTyp
 
   /*--- Set the norm to the initial residual value ---*/
 
-  norm0 = beta;
+  norm0 = (nRec > 0)? norm_r0 : beta;
 
   /*---  Output header information including initial residual ---*/
 
@@ -436,9 +703,19 @@ unsigned long CSysSolve<ScalarType>::FGMRES_LinSolver(const CSysVector<ScalarTyp
 
     mat_vec(Z[i], W[i+1]);
 
-    /*---  Modified Gram-Schmidt orthogonalization ---*/
+    /*---  Keep the new direction orthogonal to the recycled subspace ---*/
 
-    ModGramSchmidt(i, H, W);
+    for (j = 0; j < nRec; j++) {
+      B[j][i] = dotProd(W[i+1], rec->C[j]);
+      W[i+1].Plus_AX(-B[j][i], rec->C[j]);
+    }
+
+    /*---  Modified Gram-Schmidt orthogonalization, or classical with fused reductions ---*/
+
+    if (config->GetLinear_Solver_Fused_Reductions())
+      ClassicalGramSchmidt(i, H, W);
+    else
+      ModGramSchmidt(i, H, W);
 
     /*---  Apply old Givens rotations to new column of the Hessenberg matrix then generate the
      new Givens rotation matrix and apply it to the last two elements of H[:][i] and g ---*/
@@ -461,8 +738,31 @@ unsigned long CSysSolve<ScalarType>::FGMRES_LinSolver(const CSysVector<ScalarTyp
   /*---  Solve the least-squares system and update solution ---*/
 
   SolveReduced(i, H, g, y);
-  for (int k = 0; k < i; k++) {
-    x.Plus_AX(y[k], Z[k]);
+
+  if (rec == NULL) {
+    for (int k = 0; k < i; k++) {
+      x.Plus_AX(y[k], Z[k]);
+    }
+  }
+  else {
+
+    /*---  The correction Z*y has a component A*Z*y in span(C), which is
+     cancelled by -U*B*y. The correction is kept to be recycled. ---*/
+
+    W[0] = ScalarType(0.0);
+    for (int k = 0; k < i; k++)
+      W[0].Plus_AX(y[k], Z[k]);
+
+    for (j = 0; j < nRec; j++) {
+      ScalarType eta = 0.0;
+      for (int k = 0; k < i; k++)
+        eta -= B[j][k]*y[k];
+      W[0].Plus_AX(eta, rec->U[j]);
+    }
+
+    x += W[0];
+
+    if (i > 0) AddToRecycledSpace(*rec, mat_vec, W[0], W[1]);
   }
 
   /*---  Recalculate final (neg.) residual (this should be optional) ---*/
@@ -499,6 +799,11 @@ unsigned long CSysSolve<ScalarType>::BCGSTAB_LinSolver(const CSysVector<ScalarTy
                                                        CMatrixVectorProduct<ScalarType> & mat_vec, CPreconditioner<ScalarType> & precond,
                                                        ScalarType tol, unsigned long m, ScalarType *residual, bool monitoring, CConfig *config) {
 
+  /*--- Variant with fused global reductions ---*/
+
+  if (config->GetLinear_Solver_Fused_Reductions())
+    return BCGSTAB_Fused_LinSolver(b, x, mat_vec, precond, tol, m, residual, monitoring, config);
+
   int rank = SU2_MPI::GetRank();
   ScalarType norm_r = 0.0, norm0 = 0.0;
   int i = 0;
@@ -650,6 +955,177 @@ unsigned long CSysSolve<ScalarType>::BCGSTAB_LinSolver(const CSysVector<ScalarTy
   return (unsigned long) i;
 }
 
+template<class ScalarType>
+unsigned long CSysSolve<ScalarType>::BCGSTAB_Fused_LinSolver(const CSysVector<ScalarType> & b, CSysVector<ScalarType> & x,
+                                                             CMatrixVectorProduct<ScalarType> & mat_vec, CPreconditioner<ScalarType> & precond,
+                                                             ScalarType tol, unsigned long m, ScalarType *residual, bool monitoring, CConfig *config) {
+
+  int rank = SU2_MPI::GetRank();
+  ScalarType norm_r = 0.0, norm0 = 0.0;
+  int i = 0;
+
+  /*--- Check the subspace size ---*/
+
+  if (m < 1) {
+    char buf[100];
+    SPRINTF(buf, "Illegal value for subspace size, m = %lu", m );
+    SU2_MPI::Error(string(buf), CURRENT_FUNCTION);
+  }
+
+  /*--- Allocate if not allocated yet (q is only used by this variant) ---*/
+
+  if (!bcg_ready) {
+    A_x = b;
+    p = b;
+    z = b;
+    v = b;
+    bcg_ready = true;
+  }
+  if (q.GetLocSize() != b.GetLocSize()) q = b;
+
+  /*--- Calculate the initial residual, its norm and the norm of the rhs
+   in one reduction, and check if system is already solved ---*/
+
+  mat_vec(x, A_x);
+  r = b; r -= A_x;
+
+  RedLocal.resize(5);
+  RedLocal[0] = LocalDotProd(r, r);
+  RedLocal[1] = LocalDotProd(b, b);
+
+  StartReduction(2);
+  FinishReduction(2);
+
+  ReductionType rho = RedGlobal[0];
+
+  norm_r = sqrt(RedGlobal[0]);
+  norm0  = sqrt(RedGlobal[1]);
+  if ( (norm_r < tol*norm0) || (norm_r < eps) ) {
+    if (rank == MASTER_NODE) cout << "CSysSolve::BCGSTAB(): system solved by initial guess." << endl;
+    return 0;
+  }
+
+  /*--- Set the norm to the initial initial residual value ---*/
+
+  norm0 = norm_r;
+
+  /*--- Output header information including initial residual ---*/
+
+  if ((monitoring) && (rank == MASTER_NODE)) {
+    WriteHeader("BCGSTAB", tol, norm_r);
+    WriteHistory(i, norm_r, norm0);
+  }
+
+  /*--- Initialization, with r_0 = r the first rho is the squared norm ---*/
+
+  ReductionType alpha = 1.0, beta = 1.0, omega = 1.0, rho_prime = 1.0;
+  ReductionType t_dot_s, t_dot_t, r0_dot_s, r0_dot_t, s_dot_s;
+  p = ScalarType(0.0); v = ScalarType(0.0); r_0 = r;
+
+  /*---  Loop over all search directions ---*/
+
+  for (i = 0; i < (int)m; i++) {
+
+    /*--- Compute beta ---*/
+
+    beta = (rho / rho_prime) * (alpha / omega);
+
+    /*--- p_{i} = r_{i-1} + beta * p_{i-1} - beta * omega * v_{i-1} ---*/
+
+    p.Equals_AX_Plus_BY(ScalarType(beta), p, ScalarType(-beta*omega), v);
+    p.Plus_AX(1.0, r);
+
+    /*--- Preconditioning step ---*/
+
+    precond(p, z);
+    mat_vec(z, v);
+
+    /*--- Calculate step-length alpha (first synchronization) ---*/
+
+    RedLocal[0] = LocalDotProd(r_0, v);
+    StartReduction(1);
+    FinishReduction(1);
+    alpha = rho / RedGlobal[0];
+
+    /*--- s = r_{i-1} - alpha * v_{i}, stored in r ---*/
+
+    r.Plus_AX(-ScalarType(alpha), v);
+
+    /*--- Preconditioning step, t = A * M^-1 * s is stored in A_x ---*/
+
+    precond(r, q);
+    mat_vec(q, A_x);
+
+    /*--- All the remaining inner products of the iteration in one reduction
+     (second synchronization), the first update of the solution does not
+     depend on them and hides part of the latency. ---*/
+
+    RedLocal[0] = LocalDotProd(A_x, r);
+    RedLocal[1] = LocalDotProd(A_x, A_x);
+    RedLocal[2] = LocalDotProd(r_0, r);
+    RedLocal[3] = LocalDotProd(r_0, A_x);
+    RedLocal[4] = LocalDotProd(r, r);
+
+    StartReduction(5);
+
+    /*--- x_{i-1/2} = x_{i-1} + alpha * z ---*/
+    x.Plus_AX(ScalarType(alpha), z);
+
+    FinishReduction(5);
+
+    t_dot_s  = RedGlobal[0];  t_dot_t  = RedGlobal[1];
+    r0_dot_s = RedGlobal[2];  r0_dot_t = RedGlobal[3];
+    s_dot_s  = RedGlobal[4];
+
+    /*--- Calculate step-length omega ---*/
+
+    omega = t_dot_s / t_dot_t;
+
+    /*--- x_{i} = x_{i-1/2} + omega * q, r_{i} = s - omega * t ---*/
+
+    x.Plus_AX(ScalarType(omega), q);
+    r.Plus_AX(-ScalarType(omega), A_x);
+
+    /*--- rho_{i} = (r_{i}, r_0) and |r_{i}|^2 follow from the reduced products ---*/
+
+    rho_prime = rho;
+    rho = r0_dot_s - omega*r0_dot_t;
+
+    norm_r = sqrt(max(s_dot_s - 2.0*omega*t_dot_s + omega*omega*t_dot_t, ReductionType(0.0)));
+
+    /*--- Check if solution has converged, else output the relative residual if necessary ---*/
+
+    if (norm_r < tol*norm0) break;
+    if (((monitoring) && (rank == MASTER_NODE)) && ((i+1) % 10 == 0)) WriteHistory(i+1, norm_r, norm0);
+
+  }
+
+  /*--- Recalculate final residual (this should be optional) ---*/
+
+  if ((monitoring) && (config->GetComm_Level() == COMM_FULL)) {
+
+    if (rank == MASTER_NODE) {
+      cout << "# BCGSTAB final (true) residual:" << endl;
+      cout << "# Iteration = " << i << ": |res|/|res0| = "  << norm_r/norm0 << ".\n" << endl;
+    }
+
+    mat_vec(x, A_x);
+    r = b; r -= A_x;
+    ScalarType true_res = r.norm();
+
+    if ((fabs(true_res - norm_r) > tol*10.0) && (rank == MASTER_NODE)) {
+      cout << "# WARNING in CSysSolve::BCGSTAB_Fused_LinSolver(): " << endl;
+      cout << "# true residual norm and calculated residual norm do not agree." << endl;
+      cout << "# true_res = " << true_res <<", calc_res = " << norm_r <<", tol = " << tol*10 <<"."<< endl;
+      cout << "# true_res - calc_res = " << true_res - norm_r << endl;
+    }
+
+  }
+
+  (*residual) = norm_r;
+  return (unsigned long) i;
+}
+
 template<class ScalarType>
 unsigned long CSysSolve<ScalarType>::Smoother_LinSolver(const CSysVector<ScalarType> & b, CSysVector<ScalarType> & x,
                                                         CMatrixVectorProduct<ScalarType> & mat_vec, CPreconditioner<ScalarType> & precond,
@@ -798,9 +1274,35 @@ void CSysSolve<passivedouble>::HandleTemporariesOut(CSysVector<su2double> & LinS
 }
 #endif
 
+#ifdef SU2_MIXED_PRECISION
+template<>
+void CSysSolve<su2mixedfloat>::HandleTemporariesIn(CSysVector<su2double> & LinSysRes, CSysVector<su2double> & LinSysSol) {
+
+  /*--- The residual and solution are double, copy them to the single precision temporaries ---*/
+  LinSysRes_tmp.PassiveCopy(LinSysRes);
+  LinSysSol_tmp.PassiveCopy(LinSysSol);
+
+  /*--- Set the pointers ---*/
+  LinSysRes_ptr = &LinSysRes_tmp;
+  LinSysSol_ptr = &LinSysSol_tmp;
+}
+
+template<>
+void CSysSolve<su2mixedfloat>::HandleTemporariesOut(CSysVector<su2double> & LinSysSol) {
+
+  /*--- Copy the update back to double, only the solution needs to be copied ---*/
+  LinSysSol.PassiveCopy(LinSysSol_tmp);
+
+  /*--- Reset the pointers ---*/
+  LinSysRes_ptr = NULL;
+  LinSysSol_ptr = NULL;
+}
+#endif
+
 template<class ScalarType>
 unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, CSysVector<su2double> & LinSysRes,
-                                           CSysVector<su2double> & LinSysSol, CGeometry *geometry, CConfig *config) {
+                                           CSysVector<su2double> & LinSysSol, CGeometry *geometry, CConfig *config,
+                                           CMatrixVectorProduct<ScalarType> *custom_mat_vec) {
   /*---
    A word about the templated types. It is assumed that the residual and solution vectors are always of su2doubles,
    meaning that they are active in the discrete adjoint. The same assumption is made in SetExternalSolve.
@@ -861,16 +1363,27 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, CS
 
   HandleTemporariesIn(LinSysRes, LinSysSol);
 
-  CMatrixVectorProduct<ScalarType>* mat_vec = new CSysMatrixVectorProduct<ScalarType>(Jacobian, geometry, config);
+  CMatrixVectorProduct<ScalarType>* mat_vec = custom_mat_vec;
   CPreconditioner<ScalarType>* precond = NULL;
 
+  if (custom_mat_vec == NULL)
+    mat_vec = new CSysMatrixVectorProduct<ScalarType>(Jacobian, geometry, config);
+
+  /*--- Lazy refresh, the preconditioner of a previous solve is kept while the
+   convergence rate it gives does not degrade (see UpdatePreconditionerStats). ---*/
+
+  bool BuildPrec = !ReusePreconditioner(KindPrecond, config);
+  ScalarType NormRHS = 0.0;
+
+  if (config->GetLinear_Solver_Prec_Reuse() > 0) NormRHS = LinSysRes_ptr->norm();
+
   switch (KindPrecond) {
     case JACOBI:
-      Jacobian.BuildJacobiPreconditioner();
+      if (BuildPrec) Jacobian.BuildJacobiPreconditioner();
       precond = new CJacobiPreconditioner<ScalarType>(Jacobian, geometry, config);
       break;
     case ILU:
-      Jacobian.BuildILUPreconditioner();
+      if (BuildPrec) Jacobian.BuildILUPreconditioner();
       precond = new CILUPreconditioner<ScalarType>(Jacobian, geometry, config);
       break;
     case LU_SGS:
@@ -880,12 +1393,25 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, CS
       Jacobian.BuildJacobiPreconditioner();
       precond = new CLineletPreconditioner<ScalarType>(Jacobian, geometry, config);
       break;
+    case AMG:
+      if (BuildPrec) Jacobian.BuildAMGPreconditioner(config);
+      precond = new CAMGPreconditioner<ScalarType>(Jacobian, geometry, config);
+      break;
     default:
       Jacobian.BuildJacobiPreconditioner();
       precond = new CJacobiPreconditioner<ScalarType>(Jacobian, geometry, config);
       break;
   }
 
+  /*--- Krylov subspace recycling between calls, FGMRES only ---*/
+
+  unsigned long RecycleSize = config->GetLinear_Solver_Recycle_Size();
+
+  if (!mesh_deform && (RecycleSize > 0) && ((KindSolver == FGMRES) || (KindSolver == RESTARTED_FGMRES))) {
+    ActiveRecycle = &Recycle;
+    PrepareRecycledSpace(Recycle, *mat_vec, *LinSysSol_ptr, RecycleSize);
+  }
+
   switch (KindSolver) {
     case BCGSTAB:
       IterLinSol = BCGSTAB_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, *mat_vec, *precond, SolverTol, MaxIter, &Residual, ScreenOutput, config);
@@ -913,7 +1439,11 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, CS
       SU2_MPI::Error("Unknown type of linear solver.",CURRENT_FUNCTION);
   }
 
-  delete mat_vec;
+  ActiveRecycle = NULL;
+
+  UpdatePreconditionerStats(BuildPrec, KindPrecond, IterLinSol, NormRHS, config);
+
+  if (custom_mat_vec == NULL) delete mat_vec;
   delete precond;
 
   HandleTemporariesOut(LinSysSol);
@@ -949,6 +1479,9 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, CS
       case JACOBI:
         Jacobian.BuildJacobiPreconditioner(RequiresTranspose);
         break;
+      case AMG:
+        Jacobian.BuildAMGPreconditioner(config, RequiresTranspose);
+        break;
       default:
         SU2_MPI::Error("The specified preconditioner is not yet implemented for the discrete adjoint method.", CURRENT_FUNCTION);
         break;
@@ -1005,6 +1538,9 @@ unsigned long CSysSolve<ScalarType>::Solve_b(CSysMatrix<ScalarType> & Jacobian,
     case JACOBI:
       precond = new CJacobiPreconditioner<ScalarType>(Jacobian, geometry, config);
       break;
+    case AMG:
+      precond = new CAMGPreconditioner<ScalarType>(Jacobian, geometry, config);
+      break;
   }
 
   CMatrixVectorProduct<ScalarType>* mat_vec = new CSysMatrixVectorProductTransposed<ScalarType>(Jacobian, geometry, config);
@@ -1013,6 +1549,15 @@ unsigned long CSysSolve<ScalarType>::Solve_b(CSysMatrix<ScalarType> & Jacobian,
 
   HandleTemporariesIn(LinSysRes, LinSysSol);
 
+  /*--- The transposed systems have their own recycled subspace ---*/
+
+  unsigned long RecycleSize = config->GetLinear_Solver_Recycle_Size();
+
+  if (!mesh_deform && (RecycleSize > 0) && ((KindSolver == FGMRES) || (KindSolver == RESTARTED_FGMRES))) {
+    ActiveRecycle = &Recycle_b;
+    PrepareRecycledSpace(Recycle_b, *mat_vec, *LinSysSol_ptr, RecycleSize);
+  }
+
   switch(KindSolver) {
     case FGMRES:
       IterLinSol = FGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, *mat_vec, *precond, SolverTol , MaxIter, &Residual, ScreenOutput, config);
@@ -1038,6 +1583,8 @@ unsigned long CSysSolve<ScalarType>::Solve_b(CSysMatrix<ScalarType> & Jacobian,
       break;
   }
 
+  ActiveRecycle = NULL;
+
   HandleTemporariesOut(LinSysSol);
 
   delete mat_vec;
@@ -1055,3 +1602,7 @@ template class CSysSolve<su2double>;
 #ifdef CODI_REVERSE_TYPE
 template class CSysSolve<passivedouble>;
 #endif
+
+#ifdef SU2_MIXED_PRECISION
+template class CSysSolve<su2mixedfloat>;
+#endif
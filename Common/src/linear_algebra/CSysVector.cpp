@@ -36,6 +36,7 @@
  */
 
 #include "../../include/linear_algebra/CSysVector.hpp"
+#include "../../include/toolboxes/CReproducibleSum.hpp"
 
 template<class ScalarType>
 CSysVector<ScalarType>::CSysVector(void) {
@@ -457,6 +458,31 @@ void CSysVector<ScalarType>::PassiveCopy(const CSysVector<T>& other) {
 #endif
 }
 
+/*!
+ * \brief Exact (reproducible) global dot product, only for passive types since the
+ *        derivatives of the AD types are not accumulated exactly.
+ * \return <code>TRUE</code> if the product was computed (REPRODUCIBLE_REDUCTIONS= YES).
+ */
+template<class ScalarType>
+static bool ReproducibleDotProd(const ScalarType *u, const ScalarType *v, unsigned long n, ScalarType & prod) {
+  return false;
+}
+
+template<>
+bool ReproducibleDotProd<passivedouble>(const passivedouble *u, const passivedouble *v, unsigned long n, passivedouble & prod) {
+
+  if (!CReproducibleSum::GetActive()) return false;
+
+  CReproducibleSum sum;
+  for (unsigned long i = 0; i < n; i++)
+    sum.Add(u[i]*v[i]);
+
+  CReproducibleSum::Allreduce(&sum, 1);
+  prod = sum.GetValue();
+
+  return true;
+}
+
 template<class ScalarType>
 ScalarType dotProd(const CSysVector<ScalarType> & u, const CSysVector<ScalarType> & v) {
 
@@ -467,10 +493,12 @@ ScalarType dotProd(const CSysVector<ScalarType> & u, const CSysVector<ScalarType
 
   /*--- find local inner product and, if a parallel run, sum over all
    processors (we use nElemDomain instead of nElem) ---*/
+  ScalarType prod = 0.0;
+  if (ReproducibleDotProd(u.vec_val, v.vec_val, u.nElmDomain, prod)) return prod;
+
   ScalarType loc_prod = 0.0;
   for (unsigned long i = 0; i < u.nElmDomain; i++)
     loc_prod += u.vec_val[i]*v.vec_val[i];
-  ScalarType prod = 0.0;
 
 #ifdef HAVE_MPI
   SelectMPIWrapper<ScalarType>::W::Allreduce(&loc_prod, &prod, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
@@ -481,6 +509,40 @@ ScalarType dotProd(const CSysVector<ScalarType> & u, const CSysVector<ScalarType
   return prod;
 }
 
+#ifdef SU2_MIXED_PRECISION
+template<>
+su2mixedfloat dotProd<su2mixedfloat>(const CSysVector<su2mixedfloat> & u, const CSysVector<su2mixedfloat> & v) {
+
+  /*--- check for consistent sizes ---*/
+  if (u.nElm != v.nElm) {
+    SU2_MPI::Error("Sizes do not match", CURRENT_FUNCTION);
+  }
+
+  /*--- The single precision vectors are accumulated and reduced in double
+   precision, the norms and the Krylov coefficients are sensitive to it. ---*/
+  if (CReproducibleSum::GetActive()) {
+    CReproducibleSum sum;
+    for (unsigned long i = 0; i < u.nElmDomain; i++)
+      sum.Add(passivedouble(u.vec_val[i])*passivedouble(v.vec_val[i]));
+    CReproducibleSum::Allreduce(&sum, 1);
+    return su2mixedfloat(sum.GetValue());
+  }
+
+  passivedouble loc_prod = 0.0;
+  for (unsigned long i = 0; i < u.nElmDomain; i++)
+    loc_prod += passivedouble(u.vec_val[i])*passivedouble(v.vec_val[i]);
+  passivedouble prod = 0.0;
+
+#ifdef HAVE_MPI
+  SU2_MPI::Allreduce(&loc_prod, &prod, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+#else
+  prod = loc_prod;
+#endif
+
+  return su2mixedfloat(prod);
+}
+#endif
+
 /*--- Explicit instantiations ---*/
 template class CSysVector<su2double>;
 template CSysVector<su2double> operator*(const su2double&, const CSysVector<su2double>&);
@@ -494,3 +556,10 @@ template void CSysVector<su2double>::PassiveCopy(const CSysVector<passivedouble>
 template void CSysVector<passivedouble>::PassiveCopy(const CSysVector<su2double>&);
 template passivedouble dotProd<passivedouble>(const CSysVector<passivedouble> & u, const CSysVector<passivedouble> & v);
 #endif
+
+#ifdef SU2_MIXED_PRECISION
+template class CSysVector<su2mixedfloat>;
+template CSysVector<su2mixedfloat> operator*(const su2mixedfloat&, const CSysVector<su2mixedfloat>&);
+template void CSysVector<su2double>::PassiveCopy(const CSysVector<su2mixedfloat>&);
+template void CSysVector<su2mixedfloat>::PassiveCopy(const CSysVector<su2double>&);
+#endif
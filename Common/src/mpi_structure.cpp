@@ -45,6 +45,7 @@ CBaseMPIWrapper::Comm CBaseMPIWrapper::currentComm = MPI_COMM_WORLD;
 int  CBaseMPIWrapper::MinRankError;
 bool CBaseMPIWrapper::winMinRankErrorInUse = false;
 CBaseMPIWrapper::Win CBaseMPIWrapper::winMinRankError;
+double CBaseMPIWrapper::WaitTime = 0.0;
 #endif
 
 #ifdef HAVE_MPI
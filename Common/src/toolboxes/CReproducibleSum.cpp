@@ -0,0 +1,124 @@
+/*!
+ * \file CReproducibleSum.cpp
+ * \brief Functions of the exact accumulator used by the reproducible reductions.
+ * \version 6.2.0 "Falcon"
+ *
+ * The current SU2 release has been coordinated by the
+ * SU2 International Developers Society <www.su2devsociety.org>
+ * with selected contributions from the open-source community.
+ *
+ * The main research teams contributing to the current release are:
+ *  - Prof. Juan J. Alonso's group at Stanford University.
+ *  - Prof. Piero Colonna's group at Delft University of Technology.
+ *  - Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+ *  - Prof. Alberto Guardone's group at Polytechnic University of Milan.
+ *  - Prof. Rafael Palacios' group at Imperial College London.
+ *  - Prof. Vincent Terrapon's group at the University of Liege.
+ *  - Prof. Edwin van der Weide's group at the University of Twente.
+ *  - Lab. of New Concepts in Aeronautics at Tech. Institute of Aeronautics.
+ *
+ * Copyright 2012-2019, Francisco D. Palacios, Thomas D. Economon,
+ *                      Tim Albring, and the SU2 contributors.
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/toolboxes/CReproducibleSum.hpp"
+#include <vector>
+
+bool CReproducibleSum::active = false;
+
+void CReproducibleSum::Normalize(void) {
+
+  /*--- The carry is the floor of the chunk divided by 2^32 (also for negative
+   chunks), the division is exact once the low bits are removed. ---*/
+
+  for (int i = 0; i < nChunk-1; i++) {
+    long long low = chunk[i] & 0xFFFFFFFFLL;
+    long long carry = (chunk[i] - low) / 0x100000000LL;
+    chunk[i] = low;
+    chunk[i+1] += carry;
+  }
+  pending = 0;
+}
+
+void CReproducibleSum::Add(const CReproducibleSum & other) {
+
+  /*--- After normalizing, each chunk of the sum is below 2^33. ---*/
+
+  Normalize();
+  CReproducibleSum tmp = other;
+  tmp.Normalize();
+
+  for (int i = 0; i < nChunk; i++) chunk[i] += tmp.chunk[i];
+  nonfinite += other.nonfinite;
+}
+
+double CReproducibleSum::GetValue(void) const {
+
+  if (nonfinite != 0.0 || std::isnan(nonfinite)) return nonfinite;
+
+  CReproducibleSum tmp = *this;
+  tmp.Normalize();
+
+  /*--- Negative sums are converted to sign and magnitude. ---*/
+
+  double sign = 1.0;
+  if (tmp.chunk[nChunk-1] < 0) {
+    for (int i = 0; i < nChunk; i++) tmp.chunk[i] = -tmp.chunk[i];
+    tmp.Normalize();
+    sign = -1.0;
+  }
+
+  /*--- Convert from the least significant chunk up, the order is fixed
+   hence so is the rounding. ---*/
+
+  double val = 0.0;
+  for (int i = 0; i < nChunk; i++)
+    if (tmp.chunk[i] != 0) val += std::ldexp(double(tmp.chunk[i]), 32*i-Offset);
+
+  return sign*val;
+}
+
+void CReproducibleSum::Allreduce(CReproducibleSum *sums, int count) {
+
+#ifdef HAVE_MPI
+
+  int size = SU2_MPI::GetSize();
+  if (size == 1) return;
+
+  /*--- Normalized chunks are below 2^32, hence the integer sum over the
+   ranks cannot overflow. ---*/
+
+  std::vector<long long> sendChunk(count*nChunk), recvChunk(count*nChunk);
+  std::vector<double> sendNonfinite(count), recvNonfinite(count);
+
+  for (int k = 0; k < count; k++) {
+    sums[k].Normalize();
+    for (int i = 0; i < nChunk; i++) sendChunk[k*nChunk+i] = sums[k].chunk[i];
+    sendNonfinite[k] = sums[k].nonfinite;
+  }
+
+  CBaseMPIWrapper::Allreduce(&sendChunk[0], &recvChunk[0], count*nChunk, MPI_LONG_LONG, MPI_SUM, MPI_COMM_WORLD);
+  CBaseMPIWrapper::Allreduce(&sendNonfinite[0], &recvNonfinite[0], count, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+
+  for (int k = 0; k < count; k++) {
+    for (int i = 0; i < nChunk; i++) sums[k].chunk[i] = recvChunk[k*nChunk+i];
+    sums[k].nonfinite = recvNonfinite[k];
+    sums[k].pending = 0;
+  }
+
+#endif
+
+}
@@ -0,0 +1,183 @@
+/*!
+ * \file test_CReproducibleSum.cpp
+ * \brief Unit test of the reproducible reductions, the sums must be bitwise identical
+ *        for any number of ranks and any order of the values.
+ * \version 6.2.0 "Falcon"
+ *
+ * The current SU2 release has been coordinated by the
+ * SU2 International Developers Society <www.su2devsociety.org>
+ * with selected contributions from the open-source community.
+ *
+ * The main research teams contributing to the current release are:
+ *  - Prof. Juan J. Alonso's group at Stanford University.
+ *  - Prof. Piero Colonna's group at Delft University of Technology.
+ *  - Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+ *  - Prof. Alberto Guardone's group at Polytechnic University of Milan.
+ *  - Prof. Rafael Palacios' group at Imperial College London.
+ *  - Prof. Vincent Terrapon's group at the University of Liege.
+ *  - Prof. Edwin van der Weide's group at the University of Twente.
+ *  - Lab. of New Concepts in Aeronautics at Tech. Institute of Aeronautics.
+ *
+ * Copyright 2012-2019, Francisco D. Palacios, Thomas D. Economon,
+ *                      Tim Albring, and the SU2 contributors.
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../include/linear_algebra/CSysVector.hpp"
+#include "../include/toolboxes/CReproducibleSum.hpp"
+#include "../include/option_structure.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+/*--- Small linear congruential generator, the values of the test must not
+ depend on the random number generator of the platform. ---*/
+
+static unsigned long long Random(unsigned long long & state) {
+  state = state*6364136223846793005ULL + 1442695040888963407ULL;
+  return state >> 11;
+}
+
+static bool SameBits(double a, double b) {
+  return (memcmp(&a, &b, sizeof(double)) == 0);
+}
+
+int main(int argc, char *argv[]) {
+
+#ifdef HAVE_MPI
+  SU2_MPI::Init(&argc, &argv);
+#endif
+
+  const unsigned long nValue = 20000;
+  const int nRankTest[] = {1, 2, 3, 4, 7, 16, 64};
+  const int nTest = sizeof(nRankTest)/sizeof(int);
+
+  int rank = SU2_MPI::GetRank(), size = SU2_MPI::GetSize();
+  unsigned long iValue, jValue;
+  unsigned long long state = 1;
+  int iTest, iRank, nFail = 0;
+
+  /*--- Values of both signs over a wide range of magnitudes, with large pairs
+   that cancel, so that the naive sums depend strongly on the order. ---*/
+
+  vector<double> u(nValue), v(nValue);
+
+  for (iValue = 0; iValue < nValue; iValue++) {
+    double mant = double(Random(state) % 2000001) / 1000000.0 - 1.0;
+    int expo = int(Random(state) % 81) - 40;
+    u[iValue] = ldexp(mant, expo);
+    v[iValue] = double(Random(state) % 1000) / 7.0;
+  }
+  for (iValue = 0; iValue+1 < nValue; iValue += 97) {
+    u[iValue] = 1.0e20; u[iValue+1] = -1.0e20;
+  }
+
+  /*--- The reference is the exact sum in the natural order. ---*/
+
+  CReproducibleSum Reference;
+  for (iValue = 0; iValue < nValue; iValue++) Reference.Add(u[iValue]);
+  const double Sum_Ref = Reference.GetValue();
+
+  /*--- The result is the exact sum rounded once, 0.1 (which is not exact in binary)
+   added ten times rounds to 1, and the cancellation of large values is exact. ---*/
+
+  CReproducibleSum Check;
+  for (iValue = 0; iValue < 10; iValue++) Check.Add(0.1);
+  if (!SameBits(Check.GetValue(), 1.0)) {
+    cout << "Wrong rounding of the sum of ten times 0.1: " << Check.GetValue() << endl;
+    nFail++;
+  }
+
+  Check.Clear();
+  Check.Add(1.0e100); Check.Add(1.0); Check.Add(-1.0e100);
+  if (!SameBits(Check.GetValue(), 1.0)) {
+    cout << "Wrong cancellation of large values: " << Check.GetValue() << endl;
+    nFail++;
+  }
+
+  /*--- Simulate partitions on several numbers of ranks. Every "rank" adds its
+   values in a shuffled order and the accumulators are then combined in the
+   reverse order of the ranks (as a reduction tree might do). ---*/
+
+  for (iTest = 0; iTest < nTest; iTest++) {
+
+    const int nRank = nRankTest[iTest];
+    vector<CReproducibleSum> Local(nRank);
+
+    vector<unsigned long> order(nValue);
+    for (iValue = 0; iValue < nValue; iValue++) order[iValue] = iValue;
+    for (iValue = nValue-1; iValue > 0; iValue--) {
+      jValue = Random(state) % (iValue+1);
+      swap(order[iValue], order[jValue]);
+    }
+
+    double Naive = 0.0;
+    for (iValue = 0; iValue < nValue; iValue++) {
+      Local[(order[iValue]*nRank)/nValue].Add(u[order[iValue]]);
+      Naive += u[order[iValue]];
+    }
+
+    CReproducibleSum Global;
+    for (iRank = nRank-1; iRank >= 0; iRank--) Global.Add(Local[iRank]);
+
+    if (!SameBits(Global.GetValue(), Sum_Ref)) {
+      cout.precision(17);
+      cout << "Sum on " << nRank << " ranks: " << Global.GetValue() << " instead of " << Sum_Ref << endl;
+      nFail++;
+    }
+
+    if (rank == MASTER_NODE && !SameBits(Naive, Sum_Ref))
+      cout << "Naive sum in shuffled order " << iTest << " differs from the exact sum by " << Naive-Sum_Ref << endl;
+  }
+
+  /*--- Dot product of the linear solvers with the reproducible reductions, each
+   rank of the run holds a contiguous part of the vectors. The result must
+   be the same for any number of ranks of the test (e.g. mpirun -np 3). ---*/
+
+  CReproducibleSum::SetActive(true);
+
+  unsigned long iBegin = (nValue*rank)/size, iEnd = (nValue*(rank+1))/size;
+
+  CSysVector<su2double> x(iEnd-iBegin, 0.0), y(iEnd-iBegin, 0.0);
+  for (iValue = iBegin; iValue < iEnd; iValue++) {
+    x[iValue-iBegin] = u[iValue];
+    y[iValue-iBegin] = v[iValue];
+  }
+
+  CReproducibleSum Product;
+  for (iValue = 0; iValue < nValue; iValue++) Product.Add(u[iValue]*v[iValue]);
+
+  double DotProd = SU2_TYPE::GetValue(dotProd(x, y));
+
+  if (!SameBits(DotProd, Product.GetValue())) {
+    cout.precision(17);
+    cout << "Dot product on " << size << " ranks: " << DotProd << " instead of " << Product.GetValue() << endl;
+    nFail++;
+  }
+
+  CReproducibleSum::SetActive(false);
+
+  if (nFail == 0 && rank == MASTER_NODE)
+    cout << "Reproducible sums on " << size << " rank(s) and " << nTest << " simulated partitions: passed." << endl;
+
+#ifdef HAVE_MPI
+  SU2_MPI::Finalize();
+#endif
+
+  return (nFail == 0)? 0 : 1;
+
+}
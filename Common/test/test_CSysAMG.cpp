@@ -0,0 +1,270 @@
+/*!
+ * \file test_CSysAMG.cpp
+ * \brief Unit tests of the AMG preconditioner: dense LU of the coarsest level, Galerkin
+ *        coarse operator and convergence of the V-cycle.
+ * \version 6.2.0 "Falcon"
+ *
+ * The current SU2 release has been coordinated by the
+ * SU2 International Developers Society <www.su2devsociety.org>
+ * with selected contributions from the open-source community.
+ *
+ * The main research teams contributing to the current release are:
+ *  - Prof. Juan J. Alonso's group at Stanford University.
+ *  - Prof. Piero Colonna's group at Delft University of Technology.
+ *  - Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+ *  - Prof. Alberto Guardone's group at Polytechnic University of Milan.
+ *  - Prof. Rafael Palacios' group at Imperial College London.
+ *  - Prof. Vincent Terrapon's group at the University of Liege.
+ *  - Prof. Edwin van der Weide's group at the University of Twente.
+ *  - Lab. of New Concepts in Aeronautics at Tech. Institute of Aeronautics.
+ *
+ * Copyright 2012-2019, Francisco D. Palacios, Thomas D. Economon,
+ *                      Tim Albring, and the SU2 contributors.
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../include/linear_algebra/CSysAMG.hpp"
+
+#include <cmath>
+#include <iostream>
+
+/*!
+ * \brief Block sparse matrix of the 5-point Laplacian on a nx by ny grid (Dirichlet
+ *        boundaries), each coefficient multiplies the nVar x nVar block B.
+ */
+static void Poisson(unsigned long nx, unsigned long ny, unsigned long nVar, const passivedouble *B,
+                    vector<su2sparseidx> & row_ptr, vector<su2sparseidx> & col_ind, vector<passivedouble> & val) {
+
+  const long di[] = {0, -1, 1, 0, 0}, dj[] = {0, 0, 0, -1, 1};
+  unsigned long i, j, iVar, iNeigh;
+
+  row_ptr.assign(1, 0); col_ind.clear(); val.clear();
+
+  for (j = 0; j < ny; j++) {
+    for (i = 0; i < nx; i++) {
+      for (iNeigh = 0; iNeigh < 5; iNeigh++) {
+        long ii = long(i)+di[iNeigh], jj = long(j)+dj[iNeigh];
+        if (ii < 0 || jj < 0 || ii >= long(nx) || jj >= long(ny)) continue;
+        col_ind.push_back(jj*nx+ii);
+        for (iVar = 0; iVar < nVar*nVar; iVar++)
+          val.push_back((iNeigh == 0)? 4.0*B[iVar] : -B[iVar]);
+      }
+      row_ptr.push_back(col_ind.size());
+    }
+  }
+}
+
+/*!
+ * \brief Dense (row major) copy of a block sparse matrix.
+ */
+template<class IndexType>
+static vector<passivedouble> Dense(unsigned long nRow, unsigned long nCol, unsigned long nVar,
+                                   const vector<IndexType> & row_ptr, const vector<IndexType> & col_ind,
+                                   const vector<passivedouble> & val) {
+
+  vector<passivedouble> dense(nRow*nVar*nCol*nVar, 0.0);
+  unsigned long iRow, index, iVar, jVar;
+
+  for (iRow = 0; iRow < nRow; iRow++)
+    for (index = row_ptr[iRow]; index < row_ptr[iRow+1]; index++)
+      for (iVar = 0; iVar < nVar; iVar++)
+        for (jVar = 0; jVar < nVar; jVar++)
+          dense[(iRow*nVar+iVar)*nCol*nVar + col_ind[index]*nVar+jVar] += val[(index*nVar+iVar)*nVar+jVar];
+
+  return dense;
+}
+
+/*!
+ * \brief Residual norm |b - A x| of a block sparse system.
+ */
+static passivedouble ResidualNorm(unsigned long nPoint, unsigned long nVar, const vector<su2sparseidx> & row_ptr,
+                                  const vector<su2sparseidx> & col_ind, const vector<passivedouble> & val,
+                                  const vector<passivedouble> & b, const vector<passivedouble> & x,
+                                  vector<passivedouble> & r) {
+
+  unsigned long iPoint, index, iVar, jVar;
+  passivedouble norm = 0.0;
+
+  r = b;
+  for (iPoint = 0; iPoint < nPoint; iPoint++)
+    for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++)
+      for (iVar = 0; iVar < nVar; iVar++)
+        for (jVar = 0; jVar < nVar; jVar++)
+          r[iPoint*nVar+iVar] -= val[(index*nVar+iVar)*nVar+jVar]*x[col_ind[index]*nVar+jVar];
+
+  for (iVar = 0; iVar < nPoint*nVar; iVar++) norm += r[iVar]*r[iVar];
+  return sqrt(norm);
+}
+
+int main(int argc, char *argv[]) {
+
+  const unsigned long n = 3;
+  unsigned long iRow, jRow;
+  int nFail = 0;
+
+  /*--- The first pivot swaps rows 0 and 1, the second swaps rows 1 and 2,
+   hence the multipliers of the first column move during the factorization. ---*/
+  const passivedouble A[] = {2.0, 1.0, 1.0,
+                             4.0, 1.0, 0.0,
+                             1.0, 5.0, 3.0};
+  const passivedouble x_ref[] = {1.0, -2.0, 3.0};
+  const unsigned long pivot_ref[] = {1, 2, 2};
+
+  vector<passivedouble> lu(A, A+n*n);
+  vector<unsigned long> pivot;
+  passivedouble x[3];
+
+  for (iRow = 0; iRow < n; iRow++) {
+    x[iRow] = 0.0;
+    for (jRow = 0; jRow < n; jRow++) x[iRow] += A[iRow*n+jRow]*x_ref[jRow];
+  }
+
+  CSysAMG<passivedouble>::DenseLUFactorize(n, lu, pivot);
+  CSysAMG<passivedouble>::DenseLUSolve(n, lu, pivot, x);
+
+  for (iRow = 0; iRow < n; iRow++) {
+    if (pivot[iRow] != pivot_ref[iRow]) {
+      cout << "Wrong pivot of row " << iRow << ": " << pivot[iRow] << " instead of " << pivot_ref[iRow] << endl;
+      nFail++;
+    }
+    if (fabs(x[iRow]-x_ref[iRow]) > 1e-12) {
+      cout << "Wrong solution of row " << iRow << ": " << x[iRow] << " instead of " << x_ref[iRow] << endl;
+      nFail++;
+    }
+  }
+
+  if (nFail == 0) cout << "Dense LU of the coarsest AMG level: passed." << endl;
+
+  /*--- Galerkin coarse operator, A_c = P^T A P is compared with the dense product
+   on a small block system. The blocks are not symmetric, so the transposition
+   of the blocks of P is checked too. ---*/
+
+  {
+    const unsigned long nx = 12, ny = 12, nVar = 2, nPoint = nx*ny;
+    const passivedouble B[] = {1.0, 0.3, -0.2, 1.5};
+    unsigned long iVar, kRow;
+    int nFailGalerkin = 0;
+
+    vector<su2sparseidx> row_ptr, col_ind;
+    vector<passivedouble> val;
+    Poisson(nx, ny, nVar, B, row_ptr, col_ind, val);
+
+    CSysAMG<passivedouble> amg;
+    amg.Build(nPoint, nVar, &row_ptr[0], &col_ind[0], &val[0], false, 2, 0.08);
+
+    if (amg.GetnLevel() != 2) {
+      cout << "The hierarchy of the Galerkin test has " << amg.GetnLevel() << " levels instead of 2." << endl;
+      nFailGalerkin++;
+    }
+    else {
+      vector<unsigned long> a_row_ptr, a_col_ind, p_row_ptr, p_col_ind, c_row_ptr, c_col_ind, tmp_row_ptr, tmp_col_ind;
+      vector<passivedouble> a_val, p_val, c_val, tmp_val;
+
+      amg.GetLevel(0, a_row_ptr, a_col_ind, a_val, p_row_ptr, p_col_ind, p_val);
+      amg.GetLevel(1, c_row_ptr, c_col_ind, c_val, tmp_row_ptr, tmp_col_ind, tmp_val);
+
+      const unsigned long nCoarse = c_row_ptr.size()-1;
+      const unsigned long nf = nPoint*nVar, nc = nCoarse*nVar;
+
+      vector<passivedouble> A_d = Dense(nPoint, nPoint, nVar, a_row_ptr, a_col_ind, a_val);
+      vector<passivedouble> P_d = Dense(nPoint, nCoarse, nVar, p_row_ptr, p_col_ind, p_val);
+      vector<passivedouble> C_d = Dense(nCoarse, nCoarse, nVar, c_row_ptr, c_col_ind, c_val);
+      vector<passivedouble> AP(nf*nc, 0.0);
+
+      for (iRow = 0; iRow < nf; iRow++)
+        for (kRow = 0; kRow < nf; kRow++)
+          if (A_d[iRow*nf+kRow] != 0.0)
+            for (jRow = 0; jRow < nc; jRow++) AP[iRow*nc+jRow] += A_d[iRow*nf+kRow]*P_d[kRow*nc+jRow];
+
+      passivedouble maxError = 0.0, maxValue = 0.0;
+
+      for (iRow = 0; iRow < nc; iRow++) {
+        for (jRow = 0; jRow < nc; jRow++) {
+          passivedouble ref = 0.0;
+          for (kRow = 0; kRow < nf; kRow++) ref += P_d[kRow*nc+iRow]*AP[kRow*nc+jRow];
+          maxError = max(maxError, fabs(C_d[iRow*nc+jRow]-ref));
+          maxValue = max(maxValue, fabs(ref));
+        }
+      }
+
+      if (maxError > 1e-12*maxValue) {
+        cout << "Wrong Galerkin coarse operator, maximum error " << maxError << " (maximum entry " << maxValue << ")." << endl;
+        nFailGalerkin++;
+      }
+
+      /*--- The prolongation of a constant field of each variable must be nonzero
+       on every fine point (each point belongs to one aggregate). ---*/
+
+      for (iVar = 0; iVar < nf; iVar++) {
+        passivedouble rowSum = 0.0;
+        for (jRow = 0; jRow < nc; jRow++) rowSum += fabs(P_d[iVar*nc+jRow]);
+        if (rowSum == 0.0) { nFailGalerkin++; break; }
+      }
+      if (iVar < nf) cout << "Empty row " << iVar << " of the prolongation." << endl;
+    }
+
+    if (nFailGalerkin == 0) cout << "Galerkin coarse operator P^T A P: passed." << endl;
+    nFail += nFailGalerkin;
+  }
+
+  /*--- Convergence of the V-cycle used as a stationary iteration, x += M (b - A x),
+   on a Poisson problem. Each cycle must reduce the residual by a fixed factor,
+   independent of the number of cycles. The first cycle is only required to reduce
+   it, the l2 norm of the residual is not the norm in which the cycle contracts. ---*/
+
+  {
+    const unsigned long nx = 40, ny = 40, nVar = 1, nPoint = nx*ny, nCycle = 12;
+    const passivedouble B[] = {1.0};
+    const passivedouble MaxRate = 0.5;
+    unsigned long iVar, iCycle;
+    int nFailCycle = 0;
+
+    vector<su2sparseidx> row_ptr, col_ind;
+    vector<passivedouble> val;
+    Poisson(nx, ny, nVar, B, row_ptr, col_ind, val);
+
+    CSysAMG<passivedouble> amg;
+    amg.Build(nPoint, nVar, &row_ptr[0], &col_ind[0], &val[0], false, 10, 0.08);
+
+    if (amg.GetnLevel() < 3) {
+      cout << "The hierarchy of the Poisson problem has only " << amg.GetnLevel() << " levels." << endl;
+      nFailCycle++;
+    }
+
+    vector<passivedouble> b(nPoint*nVar), x(nPoint*nVar, 0.0), r, dx(nPoint*nVar);
+    for (iVar = 0; iVar < nPoint*nVar; iVar++) b[iVar] = sin(0.37*iVar) + 0.5;
+
+    passivedouble res0 = ResidualNorm(nPoint, nVar, row_ptr, col_ind, val, b, x, r), res = res0, resOld;
+
+    for (iCycle = 0; iCycle < nCycle; iCycle++) {
+      amg.Apply(&r[0], &dx[0]);
+      for (iVar = 0; iVar < nPoint*nVar; iVar++) x[iVar] += dx[iVar];
+      resOld = res;
+      res = ResidualNorm(nPoint, nVar, row_ptr, col_ind, val, b, x, r);
+      if ((res >= resOld) || ((iCycle > 0) && (res > MaxRate*resOld))) {
+        cout << "V-cycle " << iCycle << " reduces the residual by " << res/resOld << " only." << endl;
+        nFailCycle++;
+      }
+    }
+
+    if (nFailCycle == 0)
+      cout << "V-cycle on a " << nx << "x" << ny << " Poisson problem (" << amg.GetnLevel() << " levels), residual reduced by "
+           << res/res0 << " in " << nCycle << " cycles: passed." << endl;
+    nFail += nFailCycle;
+  }
+
+  return (nFail == 0)? 0 : 1;
+
+}
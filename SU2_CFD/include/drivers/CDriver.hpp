@@ -68,7 +68,16 @@ protected:
             UsedTimePreproc,                    /*!< \brief Elapsed time between Start and Stop point of the timer for tracking preprocessing phase.*/
             UsedTimeCompute,                    /*!< \brief Elapsed time between Start and Stop point of the timer for tracking compute phase.*/
             UsedTimeOutput,                     /*!< \brief Elapsed time between Start and Stop point of the timer for tracking output phase.*/
-            UsedTime;                           /*!< \brief Elapsed time between Start and Stop point of the timer.*/
+            UsedTime,                           /*!< \brief Elapsed time between Start and Stop point of the timer.*/
+            UsedTimeBusy,                       /*!< \brief Time of the iterations of this rank without the time blocked in MPI (load balance).*/
+            IterStartTime,                      /*!< \brief Start point of the timer of the current iteration.*/
+            IterWaitTime,                       /*!< \brief Time blocked in MPI at the start of the current iteration.*/
+            LoadBalanceTime,                    /*!< \brief Value of UsedTimeBusy at the last check of the load imbalance.*/
+            ZoneStartTime,                      /*!< \brief Start point of the timer of the zone being iterated.*/
+            ZoneWaitTime;                       /*!< \brief Time blocked in MPI at the start of the iteration of the zone.*/
+  su2double *ZoneTimeBusy,                      /*!< \brief Time of the iterations of each zone on this rank without the time blocked in MPI.*/
+            *ZoneBalanceTime;                   /*!< \brief Value of ZoneTimeBusy at the last check of the load imbalance.*/
+  bool ZoneTimers;                              /*!< \brief The driver times the iterations of each zone (else the zones get the time of the rank).*/
   su2double BandwidthSum;                       /*!< \brief Aggregate value of the bandwidth for writing restarts (to be average later).*/
   unsigned long IterCount,                      /*!< \brief Iteration count stored for performance benchmarking.*/
   OutputCount;                                  /*!< \brief Output count stored for performance benchmarking.*/
@@ -88,13 +97,15 @@ protected:
   bool StopCalc,                                /*!< \brief Stop computation flag.*/
        mixingplane,                             /*!< \brief mixing-plane simulation flag.*/
        fsi,                                     /*!< \brief FSI simulation flag.*/
-       fem_solver;                              /*!< \brief FEM fluid solver simulation flag. */
+       fem_solver,                              /*!< \brief FEM fluid solver simulation flag. */
+       Rebalance;                               /*!< \brief Stop the computation to repartition the grid (load imbalance).*/
   CIteration ***iteration_container;             /*!< \brief Container vector with all the iteration methods. */
   COutput *output;                              /*!< \brief Pointer to the COutput class. */
   CIntegration ****integration_container;        /*!< \brief Container vector with all the integration methods. */
   CGeometry ****geometry_container;              /*!< \brief Geometrical definition of the problem. */
   CSolver *****solver_container;                 /*!< \brief Container vector with all the solutions. */
   CNumerics ******numerics_container;            /*!< \brief Description of the numerical method (the way in which the equations are solved). */
+  vector<CNumerics******> numerics_thread;      /*!< \brief Numerics of the other threads of the edge loops [THREAD-1][ZONE][INSTANCE][MG][EQ][TERM], only the edge terms are set. */
   CConfig **config_container;                   /*!< \brief Definition of the particular problem. */
   CConfig *driver_config;                       /*!< \brief Definition of the driver configuration. */
   CSurfaceMovement **surface_movement;          /*!< \brief Surface movement classes of the problem. */
@@ -219,6 +230,25 @@ protected:
    */
   void Numerics_Preprocessing(CConfig *config, CSolver ***solver, CNumerics ****&numerics);
 
+  /*!
+   * \brief Definition of the numerics of each thread of the threaded edge loops of the flow solvers.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] solver - Container vector with all the solutions.
+   * \param[in] numerics - Numerics of the master thread.
+   * \param[in] val_iInst - Current instance.
+   */
+  void Numerics_ThreadPreprocessing(CConfig *config, CSolver ***solver, CNumerics ****numerics, unsigned short val_iInst);
+
+  /*!
+   * \brief Build a new numerics object of the same class as one of the edge terms (convective or viscous) of the flow and turbulence solvers.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] solver - Solver (finest grid) of the equation of the numerics.
+   * \param[in] numerics - Numerics to be cloned.
+   * \param[in] iMGlevel - Grid level of the numerics.
+   * \return New numerics, NULL if the class is not one of the edge terms that can be cloned.
+   */
+  CNumerics *Numerics_Clone(CConfig *config, CSolver *solver, CNumerics *numerics, unsigned short iMGlevel);
+
   /*!
    * \brief Definition and allocation of all solver classes.
    * \param[in] numerics_container - Description of the numerical method (the way in which the equations are solved).
@@ -257,6 +287,41 @@ protected:
   
   void Output_Preprocessing(CConfig **config, COutput *&output);
 
+  /*!
+   * \brief Start the timer of an iteration, for the measurement of the load of this rank.
+   */
+  void StartIterTimer(void);
+
+  /*!
+   * \brief Stop the timer of an iteration, its time without the time blocked in MPI is added to UsedTimeBusy.
+   */
+  void StopIterTimer(void);
+
+  /*!
+   * \brief Start the timer of the iteration of a zone, for the weights of its partition.
+   * \param[in] val_iZone - Zone being iterated.
+   */
+  void StartZoneTimer(unsigned short val_iZone);
+
+  /*!
+   * \brief Stop the timer of the iteration of a zone, its time without the time blocked in MPI is added to ZoneTimeBusy.
+   * \param[in] val_iZone - Zone being iterated.
+   */
+  void StopZoneTimer(unsigned short val_iZone);
+
+  /*!
+   * \brief Write the point weights measured so far for the partitioning of the next run (WRT_PARTITION_WEIGHTS).
+   */
+  void WritePartitionWeights(void);
+
+  /*!
+   * \brief Check the load imbalance of the ranks every LOAD_BALANCE_FREQ iterations. Above the
+   *        threshold the point weights measured since the last check are written and, if requested,
+   *        the computation stops (with a restart) to be repartitioned with these weights.
+   * \param[in] val_iter - Current iteration.
+   */
+  void CheckLoadBalance(unsigned long val_iter);
+
   /*!
    * \brief A virtual member.
    * \param[in] donorZone - zone in which the displacements will be predicted.
@@ -443,6 +443,72 @@ public:
 
 };
 
+/*!
+ * \class CJacobianFreeProduct
+ * \brief Matrix-free Jacobian-vector product of the Newton-Krylov mode.
+ * \note The product is approximated by a finite difference of the complete (second order)
+ *       residual, R(u + eps*v) - R(u), plus the pseudo time term. The assembled approximate
+ *       Jacobian is only used to build the preconditioner of the linear system. One object is
+ *       built per solver (on the finest grid) and owned by it, the base state is updated every iteration.
+ */
+template<class ScalarType>
+class CJacobianFreeProduct : public CMatrixVectorProduct<ScalarType> {
+private:
+  CIntegration *integration;          /*!< \brief Integration object that evaluates the residual. */
+  CGeometry *geometry;                /*!< \brief Geometry of the finest grid. */
+  CSolver **solver_container;         /*!< \brief Solvers of the finest grid. */
+  CNumerics **numerics;               /*!< \brief Numerics of the solver being integrated. */
+  CConfig *config;                    /*!< \brief Definition of the particular problem. */
+  CSysMatrix<ScalarType> *Jacobian;   /*!< \brief Approximate Jacobian, used for the communication of the product. */
+
+  unsigned short RunTime_EqSystem;    /*!< \brief System of equations which is being solved. */
+  unsigned short MainSolver;          /*!< \brief Position of the solver in the container. */
+  unsigned short nVar;                /*!< \brief Number of variables of the system. */
+  unsigned long nPoint;               /*!< \brief Number of points, including halos. */
+  unsigned long nPointDomain;         /*!< \brief Number of points owned by this rank. */
+
+  su2double *Solution_Base;           /*!< \brief Solution about which the residual is linearized. */
+  su2double *Residual_Base;           /*!< \brief Residual of the base solution. */
+  su2double *Residual_Save;           /*!< \brief Copy of the residual vector of the solver (RHS of the system). */
+  su2double Norm_Solution;            /*!< \brief Global norm of the base solution. */
+  su2double StepSize;                 /*!< \brief Relative size of the finite difference step. */
+
+public:
+
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] val_integration - Integration object that evaluates the residual.
+   * \param[in] val_geometry - Geometrical definition of the problem.
+   * \param[in] val_solver_container - Container vector with all the solutions.
+   * \param[in] val_numerics - Description of the numerical method.
+   * \param[in] val_config - Definition of the particular problem.
+   * \param[in] val_Jacobian - Approximate Jacobian of the solver.
+   * \param[in] val_RunTime_EqSystem - System of equations which is going to be solved.
+   */
+  CJacobianFreeProduct(CIntegration *val_integration, CGeometry *val_geometry, CSolver **val_solver_container,
+                       CNumerics **val_numerics, CConfig *val_config, CSysMatrix<ScalarType> & val_Jacobian,
+                       unsigned short val_RunTime_EqSystem);
+
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CJacobianFreeProduct(void);
+
+  /*!
+   * \brief Store the state about which the residual is linearized, must be called right after
+   *        the residual of the base solution is computed.
+   */
+  void SetBase_State(void);
+
+  /*!
+   * \brief Operator that defines the matrix-free Jacobian-vector product.
+   * \param[in] u - CSysVector that is being multiplied by the Jacobian.
+   * \param[out] v - CSysVector that is the result of the product.
+   */
+  void operator()(const CSysVector<ScalarType> & u, CSysVector<ScalarType> & v) const;
+
+};
+
 /*!
  * \class CMultiGridIntegration
  * \brief Class for doing the numerical integration using a multigrid method.
@@ -5709,4 +5709,251 @@ public:
   void ComputeResidual(su2double *val_residual, su2double **val_Jacobian_i, su2double **val_Jacobian_j, CConfig *config);
 };
 
+/*!
+ * \class CFluxBatch_Flow
+ * \brief Base class of the convective flux kernels that evaluate a batch of edges at once.
+ * \ingroup ConvDiscr
+ *
+ * The data of the edges is stored with the edge (lane) index innermost, e.g. the
+ * primitive variable iVar of the k-th edge of the batch is V_i[iVar*BATCH_SIZE+k],
+ * so that the loops over the lanes of a batch can be vectorized by the compiler.
+ * The kernels do not go through the virtual CNumerics interface and are only
+ * meant for the passive (double) build, the per-edge CNumerics classes remain
+ * the general implementation.
+ */
+class CFluxBatch_Flow {
+public:
+
+  static const unsigned short BATCH_SIZE = 8; /*!< \brief Number of edges (lanes) of a batch. */
+
+protected:
+  unsigned short nDim,     /*!< \brief Number of dimensions of the problem. */
+  nVar,                    /*!< \brief Number of conservative variables. */
+  nPrimVar,                /*!< \brief Number of primitive variables copied per edge (velocity, P, rho, h, c). */
+  nEdge;                   /*!< \brief Number of edges currently in the batch. */
+  bool implicit;           /*!< \brief Compute the Jacobians. */
+  su2double Gamma,         /*!< \brief Ratio of specific heats. */
+  Gamma_Minus_One;         /*!< \brief Gamma - 1. */
+
+  unsigned long Point_i[BATCH_SIZE], /*!< \brief First point of each edge of the batch. */
+  Point_j[BATCH_SIZE];               /*!< \brief Second point of each edge of the batch. */
+
+  su2double *Normal,       /*!< \brief Normals of the edges (nDim x BATCH_SIZE). */
+  *V_i,                    /*!< \brief Primitive variables at the first points (nPrimVar x BATCH_SIZE). */
+  *V_j,                    /*!< \brief Primitive variables at the second points (nPrimVar x BATCH_SIZE). */
+  *Residual,               /*!< \brief Fluxes of the edges (nVar x BATCH_SIZE). */
+  *Jacobian_i,             /*!< \brief Jacobians w.r.t. the first points (nVar x nVar x BATCH_SIZE). */
+  *Jacobian_j;             /*!< \brief Jacobians w.r.t. the second points (nVar x nVar x BATCH_SIZE). */
+
+  /*!
+   * \brief Fill the unused lanes of a partial batch with a copy of the last edge,
+   *        so that the kernels never operate on uninitialized data.
+   */
+  virtual void PadBatch(void);
+
+  /*!
+   * \brief Evaluate the fluxes (and Jacobians) of all the lanes of the batch.
+   */
+  virtual void ComputeLanes(void) = 0;
+
+  /*!
+   * \brief Projected inviscid flux of one lane, same as CNumerics::GetInviscidProjFlux.
+   * \param[in] val_density - Density.
+   * \param[in] val_velocity - Velocity.
+   * \param[in] val_pressure - Pressure.
+   * \param[in] val_enthalpy - Total enthalpy.
+   * \param[in] val_normal - Normal vector.
+   * \param[out] val_Proj_Flux - Projected flux.
+   */
+  void ProjFlux(su2double val_density, const su2double *val_velocity, su2double val_pressure,
+                su2double val_enthalpy, const su2double *val_normal, su2double *val_Proj_Flux) const;
+
+  /*!
+   * \brief Projected inviscid Jacobian of one lane, same as CNumerics::GetInviscidProjJac.
+   * \param[in] val_velocity - Velocity.
+   * \param[in] val_energy - Total energy.
+   * \param[in] val_normal - Normal vector.
+   * \param[in] val_scale - Scale of the Jacobian.
+   * \param[in] val_lane - Lane of the batch.
+   * \param[out] val_Proj_Jac - Jacobians of the batch (nVar x nVar x BATCH_SIZE), only the lane is written.
+   */
+  void ProjJacobian(const su2double *val_velocity, su2double val_energy, const su2double *val_normal,
+                    su2double val_scale, unsigned short val_lane, su2double *val_Proj_Jac) const;
+
+public:
+
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] val_nDim - Number of dimension of the problem.
+   * \param[in] val_nVar - Number of variables of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  CFluxBatch_Flow(unsigned short val_nDim, unsigned short val_nVar, CConfig *config);
+
+  /*!
+   * \brief Destructor of the class.
+   */
+  virtual ~CFluxBatch_Flow(void);
+
+  /*!
+   * \brief Add an edge to the batch.
+   * \param[in] val_iPoint - First point of the edge.
+   * \param[in] val_jPoint - Second point of the edge.
+   * \param[in] val_normal - Normal vector of the edge.
+   * \param[in] val_v_i - Primitive variables at the first point.
+   * \param[in] val_v_j - Primitive variables at the second point.
+   * \return Lane of the batch that was assigned to the edge.
+   */
+  unsigned short SetEdge(unsigned long val_iPoint, unsigned long val_jPoint, const su2double *val_normal,
+                         const su2double *val_v_i, const su2double *val_v_j);
+
+  /*!
+   * \brief Evaluate the edges of the batch, the results are retrieved with GetResidual and GetJacobians.
+   */
+  void ComputeBatch(void);
+
+  /*!
+   * \brief Empty the batch.
+   */
+  void Clear(void);
+
+  /*!
+   * \brief Number of edges in the batch.
+   */
+  unsigned short GetnEdge(void) const;
+
+  /*!
+   * \brief Check if the batch cannot take more edges.
+   */
+  bool IsFull(void) const;
+
+  /*!
+   * \brief First point of the edge in a lane.
+   * \param[in] val_lane - Lane of the batch.
+   */
+  unsigned long GetPoint_i(unsigned short val_lane) const;
+
+  /*!
+   * \brief Second point of the edge in a lane.
+   * \param[in] val_lane - Lane of the batch.
+   */
+  unsigned long GetPoint_j(unsigned short val_lane) const;
+
+  /*!
+   * \brief Copy the flux of the edge in a lane.
+   * \param[in] val_lane - Lane of the batch.
+   * \param[out] val_residual - Flux of the edge.
+   */
+  void GetResidual(unsigned short val_lane, su2double *val_residual) const;
+
+  /*!
+   * \brief Copy the Jacobians of the edge in a lane.
+   * \param[in] val_lane - Lane of the batch.
+   * \param[out] val_Jacobian_i - Jacobian w.r.t. the first point.
+   * \param[out] val_Jacobian_j - Jacobian w.r.t. the second point.
+   */
+  void GetJacobians(unsigned short val_lane, su2double **val_Jacobian_i, su2double **val_Jacobian_j) const;
+
+};
+
+/*!
+ * \class CUpwRoeBatch_Flow
+ * \brief Batched version of CUpwRoe_Flow, for fixed grids and without low dissipation.
+ * \ingroup ConvDiscr
+ *
+ * The Roe matrix |A| = P |Lambda| P^-1 is assembled from its acoustic eigenvectors,
+ * |A| = |l_u| I + (|l_+|-|l_u|) r_+ l_+^T + (|l_-|-|l_u|) r_- l_-^T, which is the same
+ * operator as in CUpwRoe_Flow (the convective eigenvalues are equal) without the
+ * dense triple product, and the same expressions hold in 2D and 3D.
+ */
+class CUpwRoeBatch_Flow : public CFluxBatch_Flow {
+private:
+  su2double kappa,          /*!< \brief Blending of the central and upwind fluxes. */
+  EntropyFix_Coeff;         /*!< \brief Entropy fix coefficient. */
+
+  /*!
+   * \brief Evaluate the Roe fluxes of all the lanes of the batch.
+   */
+  void ComputeLanes(void);
+
+public:
+
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] val_nDim - Number of dimension of the problem.
+   * \param[in] val_nVar - Number of variables of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  CUpwRoeBatch_Flow(unsigned short val_nDim, unsigned short val_nVar, CConfig *config);
+
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CUpwRoeBatch_Flow(void);
+
+};
+
+/*!
+ * \class CCentJSTBatch_Flow
+ * \brief Batched version of CCentJST_Flow, for fixed grids.
+ * \ingroup ConvDiscr
+ */
+class CCentJSTBatch_Flow : public CFluxBatch_Flow {
+private:
+  su2double Param_p, Param_Kappa_2, Param_Kappa_4; /*!< \brief Artificial dissipation parameters. */
+  su2double fix_factor;     /*!< \brief Fix factor for the dissipation Jacobians. */
+
+  su2double *Lambda_i,      /*!< \brief Spectral radius at the first points (BATCH_SIZE). */
+  *Lambda_j,                /*!< \brief Spectral radius at the second points (BATCH_SIZE). */
+  *Neighbor_i,              /*!< \brief Number of neighbors of the first points (BATCH_SIZE). */
+  *Neighbor_j,              /*!< \brief Number of neighbors of the second points (BATCH_SIZE). */
+  *Sensor_i,                /*!< \brief Pressure sensor at the first points (BATCH_SIZE). */
+  *Sensor_j,                /*!< \brief Pressure sensor at the second points (BATCH_SIZE). */
+  *Und_Lapl_i,              /*!< \brief Undivided Laplacian at the first points (nVar x BATCH_SIZE). */
+  *Und_Lapl_j;              /*!< \brief Undivided Laplacian at the second points (nVar x BATCH_SIZE). */
+
+  /*!
+   * \brief Fill the unused lanes, including the dissipation inputs.
+   */
+  void PadBatch(void);
+
+  /*!
+   * \brief Evaluate the JST fluxes of all the lanes of the batch.
+   */
+  void ComputeLanes(void);
+
+public:
+
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] val_nDim - Number of dimension of the problem.
+   * \param[in] val_nVar - Number of variables of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  CCentJSTBatch_Flow(unsigned short val_nDim, unsigned short val_nVar, CConfig *config);
+
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CCentJSTBatch_Flow(void);
+
+  /*!
+   * \brief Set the inputs of the artificial dissipation of the edge in a lane.
+   * \param[in] val_lane - Lane of the batch (returned by SetEdge).
+   * \param[in] val_lambda_i - Spectral radius at the first point.
+   * \param[in] val_lambda_j - Spectral radius at the second point.
+   * \param[in] val_neighbor_i - Number of neighbors of the first point.
+   * \param[in] val_neighbor_j - Number of neighbors of the second point.
+   * \param[in] val_sensor_i - Pressure sensor at the first point.
+   * \param[in] val_sensor_j - Pressure sensor at the second point.
+   * \param[in] val_und_lapl_i - Undivided Laplacian at the first point.
+   * \param[in] val_und_lapl_j - Undivided Laplacian at the second point.
+   */
+  void SetDissipation(unsigned short val_lane, su2double val_lambda_i, su2double val_lambda_j,
+                      unsigned short val_neighbor_i, unsigned short val_neighbor_j,
+                      su2double val_sensor_i, su2double val_sensor_j,
+                      const su2double *val_und_lapl_i, const su2double *val_und_lapl_j);
+
+};
+
 #include "numerics_structure.inl"
@@ -587,3 +587,71 @@ inline su2double CAvgGrad_Base::GetHeatFluxVector(unsigned short iDim) const {
 }
 
 inline void CNumerics::SetUsing_UQ(bool val_using_uq) { using_uq = val_using_uq; }
+
+inline void CFluxBatch_Flow::Clear(void) { nEdge = 0; }
+
+inline unsigned short CFluxBatch_Flow::GetnEdge(void) const { return nEdge; }
+
+inline bool CFluxBatch_Flow::IsFull(void) const { return nEdge == BATCH_SIZE; }
+
+inline unsigned long CFluxBatch_Flow::GetPoint_i(unsigned short val_lane) const { return Point_i[val_lane]; }
+
+inline unsigned long CFluxBatch_Flow::GetPoint_j(unsigned short val_lane) const { return Point_j[val_lane]; }
+
+inline void CFluxBatch_Flow::ProjFlux(su2double val_density, const su2double *val_velocity, su2double val_pressure,
+                                      su2double val_enthalpy, const su2double *val_normal, su2double *val_Proj_Flux) const {
+
+  su2double ProjVel = 0.0;
+  for (unsigned short iDim = 0; iDim < nDim; iDim++)
+    ProjVel += val_velocity[iDim]*val_normal[iDim];
+
+  su2double MassFlux = val_density*ProjVel;
+
+  val_Proj_Flux[0] = MassFlux;
+  for (unsigned short iDim = 0; iDim < nDim; iDim++)
+    val_Proj_Flux[iDim+1] = MassFlux*val_velocity[iDim] + val_pressure*val_normal[iDim];
+  val_Proj_Flux[nDim+1] = MassFlux*val_enthalpy;
+
+}
+
+inline void CFluxBatch_Flow::ProjJacobian(const su2double *val_velocity, su2double val_energy, const su2double *val_normal,
+                                          su2double val_scale, unsigned short val_lane, su2double *val_Proj_Jac) const {
+
+  const unsigned short W = BATCH_SIZE;
+  unsigned short iDim, jDim;
+  su2double sqvel = 0.0, proj_vel = 0.0;
+
+  for (iDim = 0; iDim < nDim; iDim++) {
+    sqvel    += val_velocity[iDim]*val_velocity[iDim];
+    proj_vel += val_velocity[iDim]*val_normal[iDim];
+  }
+
+  su2double phi = 0.5*Gamma_Minus_One*sqvel;
+  su2double a1 = Gamma*val_energy-phi;
+  su2double a2 = Gamma_Minus_One;
+
+  /*--- Entry (iVar,jVar) of the lane is at (iVar*nVar+jVar)*W+val_lane. ---*/
+
+  su2double *Jac = &val_Proj_Jac[val_lane];
+
+  Jac[0] = 0.0;
+  for (iDim = 0; iDim < nDim; iDim++)
+    Jac[(iDim+1)*W] = val_scale*val_normal[iDim];
+  Jac[(nDim+1)*W] = 0.0;
+
+  for (iDim = 0; iDim < nDim; iDim++) {
+    su2double *Row = &Jac[(iDim+1)*nVar*W];
+    Row[0] = val_scale*(val_normal[iDim]*phi - val_velocity[iDim]*proj_vel);
+    for (jDim = 0; jDim < nDim; jDim++)
+      Row[(jDim+1)*W] = val_scale*(val_normal[jDim]*val_velocity[iDim]-a2*val_normal[iDim]*val_velocity[jDim]);
+    Row[(iDim+1)*W] += val_scale*proj_vel;
+    Row[(nDim+1)*W] = val_scale*a2*val_normal[iDim];
+  }
+
+  su2double *Row = &Jac[(nDim+1)*nVar*W];
+  Row[0] = val_scale*proj_vel*(phi-a1);
+  for (iDim = 0; iDim < nDim; iDim++)
+    Row[(iDim+1)*W] = val_scale*(val_normal[iDim]*a1-a2*val_velocity[iDim]*proj_vel);
+  Row[(nDim+1)*W] = val_scale*Gamma*proj_vel;
+
+}
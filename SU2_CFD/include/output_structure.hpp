@@ -644,12 +644,12 @@ public:
   void SetSU2_MeshASCII(CConfig *config, CGeometry *geometry, unsigned short val_iZone, ofstream &output_file);
   
   /*!
-   * \brief Write the nodal coordinates and connectivity to a Tecplot binary mesh file.
+   * \brief Write the nodal coordinates and connectivity to an SU2_BINARY mesh file.
    * \param[in] config - Definition of the particular problem.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] val_iZone - iZone index.
    */
-  void SetSU2_MeshBinary(CConfig *config, CGeometry *geometry);
+  void SetSU2_MeshBinary(CConfig *config, CGeometry *geometry, unsigned short val_iZone);
   
   /*!
    * \brief Write the nodal coordinates to a binary file.
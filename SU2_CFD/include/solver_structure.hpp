@@ -41,6 +41,7 @@
 #pragma once
 
 #include "../../Common/include/mpi_structure.hpp"
+#include "../../Common/include/omp_structure.hpp"
 
 #include <cmath>
 #include <string>
@@ -69,9 +70,48 @@
 #include "../../Common/include/blas_structure.hpp"
 #include "../../Common/include/graph_coloring_structure.hpp"
 #include "../../Common/include/toolboxes/MMS/CVerificationSolution.hpp"
+#include "../../Common/include/toolboxes/CReproducibleSum.hpp"
 
 using namespace std;
 
+template<class ScalarType> class CJacobianFreeProduct;   // Forward declaration to avoid problems.
+
+/*!
+ * \class CEdgeLoopWork
+ * \brief Auxiliary arrays of one thread of the threaded edge loops (the auxiliary
+ *        arrays of the solver, Res_Conv, Jacobian_i, ..., are shared by all threads).
+ */
+class CEdgeLoopWork {
+public:
+  unsigned short nVar;     /*!< \brief Number of variables of the residual and Jacobians. */
+  su2double *Vector_i,     /*!< \brief Vector from point i to the middle of the edge (nDim). */
+  *Vector_j,               /*!< \brief Vector from point j to the middle of the edge (nDim). */
+  *Primitive_i,            /*!< \brief Reconstructed primitive variables at point i. */
+  *Primitive_j,            /*!< \brief Reconstructed primitive variables at point j. */
+  *Secondary_i,            /*!< \brief Reconstructed secondary variables at point i. */
+  *Secondary_j,            /*!< \brief Reconstructed secondary variables at point j. */
+  *Solution_i,             /*!< \brief Reconstructed solution at point i (nVar). */
+  *Solution_j,             /*!< \brief Reconstructed solution at point j (nVar). */
+  *Residual;               /*!< \brief Flux of the edge (nVar). */
+  su2double **Jacobian_i,  /*!< \brief Jacobian of the flux w.r.t. the variables of point i. */
+  **Jacobian_j;            /*!< \brief Jacobian of the flux w.r.t. the variables of point j. */
+
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] val_nDim - Number of dimensions of the problem.
+   * \param[in] val_nVar - Number of variables of the problem.
+   * \param[in] val_nPrimVar - Number of primitive variables to reconstruct.
+   * \param[in] val_nSecondaryVar - Number of secondary variables to reconstruct.
+   */
+  CEdgeLoopWork(unsigned short val_nDim, unsigned short val_nVar,
+                unsigned short val_nPrimVar, unsigned short val_nSecondaryVar);
+
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CEdgeLoopWork(void);
+};
+
 /*!
  * \class CSolver
  * \brief Main class for defining the PDE solution, it requires
@@ -84,6 +124,7 @@ protected:
   size;       	/*!< \brief MPI Size. */
   unsigned short MGLevel;        /*!< \brief Multigrid level of this solver object. */
   unsigned short IterLinSolver;  /*!< \brief Linear solver iterations. */
+  bool ResidualOnly;             /*!< \brief Only the residual is evaluated, the Jacobian is not assembled (matrix-free products, lagged Jacobian). */
   unsigned short nVar,          /*!< \brief Number of variables of the problem. */
   nPrimVar,                     /*!< \brief Number of primitive variables of the problem. */
   nPrimVarGrad,                 /*!< \brief Number of primitive variables of the problem in the gradient computation. */
@@ -100,6 +141,7 @@ protected:
   *Residual,            /*!< \brief Auxiliary nVar vector. */
   *Residual_i,          /*!< \brief Auxiliary nVar vector for storing the residual at point i. */
   *Residual_j;          /*!< \brief Auxiliary nVar vector for storing the residual at point j. */
+  vector<CReproducibleSum> Residual_RMS_Sum; /*!< \brief Exact sums of Residual_RMS (REPRODUCIBLE_REDUCTIONS). */
   su2double *Residual_BGS,  /*!< \brief Vector with the mean residual for each variable for BGS subiterations. */
   *Residual_Max_BGS;        /*!< \brief Vector with the maximal residual for each variable for BGS subiterations. */
   unsigned long *Point_Max; /*!< \brief Vector with the maximal residual for each variable. */
@@ -145,18 +187,23 @@ protected:
 
   bool rotate_periodic;    /*!< \brief Flag that controls whether the periodic solution needs to be rotated for the solver. */
   bool implicit_periodic;  /*!< \brief Flag that controls whether the implicit system should be treated by the periodic BC comms. */
-  
+
+  vector<CNumerics**> ThreadNumerics;  /*!< \brief Numerics (by term) of each thread of the edge loops, the master thread uses the numerics of the driver. */
+  vector<CEdgeLoopWork*> EdgeLoopWork; /*!< \brief Work arrays of each thread of the edge loops (empty if the solver has no edge loops). */
+
 public:
   
   CSysVector<su2double> LinSysSol;    /*!< \brief vector to store iterative solution of implicit linear system. */
   CSysVector<su2double> LinSysRes;    /*!< \brief vector to store iterative residual of implicit linear system. */
   CSysVector<su2double> LinSysAux;    /*!< \brief vector to store iterative residual of implicit linear system. */
 #ifndef CODI_FORWARD_TYPE
-  CSysMatrix<passivedouble> Jacobian; /*!< \brief Complete sparse Jacobian structure for implicit computations. */
-  CSysSolve<passivedouble>  System;   /*!< \brief Linear solver/smoother. */
+  CSysMatrix<su2mixedfloat> Jacobian; /*!< \brief Complete sparse Jacobian structure for implicit computations. */
+  CSysSolve<su2mixedfloat>  System;   /*!< \brief Linear solver/smoother. */
+  CJacobianFreeProduct<su2mixedfloat> *JacobianFree_Product; /*!< \brief Matrix-free product of the Newton-Krylov mode (NULL if not active). */
 #else
   CSysMatrix<su2double> Jacobian;
   CSysSolve<su2double>  System;
+  CJacobianFreeProduct<su2double> *JacobianFree_Product;
 #endif
   
   CSysMatrix<su2double> StiffMatrix; /*!< \brief Sparse structure for storing the stiffness matrix in Galerkin computations, and grid movement. */
@@ -165,6 +212,7 @@ public:
   string* OutputHeadingNames; /*< \brief vector of strings to store the headings for the exra variables */
   
   CVariable** node;  /*!< \brief Vector which the define the variables for each problem. */
+  CVariableStorage* nodeStorage; /*!< \brief Contiguous storage of the main fields of node (NULL if not used). */
   CVariable* node_infty; /*!< \brief CVariable storing the free stream conditions. */
   
   CVerificationSolution *VerificationSolution; /*!< \brief Verification solution class used within the solver. */
@@ -199,6 +247,14 @@ public:
                      CConfig *config,
                      unsigned short commType);
   
+  /*!
+   * \brief Get the array into which the point-to-point comms of a quantity are received in place.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] commType - Enumerated type for the quantity to be communicated.
+   * \return Contiguous block of the quantity, NULL if it goes through the comm buffers.
+   */
+  su2double *GetInPlace_Data(CGeometry *geometry, unsigned short commType);
+  
   /*!
    * \brief Routine to load a solver quantity into the data structures for MPI periodic communication and to launch non-blocking sends and recvs.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -229,6 +285,18 @@ public:
    */
   void SetIterLinSolver(unsigned short val_iterlinsolver);
   
+  /*!
+   * \brief Evaluate only the residual in the preprocessing and the space integration, the Jacobian is not assembled.
+   * \param[in] val_residualonly - <code>TRUE</code> while the residual of a perturbed solution is evaluated, or while the Jacobian of a previous iteration is kept.
+   */
+  void SetResidualOnly(bool val_residualonly);
+
+  /*!
+   * \brief Check if only the residual is evaluated.
+   * \return <code>TRUE</code> if the Jacobian is not assembled.
+   */
+  bool GetResidualOnly(void);
+
   /*!
    * \brief Set the value of the max residual and RMS residual.
    * \param[in] val_iterlinsolver - Number of linear iterations.
@@ -325,6 +393,27 @@ public:
    * \brief Get the number of variables of the problem.
    */
   unsigned short GetnOutputVariables(void);
+
+  /*!
+   * \brief Set the numerics used by one of the threads of the edge loops.
+   * \param[in] val_thread - Index of the thread (the master thread, 0, uses the numerics of the driver).
+   * \param[in] val_numerics - Numerics of the thread, by term.
+   */
+  void SetThreadNumerics(unsigned short val_thread, CNumerics **val_numerics);
+
+  /*!
+   * \brief Check if every thread has its own numerics, otherwise the edge loops are run by the master thread.
+   * \return <code>TRUE</code> if the edge loops can be threaded.
+   */
+  bool GetThreaded_EdgeLoops(void);
+
+  /*!
+   * \brief Get the numerics of the calling thread.
+   * \param[in] numerics - Numerics of the master thread.
+   * \param[in] val_term - Term of the numerics (CONV_TERM, VISC_TERM, ...).
+   * \return Numerics to be used by the thread.
+   */
+  CNumerics *GetThreadNumerics(CNumerics *numerics, unsigned short val_term);
   
   /*!
    * \brief A virtual member.
@@ -4844,6 +4933,9 @@ protected:
 
   CFluidModel  *FluidModel;  /*!< \brief fluid model used in the solver */
 
+  vector<CUpwRoeBatch_Flow*> RoeBatch;    /*!< \brief Batched Roe kernel of each thread of the edge loops (empty if not used). */
+  vector<CCentJSTBatch_Flow*> JSTBatch;   /*!< \brief Batched JST kernel of each thread of the edge loops (empty if not used). */
+
   /*--- Turbomachinery Solver Variables ---*/
   su2double *** AverageFlux,
             ***SpanTotalFlux,
@@ -5000,12 +5092,22 @@ public:
   void Upwind_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics,
                        CConfig *config, unsigned short iMesh);
   
+  /*!
+   * \brief Evaluate the edges of a batched convective kernel and add their fluxes
+   *        (and Jacobians) to the residual (and the system matrix), then empty the batch.
+   * \param[in] batch - Batched convective kernel.
+   * \param[in] work - Auxiliary arrays of the thread that owns the batch.
+   * \param[in] implicit - Update the Jacobian.
+   */
+  void Flush_ConvBatch(CFluxBatch_Flow *batch, CEdgeLoopWork *work, bool implicit);
+  
   /*!
    * \brief Compute the extrapolated quantities, for MUSCL upwind 2nd reconstruction,
    * in a more thermodynamic consistent way
+   * \param[in,out] work - Reconstructed primitive and secondary variables of the edge.
    * \param[in] config - Definition of the particular problem.
    */
-  void ComputeConsExtrapolation(CConfig *config);
+  void ComputeConsExtrapolation(CEdgeLoopWork *work, CConfig *config);
 
   /*!
    * \brief Source term integration.
@@ -39,6 +39,10 @@
 
 inline void CSolver::SetIterLinSolver(unsigned short val_iterlinsolver) { IterLinSolver = val_iterlinsolver; }
 
+inline void CSolver::SetResidualOnly(bool val_residualonly) { ResidualOnly = val_residualonly; }
+
+inline bool CSolver::GetResidualOnly(void) { return ResidualOnly; }
+
 inline void CSolver::SetNondimensionalization(CConfig *config, unsigned short iMesh) { }
 
 inline unsigned short CSolver::GetIterLinSolver(void) { return IterLinSolver; }
@@ -876,9 +880,19 @@ inline void CSolver::GeneralizedAlpha_UpdateLoads(CGeometry *geometry, CSolver *
 inline void CSolver::Compute_Residual(CGeometry *geometry, CSolver **solver_container, CConfig *config, 
                     unsigned short iMesh) { }
 
-inline void CSolver::SetRes_RMS(unsigned short val_var, su2double val_residual) { Residual_RMS[val_var] = val_residual; }
+inline void CSolver::SetRes_RMS(unsigned short val_var, su2double val_residual) {
+  Residual_RMS[val_var] = val_residual;
+  if (CReproducibleSum::GetActive()) {
+    if (Residual_RMS_Sum.size() < nVar) Residual_RMS_Sum.resize(nVar);
+    Residual_RMS_Sum[val_var].Clear();
+    Residual_RMS_Sum[val_var].Add(SU2_TYPE::GetValue(val_residual));
+  }
+}
 
-inline void CSolver::AddRes_RMS(unsigned short val_var, su2double val_residual) { Residual_RMS[val_var] += val_residual; }
+inline void CSolver::AddRes_RMS(unsigned short val_var, su2double val_residual) {
+  Residual_RMS[val_var] += val_residual;
+  if (!Residual_RMS_Sum.empty()) Residual_RMS_Sum[val_var].Add(SU2_TYPE::GetValue(val_residual));
+}
 
 inline su2double CSolver::GetRes_RMS(unsigned short val_var) { return Residual_RMS[val_var]; }
 
@@ -950,6 +964,18 @@ inline unsigned short CSolver::GetnVar(void) { return nVar; }
 
 inline unsigned short CSolver::GetnOutputVariables(void) { return nOutputVariables; }
 
+inline void CSolver::SetThreadNumerics(unsigned short val_thread, CNumerics **val_numerics) {
+  if (ThreadNumerics.size() <= val_thread) ThreadNumerics.resize(val_thread+1, NULL);
+  ThreadNumerics[val_thread] = val_numerics;
+}
+
+inline bool CSolver::GetThreaded_EdgeLoops(void) { return (ThreadNumerics.size() == (unsigned long)omp_get_max_threads()); }
+
+inline CNumerics *CSolver::GetThreadNumerics(CNumerics *numerics, unsigned short val_term) {
+  int iThread = omp_get_thread_num();
+  return (iThread == 0)? numerics : ThreadNumerics[iThread][val_term];
+}
+
 inline unsigned short CSolver::GetnPrimVar(void) { return nPrimVar; }
 
 inline unsigned short CSolver::GetnPrimVarGrad(void) { return nPrimVarGrad; }
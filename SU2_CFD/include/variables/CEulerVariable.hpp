@@ -105,6 +105,14 @@ public:
    */
   virtual ~CEulerVariable(void);
 
+  /*!
+   * \brief Move the solution, primitive variables and their gradients and limiters
+   *        of this point into the contiguous storage of the solver.
+   * \param[in] storage - Contiguous storage of the solver.
+   * \param[in] iPoint - Index of this point in the storage.
+   */
+  void SetExternalStorage(CVariableStorage *storage, unsigned long iPoint);
+
   /*!
    * \brief Get the new solution of the problem (Classical RK4).
    * \param[in] val_var - Index of the variable.
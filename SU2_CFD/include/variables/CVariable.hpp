@@ -47,6 +47,7 @@
 
 #include "../../../Common/include/config_structure.hpp"
 #include "../fluid_model.hpp"
+#include "CVariableStorage.hpp"
 
 
 using namespace std;
@@ -97,6 +98,7 @@ protected:
                                                        note that this variable cannnot be static, it is possible to
                                                        have different number of nVar in the same problem. */
   su2double *Solution_Adj_Old;    /*!< \brief Solution of the problem in the previous AD-BGS iteration. */
+  bool External_Storage;    /*!< \brief The main fields point into a CVariableStorage owned by the solver. */
 
 public:
 
@@ -125,6 +127,20 @@ public:
    */
   virtual ~CVariable(void);
 
+  /*!
+   * \brief Move the solution, gradient and limiter of this point into the contiguous storage
+   *        of the solver. The current values are copied and the per-point arrays are released.
+   * \param[in] storage - Contiguous storage of the solver.
+   * \param[in] iPoint - Index of this point in the storage.
+   */
+  virtual void SetExternalStorage(CVariableStorage *storage, unsigned long iPoint);
+
+  /*!
+   * \brief Get whether the main fields live in a CVariableStorage.
+   * \return <code>TRUE</code> if the fields are stored externally.
+   */
+  inline bool GetExternalStorage(void) const { return External_Storage; }
+
   /*!
    * \brief Set the value of the solution.
    * \param[in] val_solution - Solution of the problem.
@@ -0,0 +1,188 @@
+/*!
+ * \file CVariableStorage.hpp
+ * \brief Declaration of the contiguous (structure-of-arrays) storage of the
+ *        per-point solution fields, function definitions in file <i>CVariableStorage.cpp</i>.
+ * \version 6.2.0 "Falcon"
+ *
+ * The current SU2 release has been coordinated by the
+ * SU2 International Developers Society <www.su2devsociety.org>
+ * with selected contributions from the open-source community.
+ *
+ * The main research teams contributing to the current release are:
+ *  - Prof. Juan J. Alonso's group at Stanford University.
+ *  - Prof. Piero Colonna's group at Delft University of Technology.
+ *  - Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+ *  - Prof. Alberto Guardone's group at Polytechnic University of Milan.
+ *  - Prof. Rafael Palacios' group at Imperial College London.
+ *  - Prof. Vincent Terrapon's group at the University of Liege.
+ *  - Prof. Edwin van der Weide's group at the University of Twente.
+ *  - Lab. of New Concepts in Aeronautics at Tech. Institute of Aeronautics.
+ *
+ * Copyright 2012-2019, Francisco D. Palacios, Thomas D. Economon,
+ *                      Tim Albring, and the SU2 contributors.
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../../Common/include/mpi_structure.hpp"
+
+#include <cstdlib>
+
+using namespace std;
+
+/*!
+ * \class CVariableStorage
+ * \brief Contiguous storage of the fields that are accessed in the edge loops
+ *        (solution, gradients, limiters, and primitive variables).
+ *
+ * Each quantity is stored in a single aligned block indexed by point, e.g.
+ * the solution of point i starts at Solution[i*nVar]. The CVariable objects of
+ * a solver are attached to the storage (see CVariable::SetExternalStorage) and
+ * afterwards their pointers refer to these blocks, so the per-point interface
+ * keeps working while loops over points or edges can read the blocks directly.
+ */
+class CVariableStorage {
+private:
+  unsigned long nPoint;          /*!< \brief Number of points stored. */
+  unsigned short nDim,           /*!< \brief Number of dimensions of the problem. */
+  nVar,                          /*!< \brief Number of (conservative) variables. */
+  nPrimVar,                      /*!< \brief Number of primitive variables (0 if not stored). */
+  nPrimVarGrad;                  /*!< \brief Number of primitive variables with gradients (0 if not stored). */
+
+  su2double *Solution,           /*!< \brief Solution block (nPoint x nVar). */
+  *Solution_Old,                 /*!< \brief Old solution block (nPoint x nVar). */
+  *Gradient,                     /*!< \brief Gradient of the solution (nPoint x nVar x nDim). */
+  *Limiter,                      /*!< \brief Limiter of the solution (nPoint x nVar). */
+  *Primitive,                    /*!< \brief Primitive variables (nPoint x nPrimVar). */
+  *Gradient_Primitive,           /*!< \brief Gradient of the primitive variables (nPoint x nPrimVarGrad x nDim). */
+  *Limiter_Primitive;            /*!< \brief Limiter of the primitive variables (nPoint x nPrimVarGrad). */
+
+  su2double **Gradient_Rows,     /*!< \brief Row pointers into Gradient, to keep the su2double** interface of CVariable. */
+  **Gradient_Primitive_Rows;     /*!< \brief Row pointers into Gradient_Primitive. */
+
+  char **RawBlock;               /*!< \brief Unaligned allocations backing the blocks above. */
+  unsigned short nRawBlock;      /*!< \brief Number of raw allocations. */
+
+  /*!
+   * \brief Allocate and zero-initialize an aligned block of su2double.
+   * \param[in] size - Number of entries of the block.
+   * \return Pointer to the aligned block (NULL if size is 0).
+   */
+  su2double *AllocateBlock(unsigned long size);
+
+  /*!
+   * \brief Release a block created by AllocateBlock.
+   * \param[in] block - Pointer to the block.
+   * \param[in] size - Number of entries of the block.
+   */
+  void FreeBlock(su2double *block, unsigned long size);
+
+public:
+
+  /*!
+   * \brief Alignment (bytes) of every block, one cache line.
+   */
+  static const unsigned short ALIGNMENT = 64;
+
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] val_nPoint - Number of points of the grid (including halos).
+   * \param[in] val_nDim - Number of dimensions of the problem.
+   * \param[in] val_nVar - Number of variables of the problem.
+   * \param[in] val_nPrimVar - Number of primitive variables (0 for solvers without primitives).
+   * \param[in] val_nPrimVarGrad - Number of primitive variables whose gradients are stored.
+   */
+  CVariableStorage(unsigned long val_nPoint, unsigned short val_nDim, unsigned short val_nVar,
+                   unsigned short val_nPrimVar = 0, unsigned short val_nPrimVarGrad = 0);
+
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CVariableStorage(void);
+
+  /*!
+   * \brief Get the number of points.
+   */
+  inline unsigned long GetnPoint(void) const { return nPoint; }
+
+  /*!
+   * \brief Get the number of variables.
+   */
+  inline unsigned short GetnVar(void) const { return nVar; }
+
+  /*!
+   * \brief Get the number of primitive variables.
+   */
+  inline unsigned short GetnPrimVar(void) const { return nPrimVar; }
+
+  /*!
+   * \brief Get the number of primitive variables with gradients.
+   */
+  inline unsigned short GetnPrimVarGrad(void) const { return nPrimVarGrad; }
+
+  /*!
+   * \brief Get the solution of a point.
+   * \param[in] iPoint - Index of the point.
+   */
+  inline su2double *GetSolution(unsigned long iPoint) { return &Solution[iPoint*nVar]; }
+
+  /*!
+   * \brief Get the old solution of a point.
+   * \param[in] iPoint - Index of the point.
+   */
+  inline su2double *GetSolution_Old(unsigned long iPoint) { return &Solution_Old[iPoint*nVar]; }
+
+  /*!
+   * \brief Get the gradient of the solution of a point.
+   * \param[in] iPoint - Index of the point.
+   */
+  inline su2double **GetGradient(unsigned long iPoint) { return &Gradient_Rows[iPoint*nVar]; }
+
+  /*!
+   * \brief Get the limiter of the solution of a point.
+   * \param[in] iPoint - Index of the point.
+   */
+  inline su2double *GetLimiter(unsigned long iPoint) { return &Limiter[iPoint*nVar]; }
+
+  /*!
+   * \brief Get the primitive variables of a point.
+   * \param[in] iPoint - Index of the point.
+   */
+  inline su2double *GetPrimitive(unsigned long iPoint) { return &Primitive[iPoint*nPrimVar]; }
+
+  /*!
+   * \brief Get the gradient of the primitive variables of a point.
+   * \param[in] iPoint - Index of the point.
+   */
+  inline su2double **GetGradient_Primitive(unsigned long iPoint) { return &Gradient_Primitive_Rows[iPoint*nPrimVarGrad]; }
+
+  /*!
+   * \brief Get the limiter of the primitive variables of a point.
+   * \param[in] iPoint - Index of the point.
+   */
+  inline su2double *GetLimiter_Primitive(unsigned long iPoint) { return &Limiter_Primitive[iPoint*nPrimVarGrad]; }
+
+  /*!
+   * \brief Get the whole solution block, entry (iPoint,iVar) is at iPoint*nVar+iVar.
+   */
+  inline su2double *GetSolution_Block(void) { return Solution; }
+
+  /*!
+   * \brief Get the whole primitive block, entry (iPoint,iVar) is at iPoint*nPrimVar+iVar.
+   */
+  inline su2double *GetPrimitive_Block(void) { return Primitive; }
+
+};
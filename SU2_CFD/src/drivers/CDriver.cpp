@@ -38,6 +38,7 @@
 #include "../../include/drivers/CDriver.hpp"
 #include "../../include/definition_structure.hpp"
 #include <cassert>
+#include <typeinfo>
 
 #ifdef VTUNEPROF
 #include <ittnotify.h>
@@ -45,7 +46,7 @@
 
 CDriver::CDriver(char* confFile,
                  unsigned short val_nZone,
-                 SU2_Comm MPICommunicator):config_file_name(confFile), StartTime(0.0), StopTime(0.0), UsedTime(0.0), ExtIter(0), nZone(val_nZone), StopCalc(false), fsi(false), fem_solver(false) {
+                 SU2_Comm MPICommunicator):config_file_name(confFile), StartTime(0.0), StopTime(0.0), UsedTime(0.0), ExtIter(0), nZone(val_nZone), StopCalc(false), fsi(false), fem_solver(false), Rebalance(false) {
 
 
   /*--- Initialize Medipack (must also be here so it is initialized from python) ---*/
@@ -135,7 +136,15 @@ CDriver::CDriver(char* confFile,
        data structure (centered, upwind, galerkin), as well as any source terms
        (piecewise constant reconstruction) evaluated in each dual mesh volume. ---*/
       
+      if (rank == MASTER_NODE)
+        cout << endl <<"------------------- Numerics Preprocessing ( Zone " << iZone <<" ) -------------------" << endl;
+
       Numerics_Preprocessing(config_container[iZone], solver_container[iZone][iInst], numerics_container[iZone][iInst]);
+
+      /*--- The numerics keep the state of the edge being computed, each thread of the
+       threaded edge loops of the flow solvers gets its own copy. ---*/
+
+      Numerics_ThreadPreprocessing(config_container[iZone], solver_container[iZone][iInst], numerics_container[iZone][iInst], iInst);
       
       /*--- Definition of the integration class: integration_container[#ZONES][#INSTANCES][#EQ_SYSTEMS].
        The integration class orchestrates the execution of the spatial integration
@@ -225,6 +234,19 @@ CDriver::CDriver(char* confFile,
   UsedTimePreproc    = UsedTime;
   UsedTimeCompute    = 0.0;
   UsedTimeOutput     = 0.0;
+  UsedTimeBusy       = 0.0;
+  IterStartTime      = 0.0;
+  IterWaitTime       = 0.0;
+  LoadBalanceTime    = 0.0;
+  ZoneStartTime      = 0.0;
+  ZoneWaitTime       = 0.0;
+  ZoneTimers         = false;
+  ZoneTimeBusy       = new su2double[nZone];
+  ZoneBalanceTime    = new su2double[nZone];
+  for (iZone = 0; iZone < nZone; iZone++) {
+    ZoneTimeBusy[iZone]    = 0.0;
+    ZoneBalanceTime[iZone] = 0.0;
+  }
   IterCount          = 0;
   OutputCount        = 0;
   MDOFs              = 0.0;
@@ -319,6 +341,7 @@ void CDriver::Postprocessing() {
 
   bool isBinary = config_container[ZONE_0]->GetWrt_Binary_Restart();
   bool wrt_perf = config_container[ZONE_0]->GetWrt_Performance();
+  unsigned long iThread;
   
     /*--- Output some information to the console. ---*/
 
@@ -353,6 +376,28 @@ void CDriver::Postprocessing() {
     delete [] numerics_container[iZone];
   }
   delete [] numerics_container;
+  for (iThread = 0; iThread < numerics_thread.size(); iThread++) {
+    for (iZone = 0; iZone < nZone; iZone++) {
+      if (numerics_thread[iThread][iZone] == NULL) continue;
+      for (iInst = 0; iInst < nInst[iZone]; iInst++) {
+        CNumerics ****numerics_iThread = numerics_thread[iThread][iZone][iInst];
+        if (numerics_iThread == NULL) continue;
+        for (unsigned short iMGlevel = 0; iMGlevel <= config_container[iZone]->GetnMGLevels(); iMGlevel++) {
+          for (unsigned short iSol = 0; iSol < MAX_SOLS; iSol++) {
+            if (numerics_iThread[iMGlevel][iSol] == NULL) continue;
+            for (unsigned short iTerm = 0; iTerm < MAX_TERMS; iTerm++)
+              if (numerics_iThread[iMGlevel][iSol][iTerm] != NULL) delete numerics_iThread[iMGlevel][iSol][iTerm];
+            delete [] numerics_iThread[iMGlevel][iSol];
+          }
+          delete [] numerics_iThread[iMGlevel];
+        }
+        delete [] numerics_iThread;
+      }
+      delete [] numerics_thread[iThread][iZone];
+    }
+    delete [] numerics_thread[iThread];
+  }
+  numerics_thread.clear();
   if (rank == MASTER_NODE) cout << "Deleted CNumerics container." << endl;
   
   for (iZone = 0; iZone < nZone; iZone++) {
@@ -477,6 +522,9 @@ void CDriver::Postprocessing() {
 
   if (nInst != NULL) delete [] nInst;
   if (rank == MASTER_NODE) cout << "Deleted nInst container." << endl;
+
+  delete [] ZoneTimeBusy;
+  delete [] ZoneBalanceTime;
   
   /*--- Deallocate output container ---*/
   if (output!= NULL) delete output;
@@ -884,6 +932,12 @@ void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geomet
     if ((rank == MASTER_NODE) && (size > SINGLE_NODE) && (!fea) && (iMGlevel == MESH_0)) cout << "Communicating number of neighbors." << endl;
     geometry[iMGlevel]->InitiateComms(geometry[iMGlevel], config, NEIGHBORS);
     geometry[iMGlevel]->CompleteComms(geometry[iMGlevel], config, NEIGHBORS);
+
+    /*--- Sort the edges into flat arrays, colored for the shared-memory parallel edge loops. ---*/
+
+    if ((rank == MASTER_NODE) && (iMGlevel == MESH_0) && (omp_get_max_threads() > 1))
+      cout << "Sorting and coloring the edges for " << omp_get_max_threads() << " threads per rank." << endl;
+    geometry[iMGlevel]->SetEdgeColoring(config);
   }
   
 }
@@ -1805,9 +1859,6 @@ void CDriver::Integration_Postprocessing(CIntegration ***integration, CGeometry
 
 void CDriver::Numerics_Preprocessing(CConfig *config, CSolver ***solver, CNumerics ****&numerics) {
   
-  if (rank == MASTER_NODE)
-    cout << endl <<"------------------- Numerics Preprocessing ( Zone " << config->GetiZone() <<" ) -------------------" << endl;
-
   unsigned short iMGlevel, iSol,
       
   nVar_Template         = 0,
@@ -2629,6 +2680,156 @@ void CDriver::Numerics_Preprocessing(CConfig *config, CSolver ***solver, CNumeri
 
 }
 
+void CDriver::Numerics_ThreadPreprocessing(CConfig *config, CSolver ***solver, CNumerics ****numerics, unsigned short val_iInst) {
+
+  unsigned short iZone = config->GetiZone(), jZone, jInst, iMGlevel, iSol, iTerm, iEdgeTerm;
+  int iThread, nThread = omp_get_max_threads();
+  CNumerics ****numerics_iThread;
+  bool cloned;
+
+  /*--- Only the edge loops of the finite volume flow solvers are threaded. ---*/
+
+  bool flow = ((config->GetKind_Solver() == EULER) ||
+               (config->GetKind_Solver() == NAVIER_STOKES) ||
+               (config->GetKind_Solver() == RANS));
+
+  if ((nThread == 1) || !flow) return;
+
+  /*--- Equations and terms evaluated in the threaded edge loops. The other terms
+   of the container are not initialized for every kind of problem. ---*/
+
+  bool viscous   = (config->GetKind_Solver() != EULER);
+  bool turbulent = (config->GetKind_Solver() == RANS);
+
+  vector<unsigned short> EdgeTerm_Flow, EdgeTerm_Turb;
+  EdgeTerm_Flow.push_back(CONV_TERM);
+  if (viscous) EdgeTerm_Flow.push_back(VISC_TERM);
+  if (turbulent) {
+    if (config->GetKind_ConvNumScheme_Turb() == SPACE_UPWIND) EdgeTerm_Turb.push_back(CONV_TERM);
+    EdgeTerm_Turb.push_back(VISC_TERM);
+  }
+
+  if (numerics_thread.empty()) {
+    numerics_thread.resize(nThread-1);
+    for (iThread = 0; iThread < nThread-1; iThread++) {
+      numerics_thread[iThread] = new CNumerics*****[nZone];
+      for (jZone = 0; jZone < nZone; jZone++)
+        numerics_thread[iThread][jZone] = NULL;
+    }
+  }
+
+  /*--- The master thread uses the numerics of the driver. The other threads get
+   their own copy of the edge terms only, the boundary and source terms are
+   evaluated outside of the threaded loops. ---*/
+
+  for (iThread = 1; iThread < nThread; iThread++) {
+
+    if (numerics_thread[iThread-1][iZone] == NULL) {
+      numerics_thread[iThread-1][iZone] = new CNumerics****[nInst[iZone]];
+      for (jInst = 0; jInst < nInst[iZone]; jInst++)
+        numerics_thread[iThread-1][iZone][jInst] = NULL;
+    }
+
+    numerics_iThread = new CNumerics***[config->GetnMGLevels()+1];
+    numerics_thread[iThread-1][iZone][val_iInst] = numerics_iThread;
+
+    for (iMGlevel = 0; iMGlevel <= config->GetnMGLevels(); iMGlevel++) {
+      numerics_iThread[iMGlevel] = new CNumerics**[MAX_SOLS];
+      for (iSol = 0; iSol < MAX_SOLS; iSol++) {
+
+        numerics_iThread[iMGlevel][iSol] = NULL;
+
+        vector<unsigned short> *EdgeTerm = (iSol == FLOW_SOL)? &EdgeTerm_Flow : &EdgeTerm_Turb;
+        if (((iSol != FLOW_SOL) && (iSol != TURB_SOL)) || EdgeTerm->empty() ||
+            (solver[iMGlevel][iSol] == NULL)) continue;
+
+        numerics_iThread[iMGlevel][iSol] = new CNumerics*[MAX_TERMS];
+        for (iTerm = 0; iTerm < MAX_TERMS; iTerm++)
+          numerics_iThread[iMGlevel][iSol][iTerm] = NULL;
+
+        for (iEdgeTerm = 0; iEdgeTerm < EdgeTerm->size(); iEdgeTerm++) {
+          iTerm = (*EdgeTerm)[iEdgeTerm];
+          numerics_iThread[iMGlevel][iSol][iTerm] = Numerics_Clone(config, solver[MESH_0][iSol],
+                                                                   numerics[iMGlevel][iSol][iTerm], iMGlevel);
+        }
+      }
+    }
+  }
+
+  /*--- A solver gets the numerics of the threads if all its edge terms were cloned,
+   otherwise its edge loops run on the master thread only. ---*/
+
+  for (iMGlevel = 0; iMGlevel <= config->GetnMGLevels(); iMGlevel++) {
+    for (iSol = 0; iSol < MAX_SOLS; iSol++) {
+
+      if (numerics_thread[0][iZone][val_iInst][iMGlevel][iSol] == NULL) continue;
+
+      vector<unsigned short> *EdgeTerm = (iSol == FLOW_SOL)? &EdgeTerm_Flow : &EdgeTerm_Turb;
+
+      cloned = true;
+      for (iThread = 1; iThread < nThread; iThread++)
+        for (iEdgeTerm = 0; iEdgeTerm < EdgeTerm->size(); iEdgeTerm++)
+          if (numerics_thread[iThread-1][iZone][val_iInst][iMGlevel][iSol][(*EdgeTerm)[iEdgeTerm]] == NULL)
+            cloned = false;
+
+      if (!cloned) continue;
+
+      solver[iMGlevel][iSol]->SetThreadNumerics(0, numerics[iMGlevel][iSol]);
+      for (iThread = 1; iThread < nThread; iThread++)
+        solver[iMGlevel][iSol]->SetThreadNumerics(iThread, numerics_thread[iThread-1][iZone][val_iInst][iMGlevel][iSol]);
+    }
+  }
+
+}
+
+CNumerics *CDriver::Numerics_Clone(CConfig *config, CSolver *solver, CNumerics *numerics, unsigned short iMGlevel) {
+
+  /*--- The object is built with the arguments used by Numerics_Preprocessing()
+   for this class and grid level. ---*/
+
+  unsigned short nVar = solver->GetnVar();
+  bool roe_low_dissipation = config->GetKind_RoeLowDiss() != NO_ROELOWDISS;
+  bool correct_grad = (iMGlevel == MESH_0);
+
+  const type_info &type = typeid(*numerics);
+
+  /*--- Convective terms of the compressible flow. ---*/
+
+  if (type == typeid(CCentLax_Flow))         return new CCentLax_Flow(nDim, nVar, config);
+  if (type == typeid(CCentJST_Flow))         return new CCentJST_Flow(nDim, nVar, config);
+  if (type == typeid(CCentJST_KE_Flow))      return new CCentJST_KE_Flow(nDim, nVar, config);
+  if (type == typeid(CUpwRoe_Flow))          return new CUpwRoe_Flow(nDim, nVar, config, roe_low_dissipation);
+  if (type == typeid(CUpwGeneralRoe_Flow))   return new CUpwGeneralRoe_Flow(nDim, nVar, config);
+  if (type == typeid(CUpwAUSM_Flow))         return new CUpwAUSM_Flow(nDim, nVar, config);
+  if (type == typeid(CUpwAUSMPLUSUP_Flow))   return new CUpwAUSMPLUSUP_Flow(nDim, nVar, config);
+  if (type == typeid(CUpwAUSMPLUSUP2_Flow))  return new CUpwAUSMPLUSUP2_Flow(nDim, nVar, config);
+  if (type == typeid(CUpwTurkel_Flow))       return new CUpwTurkel_Flow(nDim, nVar, config);
+  if (type == typeid(CUpwL2Roe_Flow))        return new CUpwL2Roe_Flow(nDim, nVar, config);
+  if (type == typeid(CUpwLMRoe_Flow))        return new CUpwLMRoe_Flow(nDim, nVar, config);
+  if (type == typeid(CUpwSLAU_Flow))         return new CUpwSLAU_Flow(nDim, nVar, config, roe_low_dissipation);
+  if (type == typeid(CUpwSLAU2_Flow))        return new CUpwSLAU2_Flow(nDim, nVar, config, roe_low_dissipation);
+  if (type == typeid(CUpwHLLC_Flow))         return new CUpwHLLC_Flow(nDim, nVar, config);
+  if (type == typeid(CUpwGeneralHLLC_Flow))  return new CUpwGeneralHLLC_Flow(nDim, nVar, config);
+  if (type == typeid(CUpwMSW_Flow))          return new CUpwMSW_Flow(nDim, nVar, config);
+  if (type == typeid(CUpwCUSP_Flow))         return new CUpwCUSP_Flow(nDim, nVar, config);
+
+  /*--- Viscous terms of the compressible flow. ---*/
+
+  if (type == typeid(CAvgGrad_Flow))         return new CAvgGrad_Flow(nDim, nVar, correct_grad, config);
+  if (type == typeid(CGeneralAvgGrad_Flow))  return new CGeneralAvgGrad_Flow(nDim, nVar, correct_grad, config);
+
+  /*--- Convective and viscous terms of the turbulence models. ---*/
+
+  if (type == typeid(CUpwSca_TurbSA))        return new CUpwSca_TurbSA(nDim, nVar, config);
+  if (type == typeid(CUpwSca_TurbSST))       return new CUpwSca_TurbSST(nDim, nVar, config);
+  if (type == typeid(CAvgGrad_TurbSA))       return new CAvgGrad_TurbSA(nDim, nVar, true, config);
+  if (type == typeid(CAvgGrad_TurbSA_Neg))   return new CAvgGrad_TurbSA_Neg(nDim, nVar, true, config);
+  if (type == typeid(CAvgGrad_TurbSST))      return new CAvgGrad_TurbSST(nDim, nVar, solver->GetConstants(), true, config);
+
+  return NULL;
+
+}
+
 void CDriver::Numerics_Postprocessing(CNumerics *****numerics,
                                       CSolver ***solver, CGeometry **geometry,
                                       CConfig *config, unsigned short val_iInst) {
@@ -3771,12 +3972,16 @@ void CDriver::StartSolver(){
 
     /*--- Run a single iteration of the problem (fluid, elasticity, heat, ...). ---*/
 
+    StartIterTimer();
+
     Run();
 
     /*--- Update the solution for dual time stepping strategy ---*/
 
     Update();
 
+    StopIterTimer();
+
     /*--- Terminate the simulation if only the Jacobian must be computed. ---*/
     if (config_container[ZONE_0]->GetJacobian_Spatial_Discretization_Only()) break;
 
@@ -3784,6 +3989,8 @@ void CDriver::StartSolver(){
 
     Monitor(ExtIter);
 
+    CheckLoadBalance(ExtIter);
+
     /*--- Output the solution in files. ---*/
 
     Output(ExtIter);
@@ -3800,6 +4007,122 @@ void CDriver::StartSolver(){
 #endif
 }
 
+void CDriver::StartIterTimer(void) {
+
+#ifndef HAVE_MPI
+  IterStartTime = su2double(clock())/su2double(CLOCKS_PER_SEC);
+#else
+  IterStartTime = MPI_Wtime();
+#endif
+  IterWaitTime = SU2_MPI::GetWaitTime();
+
+}
+
+void CDriver::StopIterTimer(void) {
+
+  /*--- The time blocked in the waits and collectives of the other ranks is
+   not part of the cost of the partition of this rank. ---*/
+
+#ifndef HAVE_MPI
+  su2double IterStopTime = su2double(clock())/su2double(CLOCKS_PER_SEC);
+#else
+  su2double IterStopTime = MPI_Wtime();
+#endif
+  su2double IterTimeBusy = (IterStopTime - IterStartTime) - (SU2_MPI::GetWaitTime() - IterWaitTime);
+  UsedTimeBusy += IterTimeBusy;
+
+  /*--- Drivers that do not time their zones (and single zone problems) give
+   the time of the whole iteration to every zone. ---*/
+
+  if (!ZoneTimers) {
+    for (iZone = 0; iZone < nZone; iZone++) ZoneTimeBusy[iZone] += IterTimeBusy;
+  }
+
+}
+
+void CDriver::StartZoneTimer(unsigned short val_iZone) {
+
+  ZoneTimers = true;
+
+#ifndef HAVE_MPI
+  ZoneStartTime = su2double(clock())/su2double(CLOCKS_PER_SEC);
+#else
+  ZoneStartTime = MPI_Wtime();
+#endif
+  ZoneWaitTime = SU2_MPI::GetWaitTime();
+
+}
+
+void CDriver::StopZoneTimer(unsigned short val_iZone) {
+
+#ifndef HAVE_MPI
+  su2double ZoneStopTime = su2double(clock())/su2double(CLOCKS_PER_SEC);
+#else
+  su2double ZoneStopTime = MPI_Wtime();
+#endif
+  ZoneTimeBusy[val_iZone] += (ZoneStopTime - ZoneStartTime) - (SU2_MPI::GetWaitTime() - ZoneWaitTime);
+
+}
+
+void CDriver::WritePartitionWeights(void) {
+
+  for (iZone = 0; iZone < nZone; iZone++) {
+    if (config_container[iZone]->GetWrt_Partition_Weights())
+      geometry_container[iZone][INST_0][MESH_0]->WritePartitionWeights(config_container[iZone], SU2_TYPE::GetValue(ZoneTimeBusy[iZone]));
+  }
+
+}
+
+void CDriver::CheckLoadBalance(unsigned long val_iter) {
+
+  CConfig *config = config_container[ZONE_0];
+  unsigned long Freq = config->GetLoad_Balance_Freq();
+
+  if (Freq == 0) return;
+
+  /*--- Imbalance of the time of the ranks (without the time blocked in MPI)
+   since the last check, the weights are measured over the same period so
+   that they follow the changes of the cost of the points. ---*/
+
+  if (((val_iter+1) % Freq == 0) && (!Rebalance)) {
+
+    passivedouble Local_Time = SU2_TYPE::GetValue(UsedTimeBusy-LoadBalanceTime), Max_Time = 0.0, Total_Time = 0.0;
+    SU2_MPI::Allreduce(&Local_Time, &Max_Time, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(&Local_Time, &Total_Time, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    LoadBalanceTime = UsedTimeBusy;
+
+    passivedouble Imbalance = 0.0;
+    if (Total_Time > 0.0) Imbalance = Max_Time*passivedouble(size)/Total_Time - 1.0;
+
+    if (rank == MASTER_NODE)
+      cout << "Load imbalance of the last " << Freq << " iterations: " << 100.0*Imbalance << "%." << endl;
+
+    /*--- The weights of each zone are based on the time of that zone only. ---*/
+
+    if ((size > SINGLE_NODE) && (Imbalance > SU2_TYPE::GetValue(config->GetLoad_Balance_Threshold()))) {
+      for (iZone = 0; iZone < nZone; iZone++)
+        geometry_container[iZone][INST_0][MESH_0]->WritePartitionWeights(config_container[iZone],
+                                                                         SU2_TYPE::GetValue(ZoneTimeBusy[iZone]-ZoneBalanceTime[iZone]));
+      Rebalance = config->GetLoad_Balance_Restart();
+    }
+
+    for (iZone = 0; iZone < nZone; iZone++) ZoneBalanceTime[iZone] = ZoneTimeBusy[iZone];
+  }
+
+  /*--- Stop as soon as a restart can be written, with the 2nd order dual
+   time stepping the solution of the previous time step is also needed. ---*/
+
+  if (Rebalance) {
+    bool dual_time_2nd = (config->GetUnsteady_Simulation() == DT_STEPPING_2ND);
+    if ((!dual_time_2nd) || ((val_iter > 0) && ((val_iter-1) % config->GetWrt_Sol_Freq_DualTime() == 0))) {
+      if (rank == MASTER_NODE)
+        cout << "The load imbalance is above LOAD_BALANCE_THRESHOLD, restart with PARTITION_WEIGHTS= MEASURED." << endl;
+      StopCalc = true;
+    }
+  }
+
+}
+
 void CDriver::PreprocessExtIter(unsigned long ExtIter) {
 
   /*--- Set the value of the external iteration and physical time. ---*/
@@ -3985,7 +4308,8 @@ void CDriver::Output(unsigned long ExtIter) {
     
     if (((ExtIter+1 >= nExtIter) || StopCalc) && (rank == MASTER_NODE)) {
       cout << endl << "----------------------------- Solver Exit -------------------------------";
-      if (StopCalc) cout << endl << "Convergence criteria satisfied." << endl;
+      if (Rebalance) cout << endl << "Stopped to repartition the grid (load imbalance)." << endl;
+      else if (StopCalc) cout << endl << "Convergence criteria satisfied." << endl;
       else cout << endl << "Maximum number of external iterations reached (EXT_ITER)." << endl;
       cout << "-------------------------------------------------------------------------" << endl;
     }
@@ -3997,6 +4321,7 @@ void CDriver::Output(unsigned long ExtIter) {
     
     output->SetResult_Files_Parallel(solver_container, geometry_container, config_container, ExtIter, nZone);
     
+    WritePartitionWeights();
     
     if (rank == MASTER_NODE) cout << "-------------------------------------------------------------------------" << endl << endl;
     
@@ -4044,8 +4369,11 @@ void CFluidDriver::Run() {
 
   /*--- Zone preprocessing ---*/
 
-  for (iZone = 0; iZone < nZone; iZone++)
+  for (iZone = 0; iZone < nZone; iZone++) {
+    StartZoneTimer(iZone);
     iteration_container[iZone][INST_0]->Preprocess(output, integration_container, geometry_container, solver_container, numerics_container, config_container, surface_movement, grid_movement, FFDBox, iZone, INST_0);
+    StopZoneTimer(iZone);
+  }
 
   /*--- Updating zone interface communication patterns,
    needed only for unsteady simulation since for steady problems
@@ -4079,7 +4407,9 @@ void CFluidDriver::Run() {
 
     for (iZone = 0; iZone < nZone; iZone++) {
       config_container[iZone]->SetIntIter(IntIter);
+      StartZoneTimer(iZone);
       iteration_container[iZone][INST_0]->Iterate(output, integration_container, geometry_container, solver_container, numerics_container, config_container, surface_movement, grid_movement, FFDBox, iZone, INST_0);
+      StopZoneTimer(iZone);
     }
 
     /*--- Check convergence in each zone --*/
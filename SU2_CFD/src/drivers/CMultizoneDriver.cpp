@@ -171,6 +171,8 @@ void CMultizoneDriver::StartSolver() {
 
     /*--- Run a block iteration of the multizone problem. ---*/
 
+    StartIterTimer();
+
     switch (driver_config->GetKind_MZSolver()){
       case MZ_BLOCK_GAUSS_SEIDEL: Run_GaussSeidel(); break;  // Block Gauss-Seidel iteration
       case MZ_BLOCK_JACOBI: Run_Jacobi(); break;             // Block-Jacobi iteration
@@ -181,10 +183,14 @@ void CMultizoneDriver::StartSolver() {
 
     Update();
 
+    StopIterTimer();
+
     /*--- Monitor the computations after each iteration. ---*/
 
     Monitor(TimeIter);
 
+    CheckLoadBalance(TimeIter);
+
     /*--- Output the solution in files. ---*/
 
     Output(TimeIter);
@@ -301,8 +307,10 @@ void CMultizoneDriver::Run_GaussSeidel() {
       if (UpdateMesh > 0) DynamicMeshUpdate(iZone, ExtIter);
 
       /*--- Iterate the zone as a block, either to convergence or to a max number of iterations ---*/
+      StartZoneTimer(iZone);
       iteration_container[iZone][INST_0]->Solve(output, integration_container, geometry_container, solver_container,
           numerics_container, config_container, surface_movement, grid_movement, FFDBox, iZone, INST_0);
+      StopZoneTimer(iZone);
 
       /*--- A corrector step can help preventing numerical instabilities ---*/
       Corrector(iZone);
@@ -362,8 +370,10 @@ void CMultizoneDriver::Run_Jacobi() {
       config_container[iZone]->SetOuterIter(iOuter_Iter);
 
       /*--- Iterate the zone as a block, either to convergence or to a max number of iterations ---*/
+      StartZoneTimer(iZone);
       iteration_container[iZone][INST_0]->Solve(output, integration_container, geometry_container, solver_container,
           numerics_container, config_container, surface_movement, grid_movement, FFDBox, iZone, INST_0);
+      StopZoneTimer(iZone);
 
       /*--- A corrector step can help preventing numerical instabilities ---*/
       Corrector(iZone);
@@ -595,6 +605,7 @@ void CMultizoneDriver::Output(unsigned long TimeIter) {
 
     output->SetResult_Files_Parallel(solver_container, geometry_container, config_container, TimeIter, nZone);
 
+    WritePartitionWeights();
 
     /*--- Execute the routine for writing special output. ---*/
     output->SetSpecial_Output(solver_container, geometry_container, config_container, TimeIter, nZone);
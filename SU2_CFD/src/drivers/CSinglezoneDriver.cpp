@@ -79,6 +79,8 @@ void CSinglezoneDriver::StartSolver() {
 
     /*--- Run a time-step iteration of the single-zone problem. ---*/
 
+    StartIterTimer();
+
     Run();
 
     /*--- Perform some postprocessing on the solution before the update ---*/
@@ -89,10 +91,14 @@ void CSinglezoneDriver::StartSolver() {
 
     Update();
 
+    StopIterTimer();
+
     /*--- Monitor the computations after each iteration. ---*/
 
     Monitor(TimeIter);
 
+    CheckLoadBalance(TimeIter);
+
     /*--- Output the solution in files. ---*/
 
     Output(TimeIter);
@@ -256,6 +262,7 @@ void CSinglezoneDriver::Output(unsigned long TimeIter) {
 
     output->SetResult_Files_Parallel(solver_container, geometry_container, config_container, TimeIter, nZone);
 
+    WritePartitionWeights();
 
     /*--- Execute the routine for writing special output. ---*/
     output->SetSpecial_Output(solver_container, geometry_container, config_container, TimeIter, nZone);
@@ -383,6 +383,176 @@ void CIntegration::Time_Integration(CGeometry *geometry, CSolver **solver_contai
 
 }
 
+template<class ScalarType>
+CJacobianFreeProduct<ScalarType>::CJacobianFreeProduct(CIntegration *val_integration, CGeometry *val_geometry,
+                                                       CSolver **val_solver_container, CNumerics **val_numerics,
+                                                       CConfig *val_config, CSysMatrix<ScalarType> & val_Jacobian,
+                                                       unsigned short val_RunTime_EqSystem) {
+
+  integration      = val_integration;
+  geometry         = val_geometry;
+  solver_container = val_solver_container;
+  numerics         = val_numerics;
+  config           = val_config;
+  Jacobian         = &val_Jacobian;
+  RunTime_EqSystem = val_RunTime_EqSystem;
+  MainSolver       = config->GetContainerPosition(RunTime_EqSystem);
+  StepSize         = config->GetNewton_Krylov_Epsilon();
+
+  nVar         = solver_container[MainSolver]->GetnVar();
+  nPoint       = geometry->GetnPoint();
+  nPointDomain = geometry->GetnPointDomain();
+
+  Solution_Base = new su2double [nPoint*nVar];
+  Residual_Base = new su2double [nPoint*nVar];
+  Residual_Save = new su2double [nPoint*nVar];
+
+  Norm_Solution = 0.0;
+
+}
+
+template<class ScalarType>
+CJacobianFreeProduct<ScalarType>::~CJacobianFreeProduct(void) {
+
+  delete [] Solution_Base;
+  delete [] Residual_Base;
+  delete [] Residual_Save;
+
+}
+
+template<class ScalarType>
+void CJacobianFreeProduct<ScalarType>::SetBase_State(void) {
+
+  unsigned long iPoint, total_index;
+  unsigned short iVar;
+  su2double Local_Norm = 0.0, Global_Norm = 0.0;
+
+  CSolver *solver = solver_container[MainSolver];
+
+  /*--- Store the base state, the residual vector of the solver holds R(u) since
+   the space integration has just been performed. ---*/
+
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    for (iVar = 0; iVar < nVar; iVar++) {
+      total_index = iPoint*nVar+iVar;
+      Solution_Base[total_index] = solver->node[iPoint]->GetSolution(iVar);
+      Residual_Base[total_index] = solver->LinSysRes[total_index];
+      if (iPoint < nPointDomain) Local_Norm += pow(Solution_Base[total_index], 2.0);
+    }
+  }
+
+#ifdef HAVE_MPI
+  SU2_MPI::Allreduce(&Local_Norm, &Global_Norm, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+#else
+  Global_Norm = Local_Norm;
+#endif
+
+  Norm_Solution = sqrt(Global_Norm);
+
+}
+
+template<class ScalarType>
+void CJacobianFreeProduct<ScalarType>::operator()(const CSysVector<ScalarType> & u, CSysVector<ScalarType> & v) const {
+
+  unsigned long iPoint, total_index;
+  unsigned short iVar;
+  su2double Epsilon, Delta, Vol, Norm_Dir;
+
+  CSolver *solver = solver_container[MainSolver];
+
+  /*--- The step is scaled with the norm of the direction, so that it does not
+   depend on the (arbitrary) scaling of the Krylov vectors. ---*/
+
+  Norm_Dir = u.norm();
+
+  if (Norm_Dir == 0.0) {
+    v = ScalarType(0.0);
+    return;
+  }
+
+  Epsilon = StepSize*(1.0+Norm_Solution)/Norm_Dir;
+
+  /*--- The right hand side of the linear system may be the residual vector of
+   the solver, it is saved before the residual is evaluated again. ---*/
+
+  for (total_index = 0; total_index < nPoint*nVar; total_index++)
+    Residual_Save[total_index] = solver->LinSysRes[total_index];
+
+  /*--- Perturb the solution along the direction of the product ---*/
+
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    for (iVar = 0; iVar < nVar; iVar++) {
+      total_index = iPoint*nVar+iVar;
+      solver->node[iPoint]->SetSolution(iVar, Solution_Base[total_index] + Epsilon*u[total_index]);
+    }
+  }
+
+  solver->InitiateComms(geometry, config, SOLUTION);
+  solver->CompleteComms(geometry, config, SOLUTION);
+
+  /*--- Evaluate the residual of the perturbed solution, the solver only evaluates
+   the residual so that the preconditioning Jacobian is not assembled again. ---*/
+
+  bool ResidualOnly = solver->GetResidualOnly();
+
+  solver->SetResidualOnly(true);
+
+  solver->Preprocessing(geometry, solver_container, config, MESH_0, NO_RK_ITER, RunTime_EqSystem, false);
+  integration->Space_Integration(geometry, solver_container, numerics, config, MESH_0, NO_RK_ITER, RunTime_EqSystem);
+
+  /*--- Finite difference of the residual plus the pseudo time term, the
+   rows of points with zero time step are the identity (see ImplicitEuler_Iteration). ---*/
+
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+
+    if (solver->node[iPoint]->GetDelta_Time() != 0.0) {
+      Vol = (geometry->node[iPoint]->GetVolume() +
+             geometry->node[iPoint]->GetPeriodicVolume());
+      Delta = Vol / solver->node[iPoint]->GetDelta_Time();
+      for (iVar = 0; iVar < nVar; iVar++) {
+        total_index = iPoint*nVar+iVar;
+        v[total_index] = SU2_TYPE::GetValue((solver->LinSysRes[total_index] - Residual_Base[total_index])/Epsilon +
+                                            Delta*u[total_index]);
+      }
+    }
+    else {
+      for (iVar = 0; iVar < nVar; iVar++) {
+        total_index = iPoint*nVar+iVar;
+        v[total_index] = u[total_index];
+      }
+    }
+  }
+
+  Jacobian->InitiateComms(v, geometry, config, SOLUTION_MATRIX);
+  Jacobian->CompleteComms(v, geometry, config, SOLUTION_MATRIX);
+
+  /*--- Restore the base solution (halos included) and rerun the preprocessing, so that the
+   primitive variables, gradients, limiters and sensors are those of the base state again
+   (they are used by the coupled solvers and by the output). The preprocessing clears the
+   residual vector, which is restored last. ---*/
+
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    for (iVar = 0; iVar < nVar; iVar++) {
+      total_index = iPoint*nVar+iVar;
+      solver->node[iPoint]->SetSolution(iVar, Solution_Base[total_index]);
+    }
+  }
+
+  solver->Preprocessing(geometry, solver_container, config, MESH_0, NO_RK_ITER, RunTime_EqSystem, false);
+
+  solver->SetResidualOnly(ResidualOnly);
+
+  for (total_index = 0; total_index < nPoint*nVar; total_index++)
+    solver->LinSysRes[total_index] = Residual_Save[total_index];
+
+}
+
+#ifndef CODI_FORWARD_TYPE
+template class CJacobianFreeProduct<su2mixedfloat>;
+#else
+template class CJacobianFreeProduct<su2double>;
+#endif
+
 void CIntegration::Time_Integration_FEM(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics, CConfig *config,
                                     unsigned short RunTime_EqSystem, unsigned long Iteration) {
 
@@ -118,11 +118,14 @@ void CMultiGridIntegration::MultiGrid_Iteration(CGeometry ****geometry,
                   FinestMesh, RecursiveParam, RunTime_EqSystem,
                   Iteration, iZone, iInst);
 
-  /*--- Computes primitive variables and gradients in the finest mesh (useful for the next solver (turbulence) and output ---*/
+  /*--- Computes primitive variables and gradients in the finest mesh (useful for the next solver (turbulence) and output,
+   the Jacobian is not needed and it is kept for the next iteration) ---*/
 
+   solver_container[iZone][iInst][MESH_0][SolContainer_Position]->SetResidualOnly(true);
    solver_container[iZone][iInst][MESH_0][SolContainer_Position]->Preprocessing(geometry[iZone][iInst][MESH_0],
                                                                          solver_container[iZone][iInst][MESH_0], config[iZone],
                                                                          MESH_0, NO_RK_ITER, RunTime_EqSystem, true);
+   solver_container[iZone][iInst][MESH_0][SolContainer_Position]->SetResidualOnly(false);
   
   /*--- Compute non-dimensional parameters and the convergence monitor ---*/
   
@@ -151,6 +154,15 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
   
   bool startup_multigrid = (config[iZone]->GetRestart_Flow() && (RunTime_EqSystem == RUNTIME_FLOW_SYS) && (Iteration == 0));
   unsigned short SolContainer_Position = config[iZone]->GetContainerPosition(RunTime_EqSystem);
+  bool newton_krylov = (config[iZone]->GetNewton_Krylov() && (RunTime_EqSystem == RUNTIME_FLOW_SYS) &&
+                        (config[iZone]->GetKind_TimeIntScheme() == EULER_IMPLICIT));
+  
+  /*--- On the finest grid the Jacobian is not assembled while the linear solver keeps the preconditioner
+   of a previous iteration, the matrix stays as it was when the preconditioner was built. ---*/
+  
+  bool lagged_jacobian = ((iMesh == MESH_0) && (RunTime_EqSystem == RUNTIME_FLOW_SYS) &&
+                          (config[iZone]->GetKind_TimeIntScheme() == EULER_IMPLICIT));
+  CSolver *solver_iMesh = solver_container[iZone][iInst][iMesh][SolContainer_Position];
   
   /*--- Do a presmoothing on the grid iMesh to be restricted to the grid iMesh+1 ---*/
   
@@ -167,6 +179,8 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
       
       /*--- Send-Receive boundary conditions, and preprocessing ---*/
       
+      if (lagged_jacobian) solver_iMesh->SetResidualOnly(solver_iMesh->System.GetPrec_Reuse(config[iZone]));
+      
       solver_container[iZone][iInst][iMesh][SolContainer_Position]->Preprocessing(geometry[iZone][iInst][iMesh], solver_container[iZone][iInst][iMesh], config[iZone], iMesh, iRKStep, RunTime_EqSystem, false);
       
       if (iRKStep == 0) {
@@ -192,10 +206,31 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
       
       Space_Integration(geometry[iZone][iInst][iMesh], solver_container[iZone][iInst][iMesh], numerics_container[iZone][iInst][iMesh][SolContainer_Position], config[iZone], iMesh, iRKStep, RunTime_EqSystem);
       
+      /*--- Matrix-free Newton-Krylov mode on the finest grid, the product is linearized about the current
+       solution. The product is built once and owned by the solver, which deletes it. ---*/
+      
+      if (newton_krylov && (iMesh == MESH_0)) {
+        CSolver *solver = solver_container[iZone][iInst][iMesh][SolContainer_Position];
+        if (solver->JacobianFree_Product == NULL) {
+#ifndef CODI_FORWARD_TYPE
+          solver->JacobianFree_Product = new CJacobianFreeProduct<su2mixedfloat>(this, geometry[iZone][iInst][iMesh], solver_container[iZone][iInst][iMesh],
+                                                                                 numerics_container[iZone][iInst][iMesh][SolContainer_Position], config[iZone],
+                                                                                 solver->Jacobian, RunTime_EqSystem);
+#else
+          solver->JacobianFree_Product = new CJacobianFreeProduct<su2double>(this, geometry[iZone][iInst][iMesh], solver_container[iZone][iInst][iMesh],
+                                                                             numerics_container[iZone][iInst][iMesh][SolContainer_Position], config[iZone],
+                                                                             solver->Jacobian, RunTime_EqSystem);
+#endif
+        }
+        solver->JacobianFree_Product->SetBase_State();
+      }
+      
       /*--- Time integration, update solution using the old solution plus the solution increment ---*/
       
       Time_Integration(geometry[iZone][iInst][iMesh], solver_container[iZone][iInst][iMesh], config[iZone], iRKStep, RunTime_EqSystem, Iteration);
       
+      if (lagged_jacobian) solver_iMesh->SetResidualOnly(false);
+      
       /*--- Send-Receive boundary conditions, and postprocessing ---*/
       
       solver_container[iZone][iInst][iMesh][SolContainer_Position]->Postprocessing(geometry[iZone][iInst][iMesh], solver_container[iZone][iInst][iMesh], config[iZone], iMesh);
@@ -207,10 +242,12 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
   /*--- Compute Forcing Term $P_(k+1) = I^(k+1)_k(P_k+F_k(u_k))-F_(k+1)(I^(k+1)_k u_k)$ and update solution for multigrid ---*/
   
   if ( (iMesh < config[iZone]->GetnMGLevels() && ((Iteration >= config[iZone]->GetnStartUpIter()) || startup_multigrid)) ) {
-    /*--- Compute $r_k = P_k + F_k(u_k)$ ---*/
+    /*--- Compute $r_k = P_k + F_k(u_k)$, only the residual is needed (the Jacobian of the finest grid is kept). ---*/
     
+    if (lagged_jacobian) solver_iMesh->SetResidualOnly(true);
     solver_container[iZone][iInst][iMesh][SolContainer_Position]->Preprocessing(geometry[iZone][iInst][iMesh], solver_container[iZone][iInst][iMesh], config[iZone], iMesh, NO_RK_ITER, RunTime_EqSystem, false);
     Space_Integration(geometry[iZone][iInst][iMesh], solver_container[iZone][iInst][iMesh], numerics_container[iZone][iInst][iMesh][SolContainer_Position], config[iZone], iMesh, NO_RK_ITER, RunTime_EqSystem);
+    if (lagged_jacobian) solver_iMesh->SetResidualOnly(false);
     SetResidual_Term(geometry[iZone][iInst][iMesh], solver_container[iZone][iInst][iMesh][SolContainer_Position]);
     
     /*--- Compute $r_(k+1) = F_(k+1)(I^(k+1)_k u_k)$ ---*/
@@ -36,6 +36,7 @@
  */
 
 #include "../include/numerics_structure.hpp"
+#include "../../Common/include/omp_structure.hpp"
 #include <limits>
 
 CCentBase_Flow::CCentBase_Flow(unsigned short val_nDim, unsigned short val_nVar, CConfig *config) :
@@ -5206,3 +5207,452 @@ void CSourceWindGust::ComputeResidual(su2double *val_residual, su2double **val_J
   }
   
 }
+
+CFluxBatch_Flow::CFluxBatch_Flow(unsigned short val_nDim, unsigned short val_nVar, CConfig *config) {
+
+  nDim = val_nDim;
+  nVar = val_nVar;
+  nPrimVar = nDim+5;
+  nEdge = 0;
+
+  /*--- The kernels use fixed size scratch arrays for the compressible equations. ---*/
+
+  if (nVar != nDim+2)
+    SU2_MPI::Error("The batched flux kernels are only defined for the compressible flow equations.", CURRENT_FUNCTION);
+
+  implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+
+  Gamma = config->GetGamma();
+  Gamma_Minus_One = Gamma - 1.0;
+
+  for (unsigned short k = 0; k < BATCH_SIZE; k++) {
+    Point_i[k] = 0; Point_j[k] = 0;
+  }
+
+  Normal     = new su2double [nDim*BATCH_SIZE];
+  V_i        = new su2double [nPrimVar*BATCH_SIZE];
+  V_j        = new su2double [nPrimVar*BATCH_SIZE];
+  Residual   = new su2double [nVar*BATCH_SIZE];
+  Jacobian_i = new su2double [nVar*nVar*BATCH_SIZE];
+  Jacobian_j = new su2double [nVar*nVar*BATCH_SIZE];
+
+}
+
+CFluxBatch_Flow::~CFluxBatch_Flow(void) {
+
+  delete [] Normal;
+  delete [] V_i;
+  delete [] V_j;
+  delete [] Residual;
+  delete [] Jacobian_i;
+  delete [] Jacobian_j;
+
+}
+
+unsigned short CFluxBatch_Flow::SetEdge(unsigned long val_iPoint, unsigned long val_jPoint, const su2double *val_normal,
+                                        const su2double *val_v_i, const su2double *val_v_j) {
+
+  unsigned short iDim, iVar, k = nEdge;
+
+  Point_i[k] = val_iPoint;
+  Point_j[k] = val_jPoint;
+
+  for (iDim = 0; iDim < nDim; iDim++)
+    Normal[iDim*BATCH_SIZE+k] = val_normal[iDim];
+
+  for (iVar = 0; iVar < nPrimVar; iVar++) {
+    V_i[iVar*BATCH_SIZE+k] = val_v_i[iVar];
+    V_j[iVar*BATCH_SIZE+k] = val_v_j[iVar];
+  }
+
+  nEdge++;
+
+  return k;
+
+}
+
+void CFluxBatch_Flow::PadBatch(void) {
+
+  unsigned short iDim, iVar, k, last = nEdge-1;
+
+  for (k = nEdge; k < BATCH_SIZE; k++) {
+    for (iDim = 0; iDim < nDim; iDim++)
+      Normal[iDim*BATCH_SIZE+k] = Normal[iDim*BATCH_SIZE+last];
+    for (iVar = 0; iVar < nPrimVar; iVar++) {
+      V_i[iVar*BATCH_SIZE+k] = V_i[iVar*BATCH_SIZE+last];
+      V_j[iVar*BATCH_SIZE+k] = V_j[iVar*BATCH_SIZE+last];
+    }
+  }
+
+}
+
+void CFluxBatch_Flow::ComputeBatch(void) {
+
+  if (nEdge == 0) return;
+
+  if (nEdge < BATCH_SIZE) PadBatch();
+
+  ComputeLanes();
+
+}
+
+void CFluxBatch_Flow::GetResidual(unsigned short val_lane, su2double *val_residual) const {
+
+  for (unsigned short iVar = 0; iVar < nVar; iVar++)
+    val_residual[iVar] = Residual[iVar*BATCH_SIZE+val_lane];
+
+}
+
+void CFluxBatch_Flow::GetJacobians(unsigned short val_lane, su2double **val_Jacobian_i, su2double **val_Jacobian_j) const {
+
+  for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+    for (unsigned short jVar = 0; jVar < nVar; jVar++) {
+      val_Jacobian_i[iVar][jVar] = Jacobian_i[(iVar*nVar+jVar)*BATCH_SIZE+val_lane];
+      val_Jacobian_j[iVar][jVar] = Jacobian_j[(iVar*nVar+jVar)*BATCH_SIZE+val_lane];
+    }
+  }
+
+}
+
+CUpwRoeBatch_Flow::CUpwRoeBatch_Flow(unsigned short val_nDim, unsigned short val_nVar, CConfig *config) :
+                   CFluxBatch_Flow(val_nDim, val_nVar, config) {
+
+  kappa = config->GetRoe_Kappa();
+  EntropyFix_Coeff = config->GetEntropyFix_Coeff();
+
+}
+
+CUpwRoeBatch_Flow::~CUpwRoeBatch_Flow(void) { }
+
+void CUpwRoeBatch_Flow::ComputeLanes(void) {
+
+  const unsigned short W = BATCH_SIZE;
+
+  /*--- One iteration per lane, the scratch arrays are private to each lane. ---*/
+
+  SU2_OMP_SIMD
+  for (unsigned short k = 0; k < W; k++) {
+
+    unsigned short iDim, iVar, jVar;
+    su2double UnitNormal[3], LaneNormal[3], Velocity_i[3], Velocity_j[3], RoeVelocity[3];
+    su2double U_i[5], U_j[5], Flux_i[5], Flux_j[5], Diff_U[5];
+    su2double P_Plus[5], P_Minus[5], invP_Plus[5], invP_Minus[5];
+
+    /*--- Face area and unit normal ---*/
+
+    su2double Area = 0.0;
+    for (iDim = 0; iDim < nDim; iDim++) {
+      LaneNormal[iDim] = Normal[iDim*W+k];
+      Area += LaneNormal[iDim]*LaneNormal[iDim];
+    }
+    Area = sqrt(Area);
+    for (iDim = 0; iDim < nDim; iDim++)
+      UnitNormal[iDim] = LaneNormal[iDim]/Area;
+
+    /*--- Primitive variables at points i and j ---*/
+
+    for (iDim = 0; iDim < nDim; iDim++) {
+      Velocity_i[iDim] = V_i[(iDim+1)*W+k];
+      Velocity_j[iDim] = V_j[(iDim+1)*W+k];
+    }
+    su2double Pressure_i = V_i[(nDim+1)*W+k], Pressure_j = V_j[(nDim+1)*W+k];
+    su2double Density_i  = V_i[(nDim+2)*W+k], Density_j  = V_j[(nDim+2)*W+k];
+    su2double Enthalpy_i = V_i[(nDim+3)*W+k], Enthalpy_j = V_j[(nDim+3)*W+k];
+    su2double Energy_i = Enthalpy_i - Pressure_i/Density_i;
+    su2double Energy_j = Enthalpy_j - Pressure_j/Density_j;
+
+    /*--- Roe-averaged variables at interface between i & j ---*/
+
+    su2double R = sqrt(fabs(Density_j/Density_i));
+    su2double RoeDensity = R*Density_i;
+    su2double sq_vel = 0.0, ProjVelocity = 0.0;
+    for (iDim = 0; iDim < nDim; iDim++) {
+      RoeVelocity[iDim] = (R*Velocity_j[iDim]+Velocity_i[iDim])/(R+1);
+      sq_vel += RoeVelocity[iDim]*RoeVelocity[iDim];
+      ProjVelocity += RoeVelocity[iDim]*UnitNormal[iDim];
+    }
+    su2double RoeEnthalpy = (R*Enthalpy_j+Enthalpy_i)/(R+1);
+    su2double RoeSoundSpeed2 = Gamma_Minus_One*(RoeEnthalpy-0.5*sq_vel);
+
+    /*--- A negative RoeSoundSpeed^2 clears the fluxes of the lane (as in
+     CUpwRoeBase_Flow), the lane is still evaluated with a dummy value. ---*/
+
+    bool physical = (RoeSoundSpeed2 > 0.0);
+    su2double RoeSoundSpeed = sqrt(physical? RoeSoundSpeed2 : 1.0);
+
+    /*--- Eigenvalues with Mavriplis' entropy correction ---*/
+
+    su2double MaxLambda = fabs(ProjVelocity) + RoeSoundSpeed;
+    su2double Lambda_Conv  = max(fabs(ProjVelocity), EntropyFix_Coeff*MaxLambda);
+    su2double Lambda_Plus  = max(fabs(ProjVelocity + RoeSoundSpeed), EntropyFix_Coeff*MaxLambda);
+    su2double Lambda_Minus = max(fabs(ProjVelocity - RoeSoundSpeed), EntropyFix_Coeff*MaxLambda);
+
+    /*--- Acoustic right eigenvectors (columns of P) and left eigenvectors (rows of P^-1) ---*/
+
+    su2double rhooc = RoeDensity/RoeSoundSpeed;
+    su2double rhoxc = RoeDensity*RoeSoundSpeed;
+    su2double gm1_o_rhoxc = Gamma_Minus_One/rhoxc;
+    su2double ProjRoeMomentum = RoeDensity*ProjVelocity;
+
+    P_Plus[0]  = 0.5*rhooc;
+    P_Minus[0] = 0.5*rhooc;
+    invP_Plus[0]  = -ProjVelocity/RoeDensity + 0.5*gm1_o_rhoxc*sq_vel;
+    invP_Minus[0] =  ProjVelocity/RoeDensity + 0.5*gm1_o_rhoxc*sq_vel;
+    for (iDim = 0; iDim < nDim; iDim++) {
+      P_Plus[iDim+1]  = 0.5*(RoeVelocity[iDim]*rhooc + RoeDensity*UnitNormal[iDim]);
+      P_Minus[iDim+1] = 0.5*(RoeVelocity[iDim]*rhooc - RoeDensity*UnitNormal[iDim]);
+      invP_Plus[iDim+1]  =  UnitNormal[iDim]/RoeDensity - gm1_o_rhoxc*RoeVelocity[iDim];
+      invP_Minus[iDim+1] = -UnitNormal[iDim]/RoeDensity - gm1_o_rhoxc*RoeVelocity[iDim];
+    }
+    P_Plus[nDim+1]  = 0.5*(0.5*sq_vel*rhooc + ProjRoeMomentum + rhoxc/Gamma_Minus_One);
+    P_Minus[nDim+1] = 0.5*(0.5*sq_vel*rhooc - ProjRoeMomentum + rhoxc/Gamma_Minus_One);
+    invP_Plus[nDim+1]  = gm1_o_rhoxc;
+    invP_Minus[nDim+1] = gm1_o_rhoxc;
+
+    /*--- Conservative variables and their difference ---*/
+
+    U_i[0] = Density_i; U_j[0] = Density_j;
+    for (iDim = 0; iDim < nDim; iDim++) {
+      U_i[iDim+1] = Density_i*Velocity_i[iDim];
+      U_j[iDim+1] = Density_j*Velocity_j[iDim];
+    }
+    U_i[nDim+1] = Density_i*Energy_i;
+    U_j[nDim+1] = Density_j*Energy_j;
+
+    for (iVar = 0; iVar < nVar; iVar++)
+      Diff_U[iVar] = U_j[iVar]-U_i[iVar];
+
+    /*--- Central part of the flux and its Jacobians ---*/
+
+    ProjFlux(Density_i, Velocity_i, Pressure_i, Enthalpy_i, LaneNormal, Flux_i);
+    ProjFlux(Density_j, Velocity_j, Pressure_j, Enthalpy_j, LaneNormal, Flux_j);
+
+    for (iVar = 0; iVar < nVar; iVar++)
+      Residual[iVar*W+k] = kappa*(Flux_i[iVar]+Flux_j[iVar]);
+
+    if (implicit) {
+      ProjJacobian(Velocity_i, Energy_i, LaneNormal, kappa, k, Jacobian_i);
+      ProjJacobian(Velocity_j, Energy_j, LaneNormal, kappa, k, Jacobian_j);
+    }
+
+    /*--- Roe dissipation, |A| = Lambda_Conv*I + the acoustic corrections ---*/
+
+    su2double Coeff_Plus  = Lambda_Plus  - Lambda_Conv;
+    su2double Coeff_Minus = Lambda_Minus - Lambda_Conv;
+    su2double Scale = (1.0-kappa)*Area;
+
+    for (iVar = 0; iVar < nVar; iVar++) {
+      for (jVar = 0; jVar < nVar; jVar++) {
+        su2double Proj_ModJac_Tensor_ij = Coeff_Plus*P_Plus[iVar]*invP_Plus[jVar] +
+                                          Coeff_Minus*P_Minus[iVar]*invP_Minus[jVar];
+        if (iVar == jVar) Proj_ModJac_Tensor_ij += Lambda_Conv;
+
+        Residual[iVar*W+k] -= Scale*Proj_ModJac_Tensor_ij*Diff_U[jVar];
+
+        if (implicit) {
+          Jacobian_i[(iVar*nVar+jVar)*W+k] += Scale*Proj_ModJac_Tensor_ij;
+          Jacobian_j[(iVar*nVar+jVar)*W+k] -= Scale*Proj_ModJac_Tensor_ij;
+        }
+      }
+    }
+
+    /*--- Clear the non-physical lanes ---*/
+
+    if (!physical) {
+      for (iVar = 0; iVar < nVar; iVar++) {
+        Residual[iVar*W+k] = 0.0;
+        if (implicit) {
+          for (jVar = 0; jVar < nVar; jVar++) {
+            Jacobian_i[(iVar*nVar+jVar)*W+k] = 0.0;
+            Jacobian_j[(iVar*nVar+jVar)*W+k] = 0.0;
+          }
+        }
+      }
+    }
+
+  }
+
+}
+
+CCentJSTBatch_Flow::CCentJSTBatch_Flow(unsigned short val_nDim, unsigned short val_nVar, CConfig *config) :
+                    CFluxBatch_Flow(val_nDim, val_nVar, config) {
+
+  /*--- Artifical dissipation parameters, as in CCentJST_Flow ---*/
+
+  Param_p = 0.3;
+  Param_Kappa_2 = config->GetKappa_2nd_Flow();
+  Param_Kappa_4 = config->GetKappa_4th_Flow();
+  fix_factor = config->GetCent_Jac_Fix_Factor();
+
+  Lambda_i   = new su2double [BATCH_SIZE];
+  Lambda_j   = new su2double [BATCH_SIZE];
+  Neighbor_i = new su2double [BATCH_SIZE];
+  Neighbor_j = new su2double [BATCH_SIZE];
+  Sensor_i   = new su2double [BATCH_SIZE];
+  Sensor_j   = new su2double [BATCH_SIZE];
+  Und_Lapl_i = new su2double [nVar*BATCH_SIZE];
+  Und_Lapl_j = new su2double [nVar*BATCH_SIZE];
+
+}
+
+CCentJSTBatch_Flow::~CCentJSTBatch_Flow(void) {
+
+  delete [] Lambda_i;
+  delete [] Lambda_j;
+  delete [] Neighbor_i;
+  delete [] Neighbor_j;
+  delete [] Sensor_i;
+  delete [] Sensor_j;
+  delete [] Und_Lapl_i;
+  delete [] Und_Lapl_j;
+
+}
+
+void CCentJSTBatch_Flow::SetDissipation(unsigned short val_lane, su2double val_lambda_i, su2double val_lambda_j,
+                                        unsigned short val_neighbor_i, unsigned short val_neighbor_j,
+                                        su2double val_sensor_i, su2double val_sensor_j,
+                                        const su2double *val_und_lapl_i, const su2double *val_und_lapl_j) {
+
+  Lambda_i[val_lane]   = val_lambda_i;   Lambda_j[val_lane]   = val_lambda_j;
+  Neighbor_i[val_lane] = val_neighbor_i; Neighbor_j[val_lane] = val_neighbor_j;
+  Sensor_i[val_lane]   = val_sensor_i;   Sensor_j[val_lane]   = val_sensor_j;
+
+  for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+    Und_Lapl_i[iVar*BATCH_SIZE+val_lane] = val_und_lapl_i[iVar];
+    Und_Lapl_j[iVar*BATCH_SIZE+val_lane] = val_und_lapl_j[iVar];
+  }
+
+}
+
+void CCentJSTBatch_Flow::PadBatch(void) {
+
+  unsigned short iVar, k, last = nEdge-1;
+
+  CFluxBatch_Flow::PadBatch();
+
+  for (k = nEdge; k < BATCH_SIZE; k++) {
+    Lambda_i[k]   = Lambda_i[last];   Lambda_j[k]   = Lambda_j[last];
+    Neighbor_i[k] = Neighbor_i[last]; Neighbor_j[k] = Neighbor_j[last];
+    Sensor_i[k]   = Sensor_i[last];   Sensor_j[k]   = Sensor_j[last];
+    for (iVar = 0; iVar < nVar; iVar++) {
+      Und_Lapl_i[iVar*BATCH_SIZE+k] = Und_Lapl_i[iVar*BATCH_SIZE+last];
+      Und_Lapl_j[iVar*BATCH_SIZE+k] = Und_Lapl_j[iVar*BATCH_SIZE+last];
+    }
+  }
+
+}
+
+void CCentJSTBatch_Flow::ComputeLanes(void) {
+
+  const unsigned short W = BATCH_SIZE;
+
+  SU2_OMP_SIMD
+  for (unsigned short k = 0; k < W; k++) {
+
+    unsigned short iDim, iVar, jVar;
+    su2double LaneNormal[3], Velocity_i[3], Velocity_j[3], MeanVelocity[3];
+    su2double U_i[5], U_j[5], Flux[5];
+
+    /*--- Pressure, density, enthalpy, energy, and velocity at points i and j ---*/
+
+    su2double Pressure_i = V_i[(nDim+1)*W+k],   Pressure_j = V_j[(nDim+1)*W+k];
+    su2double Density_i  = V_i[(nDim+2)*W+k],   Density_j  = V_j[(nDim+2)*W+k];
+    su2double Enthalpy_i = V_i[(nDim+3)*W+k],   Enthalpy_j = V_j[(nDim+3)*W+k];
+    su2double SoundSpeed_i = V_i[(nDim+4)*W+k], SoundSpeed_j = V_j[(nDim+4)*W+k];
+    su2double Energy_i = Enthalpy_i - Pressure_i/Density_i;
+    su2double Energy_j = Enthalpy_j - Pressure_j/Density_j;
+
+    su2double sq_vel_i = 0.0, sq_vel_j = 0.0, ProjVelocity_i = 0.0, ProjVelocity_j = 0.0, Area = 0.0;
+    for (iDim = 0; iDim < nDim; iDim++) {
+      LaneNormal[iDim] = Normal[iDim*W+k];
+      Velocity_i[iDim] = V_i[(iDim+1)*W+k];
+      Velocity_j[iDim] = V_j[(iDim+1)*W+k];
+      MeanVelocity[iDim] = 0.5*(Velocity_i[iDim]+Velocity_j[iDim]);
+      sq_vel_i += 0.5*Velocity_i[iDim]*Velocity_i[iDim];
+      sq_vel_j += 0.5*Velocity_j[iDim]*Velocity_j[iDim];
+      ProjVelocity_i += Velocity_i[iDim]*LaneNormal[iDim];
+      ProjVelocity_j += Velocity_j[iDim]*LaneNormal[iDim];
+      Area += LaneNormal[iDim]*LaneNormal[iDim];
+    }
+    Area = sqrt(Area);
+
+    /*--- Conservative variables ---*/
+
+    U_i[0] = Density_i; U_j[0] = Density_j;
+    for (iDim = 0; iDim < nDim; iDim++) {
+      U_i[iDim+1] = Density_i*Velocity_i[iDim];
+      U_j[iDim+1] = Density_j*Velocity_j[iDim];
+    }
+    U_i[nDim+1] = Density_i*Energy_i;
+    U_j[nDim+1] = Density_j*Energy_j;
+
+    /*--- Inviscid flux of the mean state and its Jacobians (scale = 0.5) ---*/
+
+    su2double MeanDensity  = 0.5*(Density_i+Density_j);
+    su2double MeanPressure = 0.5*(Pressure_i+Pressure_j);
+    su2double MeanEnthalpy = 0.5*(Enthalpy_i+Enthalpy_j);
+    su2double MeanEnergy   = 0.5*(Energy_i+Energy_j);
+
+    ProjFlux(MeanDensity, MeanVelocity, MeanPressure, MeanEnthalpy, LaneNormal, Flux);
+
+    if (implicit) {
+      ProjJacobian(MeanVelocity, MeanEnergy, LaneNormal, 0.5, k, Jacobian_i);
+      for (iVar = 0; iVar < nVar; iVar++)
+        for (jVar = 0; jVar < nVar; jVar++)
+          Jacobian_j[(iVar*nVar+jVar)*W+k] = Jacobian_i[(iVar*nVar+jVar)*W+k];
+    }
+
+    /*--- Local spectral radius and stretching factor ---*/
+
+    su2double Local_Lambda_i = fabs(ProjVelocity_i)+SoundSpeed_i*Area;
+    su2double Local_Lambda_j = fabs(ProjVelocity_j)+SoundSpeed_j*Area;
+    su2double MeanLambda = 0.5*(Local_Lambda_i+Local_Lambda_j);
+
+    su2double Phi_i = pow(Lambda_i[k]/(4.0*MeanLambda), Param_p);
+    su2double Phi_j = pow(Lambda_j[k]/(4.0*MeanLambda), Param_p);
+    su2double StretchingFactor = 4.0*Phi_i*Phi_j/(Phi_i+Phi_j);
+
+    /*--- Dissipation coefficients ---*/
+
+    su2double sc2 = 3.0*(Neighbor_i[k]+Neighbor_j[k])/(Neighbor_i[k]*Neighbor_j[k]);
+    su2double sc4 = sc2*sc2/4.0;
+
+    su2double Epsilon_2 = Param_Kappa_2*0.5*(Sensor_i[k]+Sensor_j[k])*sc2;
+    su2double Epsilon_4 = max(0.0, Param_Kappa_4-Epsilon_2)*sc4;
+
+    /*--- Residual, the difference of the energy uses the enthalpy ---*/
+
+    for (iVar = 0; iVar < nVar; iVar++) {
+      su2double Diff_U = (iVar < nVar-1)? U_i[iVar]-U_j[iVar] : Density_i*Enthalpy_i-Density_j*Enthalpy_j;
+      su2double Diff_Lapl = Und_Lapl_i[iVar*W+k]-Und_Lapl_j[iVar*W+k];
+      Residual[iVar*W+k] = Flux[iVar] + (Epsilon_2*Diff_U - Epsilon_4*Diff_Lapl)*StretchingFactor*MeanLambda;
+    }
+
+    /*--- Jacobians of the scalar dissipation ---*/
+
+    if (implicit) {
+
+      su2double cte_0 = fix_factor*(Epsilon_2 + Epsilon_4*(Neighbor_i[k]+1.0))*StretchingFactor*MeanLambda;
+      su2double cte_1 = fix_factor*(Epsilon_2 + Epsilon_4*(Neighbor_j[k]+1.0))*StretchingFactor*MeanLambda;
+
+      for (iVar = 0; iVar < nVar-1; iVar++) {
+        Jacobian_i[(iVar*nVar+iVar)*W+k] += cte_0;
+        Jacobian_j[(iVar*nVar+iVar)*W+k] -= cte_1;
+      }
+
+      unsigned short Last = (nVar-1)*nVar;
+
+      Jacobian_i[Last*W+k] += cte_0*Gamma_Minus_One*sq_vel_i;
+      Jacobian_j[Last*W+k] -= cte_1*Gamma_Minus_One*sq_vel_j;
+      for (iDim = 0; iDim < nDim; iDim++) {
+        Jacobian_i[(Last+iDim+1)*W+k] -= cte_0*Gamma_Minus_One*Velocity_i[iDim];
+        Jacobian_j[(Last+iDim+1)*W+k] += cte_1*Gamma_Minus_One*Velocity_j[iDim];
+      }
+      Jacobian_i[(Last+nVar-1)*W+k] += cte_0*Gamma;
+      Jacobian_j[(Last+nVar-1)*W+k] -= cte_1*Gamma;
+
+    }
+
+  }
+
+}
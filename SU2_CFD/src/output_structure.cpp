@@ -4494,7 +4494,12 @@ void COutput::SetConvHistory_Header(ofstream *ConvHist_file, CConfig *config, un
   
   /*--- End of the header ---*/
   
-  char end[]= ",\"Linear_Solver_Iterations\",\"CFL_Number\",\"Time(min)\"\n";
+  string end = ",\"Linear_Solver_Iterations\",\"CFL_Number\",\"Time(min)\"\n";
+  
+  /*--- Number of preconditioner builds, when they can be reused by the linear solver ---*/
+  
+  if (config->GetLinear_Solver_Prec_Reuse() > 0)
+    end = ",\"Linear_Solver_Iterations\",\"Linear_Solver_Prec_Builds\",\"CFL_Number\",\"Time(min)\"\n";
   char endfea[]= ",\"Linear_Solver_Iterations\",\"Time(min)\"\n";
   
   if ((config->GetOutput_FileFormat() == TECPLOT) ||
@@ -4740,7 +4745,7 @@ void COutput::SetConvHistory_Body(ofstream *ConvHist_file,
     su2double dummy = 0.0, *Coord;
     unsigned short iVar, iMarker_Monitoring;
     
-    unsigned long LinSolvIter = 0, iPointMaxResid;
+    unsigned long LinSolvIter = 0, PrecBuilds = 0, iPointMaxResid;
     su2double timeiter = timeused/su2double(iExtIter+1);
     
     unsigned short nDim = geometry[val_iZone][val_iInst][FinestMesh]->GetnDim();
@@ -5124,6 +5129,7 @@ void COutput::SetConvHistory_Body(ofstream *ConvHist_file,
         /*--- Iterations of the linear solver ---*/
         
         LinSolvIter = (unsigned long) solver_container[val_iZone][val_iInst][FinestMesh][FLOW_SOL]->GetIterLinSolver();
+        PrecBuilds  = solver_container[val_iZone][val_iInst][FinestMesh][FLOW_SOL]->System.GetPrec_Builds();
         
         /*--- Adjoint solver ---*/
         
@@ -5280,7 +5286,10 @@ void COutput::SetConvHistory_Body(ofstream *ConvHist_file,
         SPRINTF(begin, "%12d", SU2_TYPE::Int(iExtIter+ExtIter_OffSet));
         
         /*--- Write the end of the history file ---*/
-        SPRINTF (end, ", %12.10f, %12.10f, %12.10f\n", su2double(LinSolvIter), config[val_iZone]->GetCFL(MESH_0), timeused/60.0);
+        if (config[val_iZone]->GetLinear_Solver_Prec_Reuse() > 0)
+          SPRINTF (end, ", %12.10f, %12.10f, %12.10f, %12.10f\n", su2double(LinSolvIter), su2double(PrecBuilds), config[val_iZone]->GetCFL(MESH_0), timeused/60.0);
+        else
+          SPRINTF (end, ", %12.10f, %12.10f, %12.10f\n", su2double(LinSolvIter), config[val_iZone]->GetCFL(MESH_0), timeused/60.0);
         
         /*--- Write the solution and residual of the history file ---*/
         switch (config[val_iZone]->GetKind_Solver()) {
@@ -8867,10 +8876,11 @@ void COutput::SetMesh_Files(CGeometry **geometry, CConfig **config, unsigned sho
   unsigned short iZone;
   ofstream output_file;
   string str;
+  bool su2_binary = (config[ZONE_0]->GetMesh_Out_FileFormat() == SU2_BINARY);
 
   /*--- Read the name of the output and input file ---*/
 
-  if (su2_file) {
+  if (su2_file && !su2_binary) {
     if (rank == MASTER_NODE) {
       str = config[ZONE_0]->GetMesh_Out_FileName();
       strcpy (out_file, str.c_str());
@@ -8953,9 +8963,14 @@ void COutput::SetMesh_Files(CGeometry **geometry, CConfig **config, unsigned sho
 
       if (su2_file) {
         
-        if (rank == MASTER_NODE) cout <<"Writing .su2 file." << endl;
-        
-        SetSU2_MeshASCII(config[iZone], geometry[iZone], iZone, output_file);
+        if (su2_binary) {
+          if (rank == MASTER_NODE) cout <<"Writing .su2 binary file." << endl;
+          SetSU2_MeshBinary(config[iZone], geometry[iZone], iZone);
+        }
+        else {
+          if (rank == MASTER_NODE) cout <<"Writing .su2 file." << endl;
+          SetSU2_MeshASCII(config[iZone], geometry[iZone], iZone, output_file);
+        }
         
         /*--- Write an stl surface file ---*/
         
@@ -13204,6 +13219,13 @@ void COutput::LoadLocalData_Flow(CConfig *config, CGeometry *geometry, CSolver *
   /*---         variable registration above for the files to be correct.   ---*/
   /*--------------------------------------------------------------------------*/
   
+  /*--- The conservative states are read from the contiguous storage of the
+   solvers when they have one. ---*/
+
+  CVariableStorage *Storage_First = solver[FirstIndex]->nodeStorage, *Storage_Second = NULL;
+  if (SecondIndex != NONE) Storage_Second = solver[SecondIndex]->nodeStorage;
+  su2double *Solution_First = NULL, *Solution_Second = NULL;
+
   jPoint = 0;
   
   for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
@@ -13227,8 +13249,10 @@ void COutput::LoadLocalData_Flow(CConfig *config, CGeometry *geometry, CSolver *
       
       /*--- Load the conservative variable states for the mean flow variables. ---*/
       
+      Solution_First = (Storage_First != NULL)? Storage_First->GetSolution(iPoint) :
+                                                solver[FirstIndex]->node[iPoint]->GetSolution();
       for (jVar = 0; jVar < nVar_First; jVar++) {
-        Local_Data[jPoint][iVar] = solver[FirstIndex]->node[iPoint]->GetSolution(jVar);
+        Local_Data[jPoint][iVar] = Solution_First[jVar];
         iVar++;
       }
       
@@ -13236,8 +13260,10 @@ void COutput::LoadLocalData_Flow(CConfig *config, CGeometry *geometry, CSolver *
        then load data for the conservative turbulence variables. ---*/
       
       if (SecondIndex != NONE) {
+        Solution_Second = (Storage_Second != NULL)? Storage_Second->GetSolution(iPoint) :
+                                                    solver[SecondIndex]->node[iPoint]->GetSolution();
         for (jVar = 0; jVar < nVar_Second; jVar++) {
-          Local_Data[jPoint][iVar] = solver[SecondIndex]->node[iPoint]->GetSolution(jVar);
+          Local_Data[jPoint][iVar] = Solution_Second[jVar];
           iVar++;
         }
       }
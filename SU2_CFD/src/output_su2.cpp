@@ -222,7 +222,163 @@ void COutput::SetSU2_MeshASCII(CConfig *config, CGeometry *geometry, unsigned sh
 
 }
 
-void COutput::SetSU2_MeshBinary(CConfig *config, CGeometry *geometry) { }
+void COutput::SetSU2_MeshBinary(CConfig *config, CGeometry *geometry, unsigned short val_iZone) {
+
+  unsigned long iElem, iPoint, iElem_Bound, nElem_Bound_, nElem, iNode, VTK_Type, vnode;
+  unsigned short iMarker, iDim, nDim = geometry->GetnDim(), iChar, iType, nNodes, nMarker_ = 0;
+  ifstream input_file;
+  string text_line, Marker_Tag, str;
+  string::size_type position;
+
+  if (config->GetnZone() > 1) {
+    SU2_MPI::Error("The SU2_BINARY mesh format only supports single zone meshes.", CURRENT_FUNCTION);
+  }
+
+  /*--- Volume connectivity, the VTK type followed by the nodes of each element,
+   and the offset of each element in that list (for the partitioned reads). ---*/
+
+  const unsigned long nGlobal_Type[] = {nGlobal_Tria, nGlobal_Quad, nGlobal_Tetr, nGlobal_Hexa, nGlobal_Pris, nGlobal_Pyra};
+  const int *Conn_Type[] = {Conn_Tria, Conn_Quad, Conn_Tetr, Conn_Hexa, Conn_Pris, Conn_Pyra};
+  const unsigned short VTK_Types[] = {TRIANGLE, QUADRILATERAL, TETRAHEDRON, HEXAHEDRON, PRISM, PYRAMID};
+  const unsigned short nNodes_Type[] = {N_POINTS_TRIANGLE, N_POINTS_QUADRILATERAL, N_POINTS_TETRAHEDRON,
+                                        N_POINTS_HEXAHEDRON, N_POINTS_PRISM, N_POINTS_PYRAMID};
+
+  nElem = 0;
+  for (iType = 0; iType < 6; iType++) nElem += nGlobal_Type[iType];
+
+  vector<long long> ElemOffset(nElem+1, 0), ElemConn;
+
+  nElem = 0;
+  for (iType = 0; iType < 6; iType++) {
+    for (iElem = 0; iElem < nGlobal_Type[iType]; iElem++) {
+      ElemConn.push_back(VTK_Types[iType]);
+      for (iNode = 0; iNode < nNodes_Type[iType]; iNode++)
+        ElemConn.push_back(Conn_Type[iType][iElem*nNodes_Type[iType]+iNode]-1);
+      ElemOffset[++nElem] = ElemConn.size();
+    }
+  }
+
+  /*--- Read the boundary information, as for the ASCII format. ---*/
+
+  vector<string> Marker_Tags;
+  vector<long long> Marker_nElem;
+  vector<vector<long long> > Marker_Conn;
+
+  str = "boundary.dat";
+  str = config->GetMultizone_FileName(str, val_iZone);
+  input_file.open(str.c_str(), ios::in);
+
+  while (getline (input_file, text_line)) {
+
+    position = text_line.find ("NMARK=",0);
+    if (position != string::npos) {
+
+      text_line.erase (0,6); nMarker_ = atoi(text_line.c_str());
+      Marker_Conn.resize(nMarker_);
+
+      for (iMarker = 0 ; iMarker < nMarker_; iMarker++) {
+
+        getline (input_file, text_line);
+        text_line.erase (0,11);
+        for (iChar = 0; iChar < 20; iChar++) {
+          position = text_line.find( " ", 0 );
+          if (position != string::npos) text_line.erase (position,1);
+          position = text_line.find( "\r", 0 );
+          if (position != string::npos) text_line.erase (position,1);
+          position = text_line.find( "\n", 0 );
+          if (position != string::npos) text_line.erase (position,1);
+        }
+        Marker_Tag = text_line.c_str();
+
+        if (Marker_Tag == "SEND_RECEIVE") {
+          SU2_MPI::Error("SEND_RECEIVE markers are not supported by the SU2_BINARY mesh format.", CURRENT_FUNCTION);
+        }
+
+        getline (input_file, text_line);
+        text_line.erase (0,13); nElem_Bound_ = atoi(text_line.c_str());
+        getline (input_file, text_line);
+
+        Marker_Tags.push_back(Marker_Tag);
+        Marker_nElem.push_back(nElem_Bound_);
+
+        for (iElem_Bound = 0; iElem_Bound < nElem_Bound_; iElem_Bound++) {
+
+          getline(input_file, text_line);
+          istringstream bound_line(text_line);
+          bound_line >> VTK_Type;
+
+          switch(VTK_Type) {
+            case LINE:          nNodes = N_POINTS_LINE;          break;
+            case TRIANGLE:      nNodes = N_POINTS_TRIANGLE;      break;
+            case QUADRILATERAL: nNodes = N_POINTS_QUADRILATERAL; break;
+            default:
+              SU2_MPI::Error("Unsupported boundary element type for the SU2_BINARY mesh format.", CURRENT_FUNCTION);
+              nNodes = 0;
+          }
+
+          Marker_Conn[iMarker].push_back(VTK_Type);
+          for (iNode = 0; iNode < nNodes; iNode++) {
+            bound_line >> vnode; Marker_Conn[iMarker].push_back(vnode);
+          }
+        }
+      }
+    }
+  }
+
+  input_file.close();
+  remove(str.c_str());
+
+  /*--- Header, see ENUM_MESH_BINARY_HEADER. ---*/
+
+  long long Mesh_Vars[MESH_BIN_NVARS];
+  Mesh_Vars[MESH_BIN_MAGIC]        = MESH_BIN_FORMAT_ID;
+  Mesh_Vars[MESH_BIN_VERSION]      = MESH_BIN_FORMAT_VERSION;
+  Mesh_Vars[MESH_BIN_NDIM]         = nDim;
+  Mesh_Vars[MESH_BIN_NPOINT]       = nGlobal_Doma;
+  Mesh_Vars[MESH_BIN_NPOINTDOMAIN] = nGlobal_Doma;
+  if (geometry->GetGlobal_nPointDomain() != nGlobal_Doma)
+    Mesh_Vars[MESH_BIN_NPOINTDOMAIN] = geometry->GetGlobal_nPointDomain();
+  Mesh_Vars[MESH_BIN_NELEM]        = nElem;
+  Mesh_Vars[MESH_BIN_NELEMCONN]    = ElemConn.size();
+  Mesh_Vars[MESH_BIN_NMARKER]      = nMarker_;
+
+  passivedouble Mesh_Offsets[2] = {SU2_TYPE::GetValue(config->GetAoA_Offset()),
+                                   SU2_TYPE::GetValue(config->GetAoS_Offset())};
+
+  passivedouble *buf = new passivedouble[nGlobal_Doma*nDim];
+  for (iPoint = 0; iPoint < nGlobal_Doma; iPoint++)
+    for (iDim = 0; iDim < nDim; iDim++)
+      buf[iPoint*nDim+iDim] = SU2_TYPE::GetValue(Coords[iDim][iPoint]);
+
+  /*--- Write the file (serial, the data was merged on the master). ---*/
+
+  str = config->GetMesh_Out_FileName();
+  FILE *fhw = fopen(str.c_str(), "wb");
+
+  if (!fhw) {
+    SU2_MPI::Error(string("Unable to open SU2 binary mesh file ") + str, CURRENT_FUNCTION);
+  }
+
+  fwrite(Mesh_Vars, sizeof(long long), MESH_BIN_NVARS, fhw);
+  fwrite(Mesh_Offsets, sizeof(passivedouble), 2, fhw);
+  fwrite(buf, sizeof(passivedouble), nGlobal_Doma*nDim, fhw);
+  fwrite(&ElemOffset[0], sizeof(long long), ElemOffset.size(), fhw);
+  if (!ElemConn.empty()) fwrite(&ElemConn[0], sizeof(long long), ElemConn.size(), fhw);
+
+  for (iMarker = 0; iMarker < nMarker_; iMarker++) {
+    long long Marker_Vars[3] = {(long long)Marker_Tags[iMarker].size(), Marker_nElem[iMarker],
+                                (long long)Marker_Conn[iMarker].size()};
+    fwrite(Marker_Vars, sizeof(long long), 3, fhw);
+    fwrite(Marker_Tags[iMarker].c_str(), sizeof(char), Marker_Tags[iMarker].size(), fhw);
+    if (!Marker_Conn[iMarker].empty())
+      fwrite(&Marker_Conn[iMarker][0], sizeof(long long), Marker_Conn[iMarker].size(), fhw);
+  }
+
+  fclose(fhw);
+
+  delete [] buf;
+
+}
 
 void COutput::WriteCoordinates_Binary(CConfig *config, CGeometry *geometry, unsigned short val_iZone) {
   
@@ -2146,15 +2146,15 @@ void CFEASolver::Postprocessing(CGeometry *geometry, CSolver **solver_container,
     else {
       /*--- If the problem is linear, the only check we do is the RMS of the displacements ---*/
       /*---  Compute the residual Ax-f ---*/
-#ifndef CODI_REVERSE_TYPE
+#if !defined CODI_REVERSE_TYPE && !defined SU2_MIXED_PRECISION
       Jacobian.ComputeResidual(LinSysSol, LinSysRes, LinSysAux);
 #else
       /*---  We need temporaries to interface with the matrix ---*/
       {
-        CSysVector<passivedouble> sol, res;
+        CSysVector<su2mixedfloat> sol, res;
         sol.PassiveCopy(LinSysSol);
         res.PassiveCopy(LinSysRes);
-        CSysVector<passivedouble> aux(res);
+        CSysVector<su2mixedfloat> aux(res);
         Jacobian.ComputeResidual(sol, res, aux);
         LinSysAux.PassiveCopy(aux);
       }
@@ -2266,15 +2266,15 @@ void CFEASolver::Postprocessing(CGeometry *geometry, CSolver **solver_container,
       /*--- If the problem is linear, the only check we do is the RMS of the displacements ---*/
 
       /*---  Compute the residual Ax-f ---*/
-#ifndef CODI_REVERSE_TYPE
+#if !defined CODI_REVERSE_TYPE && !defined SU2_MIXED_PRECISION
       Jacobian.ComputeResidual(LinSysSol, LinSysRes, LinSysAux);
 #else
       /*---  We need temporaries to interface with the matrix ---*/
       {
-        CSysVector<passivedouble> sol, res;
+        CSysVector<su2mixedfloat> sol, res;
         sol.PassiveCopy(LinSysSol);
         res.PassiveCopy(LinSysRes);
-        CSysVector<passivedouble> aux(res);
+        CSysVector<su2mixedfloat> aux(res);
         Jacobian.ComputeResidual(sol, res, aux);
         LinSysAux.PassiveCopy(aux);
       }
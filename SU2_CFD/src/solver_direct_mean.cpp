@@ -36,6 +36,7 @@
  */
 
 #include "../include/solver_structure.hpp"
+#include "../include/integration_structure.hpp"
 #include "../../Common/include/toolboxes/printing_toolbox.hpp"
 #include "../include/variables/CEulerVariable.hpp"
 #include "../include/variables/CNSVariable.hpp"
@@ -797,10 +798,39 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config, unsigned short
     }
   }
 
-  /*--- Initialize the solution to the far-field state everywhere. ---*/
+  /*--- The edge loops need the sorted and colored edges, which are normally
+   set during the geometrical preprocessing. ---*/
 
-  for (iPoint = 0; iPoint < nPoint; iPoint++)
+  if (geometry->GetnEdgeColor() == 0) geometry->SetEdgeColoring(config);
+
+  /*--- Initialize the solution to the far-field state everywhere. The main
+   fields of each point are moved to the contiguous storage of the solver as
+   soon as the point is created. ---*/
+
+  nodeStorage = new CVariableStorage(nPoint, nDim, nVar, nPrimVar, nPrimVarGrad);
+
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
     node[iPoint] = new CEulerVariable(Density_Inf, Velocity_Inf, Energy_Inf, nDim, nVar, config);
+    node[iPoint]->SetExternalStorage(nodeStorage, iPoint);
+  }
+
+  /*--- Work arrays of each thread of the edge loops. ---*/
+
+  for (int iThread = 0; iThread < omp_get_max_threads(); iThread++)
+    EdgeLoopWork.push_back(new CEdgeLoopWork(nDim, nVar, nPrimVar, nSecondaryVar));
+
+  /*--- Batched convective kernels, used by the edge loops for the plain Roe
+   and JST schemes. They are only compiled in for the passive (double) build. ---*/
+
+#if !defined CODI_REVERSE_TYPE && !defined CODI_FORWARD_TYPE
+  bool ideal_gas_model = (config->GetKind_FluidModel() == STANDARD_AIR || config->GetKind_FluidModel() == IDEAL_GAS);
+  for (int iThread = 0; iThread < omp_get_max_threads(); iThread++) {
+    if ((config->GetKind_ConvNumScheme_Flow() == SPACE_UPWIND) && (config->GetKind_Upwind_Flow() == ROE) && ideal_gas_model)
+      RoeBatch.push_back(new CUpwRoeBatch_Flow(nDim, nVar, config));
+    if ((config->GetKind_ConvNumScheme_Flow() == SPACE_CENTERED) && (config->GetKind_Centered_Flow() == JST) && (iMesh == MESH_0))
+      JSTBatch.push_back(new CCentJSTBatch_Flow(nDim, nVar, config));
+  }
+#endif
 
   /*--- Check that the initial solution is physical, report any non-physical nodes ---*/
 
@@ -1118,6 +1148,9 @@ CEulerSolver::~CEulerSolver(void) {
   
   if (FluidModel != NULL) delete FluidModel;
 
+  for (unsigned long iThread = 0; iThread < RoeBatch.size(); iThread++) delete RoeBatch[iThread];
+  for (unsigned long iThread = 0; iThread < JSTBatch.size(); iThread++) delete JSTBatch[iThread];
+
   if(AverageVelocity !=NULL){
     for (iMarker = 0; iMarker < nMarker; iMarker++) {
       for(iSpan = 0; iSpan < nSpanWiseSections + 1; iSpan++)
@@ -2978,7 +3011,7 @@ void CEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
   unsigned long ExtIter = config->GetExtIter();
   bool cont_adjoint     = config->GetContinuous_Adjoint();
   bool disc_adjoint     = config->GetDiscrete_Adjoint();
-  bool implicit         = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit         = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !ResidualOnly;
   bool muscl            = (config->GetMUSCL_Flow() || (cont_adjoint && config->GetKind_ConvNumScheme_AdjFlow() == ROE));
   bool limiter          = (config->GetKind_SlopeLimit_Flow() != NO_LIMITER) && (ExtIter <= config->GetLimiterIter());
   bool center           = (config->GetKind_ConvNumScheme_Flow() == SPACE_CENTERED) || (cont_adjoint && config->GetKind_ConvNumScheme_AdjFlow() == SPACE_CENTERED);
@@ -3293,76 +3326,131 @@ void CEulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container,
 void CEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics,
                                      CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
   
-  unsigned long iEdge, iPoint, jPoint;
-  
-  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !ResidualOnly;
   bool jst_scheme = ((config->GetKind_Centered_Flow() == JST) && (iMesh == MESH_0));
   bool grid_movement = config->GetGrid_Movement();
   
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-    
-    /*--- Points in edge, set normal vectors, and number of neighbors ---*/
-    
-    iPoint = geometry->edge[iEdge]->GetNode(0); jPoint = geometry->edge[iEdge]->GetNode(1);
-    numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
-    numerics->SetNeighbor(geometry->node[iPoint]->GetnNeighbor(), geometry->node[jPoint]->GetnNeighbor());
-    
-    /*--- Set primitive variables w/o reconstruction ---*/
-    
-    numerics->SetPrimitive(node[iPoint]->GetPrimitive(), node[jPoint]->GetPrimitive());
-    
-    /*--- Set the largest convective eigenvalue ---*/
-    
-    numerics->SetLambda(node[iPoint]->GetLambda(), node[jPoint]->GetLambda());
-    
-    /*--- Set undivided laplacian an pressure based sensor ---*/
+  /*--- Loop over the edges by color, each thread has its own numerics, work arrays and batch. ---*/
+  
+  SU2_OMP(parallel if(GetThreaded_EdgeLoops()))
+  {
+    CNumerics *edge_numerics = GetThreadNumerics(numerics, CONV_TERM);
+    CEdgeLoopWork &work = *EdgeLoopWork[omp_get_thread_num()];
     
-    if (jst_scheme) {
-      numerics->SetUndivided_Laplacian(node[iPoint]->GetUndivided_Laplacian(), node[jPoint]->GetUndivided_Laplacian());
-      numerics->SetSensor(node[iPoint]->GetSensor(), node[jPoint]->GetSensor());
-    }
+    /*--- The JST fluxes on fixed grids are evaluated in batches of edges. ---*/
     
-    /*--- Grid movement ---*/
+    CCentJSTBatch_Flow *batch = NULL;
+    if (jst_scheme && !grid_movement && !JSTBatch.empty()) batch = JSTBatch[omp_get_thread_num()];
     
-    if (grid_movement) {
-      numerics->SetGridVel(geometry->node[iPoint]->GetGridVel(), geometry->node[jPoint]->GetGridVel());
+    for (unsigned long iColor = 0; iColor < geometry->GetnEdgeColor(); iColor++) {
+      
+      SU2_OMP(for schedule(static, geometry->GetEdgeColorGroupSize()) nowait)
+      for (unsigned long iEdge = geometry->GetEdgeColorBegin(iColor); iEdge < geometry->GetEdgeColorEnd(iColor); iEdge++) {
+        
+        /*--- Points in edge, set normal vectors, and number of neighbors ---*/
+        
+        unsigned long iPoint = geometry->GetEdgeNodes(iEdge)[0], jPoint = geometry->GetEdgeNodes(iEdge)[1];
+        
+        if (batch != NULL) {
+          unsigned short iLane = batch->SetEdge(iPoint, jPoint, geometry->GetEdgeNormal(iEdge),
+                                                node[iPoint]->GetPrimitive(), node[jPoint]->GetPrimitive());
+          batch->SetDissipation(iLane, node[iPoint]->GetLambda(), node[jPoint]->GetLambda(),
+                                geometry->node[iPoint]->GetnNeighbor(), geometry->node[jPoint]->GetnNeighbor(),
+                                node[iPoint]->GetSensor(), node[jPoint]->GetSensor(),
+                                node[iPoint]->GetUndivided_Laplacian(), node[jPoint]->GetUndivided_Laplacian());
+          if (batch->IsFull()) Flush_ConvBatch(batch, &work, implicit);
+          continue;
+        }
+        
+        edge_numerics->SetNormal(geometry->GetEdgeNormal(iEdge));
+        edge_numerics->SetNeighbor(geometry->node[iPoint]->GetnNeighbor(), geometry->node[jPoint]->GetnNeighbor());
+        
+        /*--- Set primitive variables w/o reconstruction ---*/
+        
+        edge_numerics->SetPrimitive(node[iPoint]->GetPrimitive(), node[jPoint]->GetPrimitive());
+        
+        /*--- Set the largest convective eigenvalue ---*/
+        
+        edge_numerics->SetLambda(node[iPoint]->GetLambda(), node[jPoint]->GetLambda());
+        
+        /*--- Set undivided laplacian an pressure based sensor ---*/
+        
+        if (jst_scheme) {
+          edge_numerics->SetUndivided_Laplacian(node[iPoint]->GetUndivided_Laplacian(), node[jPoint]->GetUndivided_Laplacian());
+          edge_numerics->SetSensor(node[iPoint]->GetSensor(), node[jPoint]->GetSensor());
+        }
+        
+        /*--- Grid movement ---*/
+        
+        if (grid_movement) {
+          edge_numerics->SetGridVel(geometry->node[iPoint]->GetGridVel(), geometry->node[jPoint]->GetGridVel());
+        }
+        
+        /*--- Compute residuals, and Jacobians ---*/
+        
+        edge_numerics->ComputeResidual(work.Residual, work.Jacobian_i, work.Jacobian_j, config);
+        
+        /*--- Update convective and artificial dissipation residuals ---*/
+        
+        LinSysRes.AddBlock(iPoint, work.Residual);
+        LinSysRes.SubtractBlock(jPoint, work.Residual);
+        
+        /*--- Set implicit computation ---*/
+        if (implicit) {
+          Jacobian.AddBlock(iPoint, iPoint, work.Jacobian_i);
+          Jacobian.AddBlock(iPoint, jPoint, work.Jacobian_j);
+          Jacobian.SubtractBlock(jPoint, iPoint, work.Jacobian_i);
+          Jacobian.SubtractBlock(jPoint, jPoint, work.Jacobian_j);
+        }
+      }
+      
+      /*--- The edges left in the batch belong to this color, they are added
+       before any thread moves on to the next color. ---*/
+      
+      if (batch != NULL) Flush_ConvBatch(batch, &work, implicit);
+      SU2_OMP_BARRIER
     }
+  }
+  
+}
+
+void CEulerSolver::Flush_ConvBatch(CFluxBatch_Flow *batch, CEdgeLoopWork *work, bool implicit) {
+  
+  unsigned short iLane;
+  unsigned long iPoint, jPoint;
+  
+  batch->ComputeBatch();
+  
+  /*--- Scatter the fluxes of the batch, in the order of the edges. ---*/
+  
+  for (iLane = 0; iLane < batch->GetnEdge(); iLane++) {
     
-    /*--- Compute residuals, and Jacobians ---*/
-    
-    numerics->ComputeResidual(Res_Conv, Jacobian_i, Jacobian_j, config);
-    
-    /*--- Update convective and artificial dissipation residuals ---*/
+    iPoint = batch->GetPoint_i(iLane); jPoint = batch->GetPoint_j(iLane);
     
-    LinSysRes.AddBlock(iPoint, Res_Conv);
-    LinSysRes.SubtractBlock(jPoint, Res_Conv);
+    batch->GetResidual(iLane, work->Residual);
+    LinSysRes.AddBlock(iPoint, work->Residual);
+    LinSysRes.SubtractBlock(jPoint, work->Residual);
     
-    /*--- Set implicit computation ---*/
     if (implicit) {
-      Jacobian.AddBlock(iPoint, iPoint, Jacobian_i);
-      Jacobian.AddBlock(iPoint, jPoint, Jacobian_j);
-      Jacobian.SubtractBlock(jPoint, iPoint, Jacobian_i);
-      Jacobian.SubtractBlock(jPoint, jPoint, Jacobian_j);
+      batch->GetJacobians(iLane, work->Jacobian_i, work->Jacobian_j);
+      Jacobian.AddBlock(iPoint, iPoint, work->Jacobian_i);
+      Jacobian.AddBlock(iPoint, jPoint, work->Jacobian_j);
+      Jacobian.SubtractBlock(jPoint, iPoint, work->Jacobian_i);
+      Jacobian.SubtractBlock(jPoint, jPoint, work->Jacobian_j);
     }
   }
   
+  batch->Clear();
+  
 }
 
 void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics,
                                    CConfig *config, unsigned short iMesh) {
   
-  su2double **Gradient_i, **Gradient_j, Project_Grad_i, Project_Grad_j, RoeVelocity[3] = {0.0,0.0,0.0}, R, sq_vel, RoeEnthalpy,
-  *V_i, *V_j, *S_i, *S_j, *Limiter_i = NULL, *Limiter_j = NULL, sqvel, Non_Physical = 1.0, Sensor_i, Sensor_j, Dissipation_i, Dissipation_j, *Coord_i, *Coord_j;
-  
-  su2double z, velocity2_i, velocity2_j, mach_i, mach_j, vel_i_corr[3], vel_j_corr[3];
-  
-  unsigned long iEdge, iPoint, jPoint, counter_local = 0, counter_global = 0;
-  unsigned short iDim, iVar;
-  
-  bool neg_density_i = false, neg_density_j = false, neg_pressure_i = false, neg_pressure_j = false, neg_sound_speed = false;
+  unsigned long counter_local = 0, counter_global = 0;
   
   unsigned long ExtIter = config->GetExtIter();
-  bool implicit         = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit         = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !ResidualOnly;
   bool muscl            = (config->GetMUSCL_Flow() && (iMesh == MESH_0));
   bool limiter          = (config->GetKind_SlopeLimit_Flow() != NO_LIMITER) && (ExtIter <= config->GetLimiterIter());
   bool grid_movement    = config->GetGrid_Movement();
@@ -3371,219 +3459,282 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
   bool van_albada       = config->GetKind_SlopeLimit_Flow() == VAN_ALBADA_EDGE;
   bool low_mach_corr    = config->Low_Mach_Correction();
   unsigned short kind_dissipation = config->GetKind_RoeLowDiss();
-    
-  /*--- Loop over all the edges ---*/
 
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-    
-    /*--- Points in edge and normal vectors ---*/
-    
-    iPoint = geometry->edge[iEdge]->GetNode(0); jPoint = geometry->edge[iEdge]->GetNode(1);
-    numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
+  /*--- Read the point data directly from the contiguous storage when available. ---*/
+
+  CVariableStorage *storage = nodeStorage;
+  if ((storage != NULL) && (storage->GetnPrimVarGrad() != nPrimVarGrad)) storage = NULL;
+  
+  /*--- Loop over the edges by color, each thread has its own numerics, work arrays and
+   batch. The fluid model is shared, hence the thermodynamic extrapolation of non ideal
+   gases and the low Mach correction keep the loop on the master thread. ---*/
+
+  SU2_OMP(parallel if(GetThreaded_EdgeLoops() && ideal_gas && !low_mach_corr) reduction(+:counter_local))
+  {
+    su2double **Gradient_i, **Gradient_j, Project_Grad_i, Project_Grad_j, RoeVelocity[3] = {0.0,0.0,0.0}, R, sq_vel, RoeEnthalpy,
+    *V_i, *V_j, *S_i, *S_j, *Limiter_i = NULL, *Limiter_j = NULL, sqvel, Non_Physical = 1.0, Sensor_i, Sensor_j, Dissipation_i, Dissipation_j, *Coord_i, *Coord_j;
     
-    /*--- Roe Turkel preconditioning ---*/
+    su2double z, velocity2_i, velocity2_j, mach_i, mach_j, vel_i_corr[3], vel_j_corr[3];
     
-    if (roe_turkel) {
-      sqvel = 0.0;
-      for (iDim = 0; iDim < nDim; iDim ++)
-        sqvel += config->GetVelocity_FreeStream()[iDim]*config->GetVelocity_FreeStream()[iDim];
-      numerics->SetVelocity2_Inf(sqvel);
-    }
+    unsigned long iPoint, jPoint;
+    unsigned short iDim, iVar;
     
-    /*--- Grid movement ---*/
+    bool neg_density_i = false, neg_density_j = false, neg_pressure_i = false, neg_pressure_j = false, neg_sound_speed = false;
+
+    CNumerics *edge_numerics = GetThreadNumerics(numerics, CONV_TERM);
+    CEdgeLoopWork &work = *EdgeLoopWork[omp_get_thread_num()];
+    su2double *Primitive_i = work.Primitive_i, *Primitive_j = work.Primitive_j;
+    su2double *Secondary_i = work.Secondary_i, *Secondary_j = work.Secondary_j;
     
-    if (grid_movement)
-      numerics->SetGridVel(geometry->node[iPoint]->GetGridVel(), geometry->node[jPoint]->GetGridVel());
+    /*--- The plain Roe fluxes on fixed grids are evaluated in batches of edges,
+     after the reconstruction of each edge. ---*/
     
-    /*--- Get primitive variables ---*/
+    CUpwRoeBatch_Flow *batch = NULL;
+    if (!grid_movement && (kind_dissipation == NO_ROELOWDISS) && !RoeBatch.empty()) batch = RoeBatch[omp_get_thread_num()];
     
-    V_i = node[iPoint]->GetPrimitive(); V_j = node[jPoint]->GetPrimitive();
-    S_i = node[iPoint]->GetSecondary(); S_j = node[jPoint]->GetSecondary();
+    for (unsigned long iColor = 0; iColor < geometry->GetnEdgeColor(); iColor++) {
 
-    /*--- High order reconstruction using MUSCL strategy ---*/
-    
-    if (muscl) {
-      
-      for (iDim = 0; iDim < nDim; iDim++) {
-        Vector_i[iDim] = 0.5*(geometry->node[jPoint]->GetCoord(iDim) - geometry->node[iPoint]->GetCoord(iDim));
-        Vector_j[iDim] = 0.5*(geometry->node[iPoint]->GetCoord(iDim) - geometry->node[jPoint]->GetCoord(iDim));
-      }
-      
-      Gradient_i = node[iPoint]->GetGradient_Primitive();
-      Gradient_j = node[jPoint]->GetGradient_Primitive();
-      if (limiter) {
-        Limiter_i = node[iPoint]->GetLimiter_Primitive();
-        Limiter_j = node[jPoint]->GetLimiter_Primitive();
-      }
-      
-      for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
-        Project_Grad_i = 0.0; Project_Grad_j = 0.0;
-        Non_Physical = node[iPoint]->GetNon_Physical()*node[jPoint]->GetNon_Physical();
-        for (iDim = 0; iDim < nDim; iDim++) {
-          Project_Grad_i += Vector_i[iDim]*Gradient_i[iVar][iDim]*Non_Physical;
-          Project_Grad_j += Vector_j[iDim]*Gradient_j[iVar][iDim]*Non_Physical;
-        }
-        if (limiter) {
-          if (van_albada){
-            Limiter_i[iVar] = (V_j[iVar]-V_i[iVar])*(2.0*Project_Grad_i + V_j[iVar]-V_i[iVar])/(4*Project_Grad_i*Project_Grad_i+(V_j[iVar]-V_i[iVar])*(V_j[iVar]-V_i[iVar])+EPS);
-            Limiter_j[iVar] = (V_j[iVar]-V_i[iVar])*(-2.0*Project_Grad_j + V_j[iVar]-V_i[iVar])/(4*Project_Grad_j*Project_Grad_j+(V_j[iVar]-V_i[iVar])*(V_j[iVar]-V_i[iVar])+EPS);
-          }
-          Primitive_i[iVar] = V_i[iVar] + Limiter_i[iVar]*Project_Grad_i;
-          Primitive_j[iVar] = V_j[iVar] + Limiter_j[iVar]*Project_Grad_j;
+      SU2_OMP(for schedule(static, geometry->GetEdgeColorGroupSize()) nowait)
+      for (unsigned long iEdge = geometry->GetEdgeColorBegin(iColor); iEdge < geometry->GetEdgeColorEnd(iColor); iEdge++) {
+        
+        /*--- Points in edge and normal vectors ---*/
+        
+        iPoint = geometry->GetEdgeNodes(iEdge)[0]; jPoint = geometry->GetEdgeNodes(iEdge)[1];
+        edge_numerics->SetNormal(geometry->GetEdgeNormal(iEdge));
+        
+        /*--- Roe Turkel preconditioning ---*/
+        
+        if (roe_turkel) {
+          sqvel = 0.0;
+          for (iDim = 0; iDim < nDim; iDim ++)
+            sqvel += config->GetVelocity_FreeStream()[iDim]*config->GetVelocity_FreeStream()[iDim];
+          edge_numerics->SetVelocity2_Inf(sqvel);
         }
-        else {
-          Primitive_i[iVar] = V_i[iVar] + Project_Grad_i;
-          Primitive_j[iVar] = V_j[iVar] + Project_Grad_j;
+        
+        /*--- Grid movement ---*/
+        
+        if (grid_movement)
+          edge_numerics->SetGridVel(geometry->node[iPoint]->GetGridVel(), geometry->node[jPoint]->GetGridVel());
+        
+        /*--- Get primitive variables ---*/
+        
+        if (storage != NULL) {
+          V_i = storage->GetPrimitive(iPoint); V_j = storage->GetPrimitive(jPoint);
+        } else {
+          V_i = node[iPoint]->GetPrimitive(); V_j = node[jPoint]->GetPrimitive();
         }
-      }
+        S_i = node[iPoint]->GetSecondary(); S_j = node[jPoint]->GetSecondary();
 
-      /*--- Recompute the extrapolated quantities in a
-       thermodynamic consistent way  ---*/
+        /*--- High order reconstruction using MUSCL strategy ---*/
+        
+        if (muscl) {
+          
+          for (iDim = 0; iDim < nDim; iDim++) {
+            work.Vector_i[iDim] = 0.5*(geometry->node[jPoint]->GetCoord(iDim) - geometry->node[iPoint]->GetCoord(iDim));
+            work.Vector_j[iDim] = 0.5*(geometry->node[iPoint]->GetCoord(iDim) - geometry->node[jPoint]->GetCoord(iDim));
+          }
+          
+          if (storage != NULL) {
+            Gradient_i = storage->GetGradient_Primitive(iPoint);
+            Gradient_j = storage->GetGradient_Primitive(jPoint);
+            if (limiter) {
+              Limiter_i = storage->GetLimiter_Primitive(iPoint);
+              Limiter_j = storage->GetLimiter_Primitive(jPoint);
+            }
+          } else {
+            Gradient_i = node[iPoint]->GetGradient_Primitive();
+            Gradient_j = node[jPoint]->GetGradient_Primitive();
+            if (limiter) {
+              Limiter_i = node[iPoint]->GetLimiter_Primitive();
+              Limiter_j = node[jPoint]->GetLimiter_Primitive();
+            }
+          }
+          
+          for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+            Project_Grad_i = 0.0; Project_Grad_j = 0.0;
+            Non_Physical = node[iPoint]->GetNon_Physical()*node[jPoint]->GetNon_Physical();
+            for (iDim = 0; iDim < nDim; iDim++) {
+              Project_Grad_i += work.Vector_i[iDim]*Gradient_i[iVar][iDim]*Non_Physical;
+              Project_Grad_j += work.Vector_j[iDim]*Gradient_j[iVar][iDim]*Non_Physical;
+            }
+            if (limiter) {
+              if (van_albada){
+                Limiter_i[iVar] = (V_j[iVar]-V_i[iVar])*(2.0*Project_Grad_i + V_j[iVar]-V_i[iVar])/(4*Project_Grad_i*Project_Grad_i+(V_j[iVar]-V_i[iVar])*(V_j[iVar]-V_i[iVar])+EPS);
+                Limiter_j[iVar] = (V_j[iVar]-V_i[iVar])*(-2.0*Project_Grad_j + V_j[iVar]-V_i[iVar])/(4*Project_Grad_j*Project_Grad_j+(V_j[iVar]-V_i[iVar])*(V_j[iVar]-V_i[iVar])+EPS);
+              }
+              Primitive_i[iVar] = V_i[iVar] + Limiter_i[iVar]*Project_Grad_i;
+              Primitive_j[iVar] = V_j[iVar] + Limiter_j[iVar]*Project_Grad_j;
+            }
+            else {
+              Primitive_i[iVar] = V_i[iVar] + Project_Grad_i;
+              Primitive_j[iVar] = V_j[iVar] + Project_Grad_j;
+            }
+          }
 
-      if (!ideal_gas || low_mach_corr) { ComputeConsExtrapolation(config); }
+          /*--- Recompute the extrapolated quantities in a
+           thermodynamic consistent way  ---*/
 
-      /*--- Low-Mach number correction ---*/
+          if (!ideal_gas || low_mach_corr) { ComputeConsExtrapolation(&work, config); }
 
-      if (low_mach_corr) {
+          /*--- Low-Mach number correction ---*/
 
-        velocity2_i = 0.0;
-        velocity2_j = 0.0;
-        
-        for (iDim = 0; iDim < nDim; iDim++) {
-          velocity2_i += Primitive_i[iDim+1]*Primitive_i[iDim+1];
-          velocity2_j += Primitive_j[iDim+1]*Primitive_j[iDim+1];
-        }
-        mach_i = sqrt(velocity2_i)/Primitive_i[nDim+4];
-        mach_j = sqrt(velocity2_j)/Primitive_j[nDim+4];
+          if (low_mach_corr) {
 
-        z = min(max(mach_i,mach_j),1.0);
-        velocity2_i = 0.0;
-        velocity2_j = 0.0;
-        for (iDim = 0; iDim < nDim; iDim++) {
-          vel_i_corr[iDim] = ( Primitive_i[iDim+1] + Primitive_j[iDim+1] )/2.0 \
-                  + z * ( Primitive_i[iDim+1] - Primitive_j[iDim+1] )/2.0;
-          vel_j_corr[iDim] = ( Primitive_i[iDim+1] + Primitive_j[iDim+1] )/2.0 \
-                  + z * ( Primitive_j[iDim+1] - Primitive_i[iDim+1] )/2.0;
+            velocity2_i = 0.0;
+            velocity2_j = 0.0;
+            
+            for (iDim = 0; iDim < nDim; iDim++) {
+              velocity2_i += Primitive_i[iDim+1]*Primitive_i[iDim+1];
+              velocity2_j += Primitive_j[iDim+1]*Primitive_j[iDim+1];
+            }
+            mach_i = sqrt(velocity2_i)/Primitive_i[nDim+4];
+            mach_j = sqrt(velocity2_j)/Primitive_j[nDim+4];
 
-          velocity2_j += vel_j_corr[iDim]*vel_j_corr[iDim];
-          velocity2_i += vel_i_corr[iDim]*vel_i_corr[iDim];
+            z = min(max(mach_i,mach_j),1.0);
+            velocity2_i = 0.0;
+            velocity2_j = 0.0;
+            for (iDim = 0; iDim < nDim; iDim++) {
+              vel_i_corr[iDim] = ( Primitive_i[iDim+1] + Primitive_j[iDim+1] )/2.0 \
+                      + z * ( Primitive_i[iDim+1] - Primitive_j[iDim+1] )/2.0;
+              vel_j_corr[iDim] = ( Primitive_i[iDim+1] + Primitive_j[iDim+1] )/2.0 \
+                      + z * ( Primitive_j[iDim+1] - Primitive_i[iDim+1] )/2.0;
 
-          Primitive_i[iDim+1] = vel_i_corr[iDim];
-          Primitive_j[iDim+1] = vel_j_corr[iDim];
-        }
+              velocity2_j += vel_j_corr[iDim]*vel_j_corr[iDim];
+              velocity2_i += vel_i_corr[iDim]*vel_i_corr[iDim];
+
+              Primitive_i[iDim+1] = vel_i_corr[iDim];
+              Primitive_j[iDim+1] = vel_j_corr[iDim];
+            }
 
-        FluidModel->SetEnergy_Prho(Primitive_i[nDim+1],Primitive_i[nDim+2]);
-        Primitive_i[nDim+3]= FluidModel->GetStaticEnergy() + Primitive_i[nDim+1]/Primitive_i[nDim+2] + 0.5*velocity2_i;
+            FluidModel->SetEnergy_Prho(Primitive_i[nDim+1],Primitive_i[nDim+2]);
+            Primitive_i[nDim+3]= FluidModel->GetStaticEnergy() + Primitive_i[nDim+1]/Primitive_i[nDim+2] + 0.5*velocity2_i;
+            
+            FluidModel->SetEnergy_Prho(Primitive_j[nDim+1],Primitive_j[nDim+2]);
+            Primitive_j[nDim+3]= FluidModel->GetStaticEnergy() + Primitive_j[nDim+1]/Primitive_j[nDim+2] + 0.5*velocity2_j;
+            
+          }
+          
+          /*--- Check for non-physical solutions after reconstruction. If found,
+           use the cell-average value of the solution. This results in a locally
+           first-order approximation, but this is typically only active
+           during the start-up of a calculation. If non-physical, use the 
+           cell-averaged state. ---*/
+          
+          neg_pressure_i = (Primitive_i[nDim+1] < 0.0); neg_pressure_j = (Primitive_j[nDim+1] < 0.0);
+          neg_density_i  = (Primitive_i[nDim+2] < 0.0); neg_density_j  = (Primitive_j[nDim+2] < 0.0);
+
+          R = sqrt(fabs(Primitive_j[nDim+2]/Primitive_i[nDim+2]));
+          sq_vel = 0.0;
+          for (iDim = 0; iDim < nDim; iDim++) {
+            RoeVelocity[iDim] = (R*Primitive_j[iDim+1]+Primitive_i[iDim+1])/(R+1);
+            sq_vel += RoeVelocity[iDim]*RoeVelocity[iDim];
+          }
+          RoeEnthalpy = (R*Primitive_j[nDim+3]+Primitive_i[nDim+3])/(R+1);
+          neg_sound_speed = ((Gamma-1)*(RoeEnthalpy-0.5*sq_vel) < 0.0);
+          
+          if (neg_sound_speed) {
+            for (iVar = 0; iVar < nPrimVar; iVar++) {
+              Primitive_i[iVar] = V_i[iVar];
+              Primitive_j[iVar] = V_j[iVar]; }
+            Secondary_i[0] = S_i[0]; Secondary_i[1] = S_i[1];
+            Secondary_j[0] = S_i[0]; Secondary_j[1] = S_i[1];
+            counter_local++;
+          }
+          
+          if (neg_density_i || neg_pressure_i) {
+            for (iVar = 0; iVar < nPrimVar; iVar++) Primitive_i[iVar] = V_i[iVar];
+            Secondary_i[0] = S_i[0]; Secondary_i[1] = S_i[1];
+            counter_local++;
+          }
+          
+          if (neg_density_j || neg_pressure_j) {
+            for (iVar = 0; iVar < nPrimVar; iVar++) Primitive_j[iVar] = V_j[iVar];
+            Secondary_j[0] = S_j[0]; Secondary_j[1] = S_j[1];
+            counter_local++;
+          }
+
+          edge_numerics->SetPrimitive(Primitive_i, Primitive_j);
+          edge_numerics->SetSecondary(Secondary_i, Secondary_j);
+          
+        }
+        else {
+          
+          /*--- Set conservative variables without reconstruction ---*/
+          
+          edge_numerics->SetPrimitive(V_i, V_j);
+          edge_numerics->SetSecondary(S_i, S_j);
+          
+        }
         
-        FluidModel->SetEnergy_Prho(Primitive_j[nDim+1],Primitive_j[nDim+2]);
-        Primitive_j[nDim+3]= FluidModel->GetStaticEnergy() + Primitive_j[nDim+1]/Primitive_j[nDim+2] + 0.5*velocity2_j;
+        /*--- Batched evaluation, the fluxes are added when the batch is full. ---*/
         
-      }
-      
-      /*--- Check for non-physical solutions after reconstruction. If found,
-       use the cell-average value of the solution. This results in a locally
-       first-order approximation, but this is typically only active
-       during the start-up of a calculation. If non-physical, use the 
-       cell-averaged state. ---*/
-      
-      neg_pressure_i = (Primitive_i[nDim+1] < 0.0); neg_pressure_j = (Primitive_j[nDim+1] < 0.0);
-      neg_density_i  = (Primitive_i[nDim+2] < 0.0); neg_density_j  = (Primitive_j[nDim+2] < 0.0);
+        if (batch != NULL) {
+          if (muscl) batch->SetEdge(iPoint, jPoint, geometry->GetEdgeNormal(iEdge), Primitive_i, Primitive_j);
+          else batch->SetEdge(iPoint, jPoint, geometry->GetEdgeNormal(iEdge), V_i, V_j);
+          if (batch->IsFull()) Flush_ConvBatch(batch, &work, implicit);
+          continue;
+        }
+        
+        /*--- Roe Low Dissipation Scheme ---*/
+        
+        if (kind_dissipation != NO_ROELOWDISS){
+          
+          Dissipation_i = node[iPoint]->GetRoe_Dissipation();
+          Dissipation_j = node[jPoint]->GetRoe_Dissipation();
+          edge_numerics->SetDissipation(Dissipation_i, Dissipation_j);
+                
+          if (kind_dissipation == FD_DUCROS || kind_dissipation == NTS_DUCROS){
+            Sensor_i = node[iPoint]->GetSensor();
+            Sensor_j = node[jPoint]->GetSensor();
+            edge_numerics->SetSensor(Sensor_i, Sensor_j);
+          }
+          if (kind_dissipation == NTS || kind_dissipation == NTS_DUCROS){
+            Coord_i = geometry->node[iPoint]->GetCoord();
+            Coord_j = geometry->node[jPoint]->GetCoord();
+            edge_numerics->SetCoord(Coord_i, Coord_j);
+          }
+        }
+          
+        /*--- Compute the residual ---*/
+        
+        edge_numerics->ComputeResidual(work.Residual, work.Jacobian_i, work.Jacobian_j, config);
 
-      R = sqrt(fabs(Primitive_j[nDim+2]/Primitive_i[nDim+2]));
-      sq_vel = 0.0;
-      for (iDim = 0; iDim < nDim; iDim++) {
-        RoeVelocity[iDim] = (R*Primitive_j[iDim+1]+Primitive_i[iDim+1])/(R+1);
-        sq_vel += RoeVelocity[iDim]*RoeVelocity[iDim];
-      }
-      RoeEnthalpy = (R*Primitive_j[nDim+3]+Primitive_i[nDim+3])/(R+1);
-      neg_sound_speed = ((Gamma-1)*(RoeEnthalpy-0.5*sq_vel) < 0.0);
-      
-      if (neg_sound_speed) {
-        for (iVar = 0; iVar < nPrimVar; iVar++) {
-          Primitive_i[iVar] = V_i[iVar];
-          Primitive_j[iVar] = V_j[iVar]; }
-        Secondary_i[0] = S_i[0]; Secondary_i[1] = S_i[1];
-        Secondary_j[0] = S_i[0]; Secondary_j[1] = S_i[1];
-        counter_local++;
-      }
-      
-      if (neg_density_i || neg_pressure_i) {
-        for (iVar = 0; iVar < nPrimVar; iVar++) Primitive_i[iVar] = V_i[iVar];
-        Secondary_i[0] = S_i[0]; Secondary_i[1] = S_i[1];
-        counter_local++;
-      }
-      
-      if (neg_density_j || neg_pressure_j) {
-        for (iVar = 0; iVar < nPrimVar; iVar++) Primitive_j[iVar] = V_j[iVar];
-        Secondary_j[0] = S_j[0]; Secondary_j[1] = S_j[1];
-        counter_local++;
+        /*--- Update residual value ---*/
+        
+        LinSysRes.AddBlock(iPoint, work.Residual);
+        LinSysRes.SubtractBlock(jPoint, work.Residual);
+        
+        /*--- Set implicit Jacobians ---*/
+        
+        if (implicit) {
+          Jacobian.AddBlock(iPoint, iPoint, work.Jacobian_i);
+          Jacobian.AddBlock(iPoint, jPoint, work.Jacobian_j);
+          Jacobian.SubtractBlock(jPoint, iPoint, work.Jacobian_i);
+          Jacobian.SubtractBlock(jPoint, jPoint, work.Jacobian_j);
+        }
+        
+        /*--- Roe Turkel preconditioning, set the value of beta ---*/
+        
+        if (roe_turkel) {
+          node[iPoint]->SetPreconditioner_Beta(edge_numerics->GetPrecond_Beta());
+          node[jPoint]->SetPreconditioner_Beta(edge_numerics->GetPrecond_Beta());
+        }
+        
+        /*--- Set the final value of the Roe dissipation coefficient ---*/
+        
+        if (kind_dissipation != NO_ROELOWDISS){
+          node[iPoint]->SetRoe_Dissipation(edge_numerics->GetDissipation());
+          node[jPoint]->SetRoe_Dissipation(edge_numerics->GetDissipation());      
+        }
+        
       }
 
-      numerics->SetPrimitive(Primitive_i, Primitive_j);
-      numerics->SetSecondary(Secondary_i, Secondary_j);
-      
-    }
-    else {
-      
-      /*--- Set conservative variables without reconstruction ---*/
-      
-      numerics->SetPrimitive(V_i, V_j);
-      numerics->SetSecondary(S_i, S_j);
-      
-    }
-    
-    /*--- Roe Low Dissipation Scheme ---*/
-    
-    if (kind_dissipation != NO_ROELOWDISS){
-      
-      Dissipation_i = node[iPoint]->GetRoe_Dissipation();
-      Dissipation_j = node[jPoint]->GetRoe_Dissipation();
-      numerics->SetDissipation(Dissipation_i, Dissipation_j);
-            
-      if (kind_dissipation == FD_DUCROS || kind_dissipation == NTS_DUCROS){
-        Sensor_i = node[iPoint]->GetSensor();
-        Sensor_j = node[jPoint]->GetSensor();
-        numerics->SetSensor(Sensor_i, Sensor_j);
-      }
-      if (kind_dissipation == NTS || kind_dissipation == NTS_DUCROS){
-        Coord_i = geometry->node[iPoint]->GetCoord();
-        Coord_j = geometry->node[jPoint]->GetCoord();
-        numerics->SetCoord(Coord_i, Coord_j);
-      }
-    }
-      
-    /*--- Compute the residual ---*/
-    
-    numerics->ComputeResidual(Res_Conv, Jacobian_i, Jacobian_j, config);
+      /*--- The edges left in the batch belong to this color, they are added
+       before any thread moves on to the next color. ---*/
 
-    /*--- Update residual value ---*/
-    
-    LinSysRes.AddBlock(iPoint, Res_Conv);
-    LinSysRes.SubtractBlock(jPoint, Res_Conv);
-    
-    /*--- Set implicit Jacobians ---*/
-    
-    if (implicit) {
-      Jacobian.AddBlock(iPoint, iPoint, Jacobian_i);
-      Jacobian.AddBlock(iPoint, jPoint, Jacobian_j);
-      Jacobian.SubtractBlock(jPoint, iPoint, Jacobian_i);
-      Jacobian.SubtractBlock(jPoint, jPoint, Jacobian_j);
+      if (batch != NULL) Flush_ConvBatch(batch, &work, implicit);
+      SU2_OMP_BARRIER
     }
-    
-    /*--- Roe Turkel preconditioning, set the value of beta ---*/
-    
-    if (roe_turkel) {
-      node[iPoint]->SetPreconditioner_Beta(numerics->GetPrecond_Beta());
-      node[jPoint]->SetPreconditioner_Beta(numerics->GetPrecond_Beta());
-    }
-    
-    /*--- Set the final value of the Roe dissipation coefficient ---*/
-    
-    if (kind_dissipation != NO_ROELOWDISS){
-      node[iPoint]->SetRoe_Dissipation(numerics->GetDissipation());
-      node[jPoint]->SetRoe_Dissipation(numerics->GetDissipation());      
-    }
-    
   }
 
   /*--- Warning message about non-physical reconstructions ---*/
@@ -3598,9 +3749,11 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
   }
 }
 
-void CEulerSolver::ComputeConsExtrapolation(CConfig *config) {
+void CEulerSolver::ComputeConsExtrapolation(CEdgeLoopWork *work, CConfig *config) {
   
   unsigned short iDim;
+  su2double *Primitive_i = work->Primitive_i, *Primitive_j = work->Primitive_j;
+  su2double *Secondary_i = work->Secondary_i, *Secondary_j = work->Secondary_j;
   
   su2double density_i = Primitive_i[nDim+2];
   su2double pressure_i = Primitive_i[nDim+1];
@@ -3640,7 +3793,7 @@ void CEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
   
   unsigned short iVar;
   unsigned long iPoint;
-  bool implicit         = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit         = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !ResidualOnly;
   bool rotating_frame   = config->GetRotating_Frame();
   bool axisymmetric     = config->GetAxisymmetric();
   bool gravity          = (config->GetGravityForce() == YES);
@@ -3964,52 +4117,61 @@ void CEulerSolver::SetMax_Eigenvalue(CGeometry *geometry, CConfig *config) {
 
 void CEulerSolver::SetUndivided_Laplacian(CGeometry *geometry, CConfig *config) {
   
-  unsigned long iPoint, jPoint, iEdge;
-  su2double Pressure_i = 0, Pressure_j = 0, *Diff;
-  unsigned short iVar;
-  bool boundary_i, boundary_j;
+  unsigned long iPoint;
     
-  Diff = new su2double[nVar];
-  
+  SU2_OMP(parallel for schedule(static))
   for (iPoint = 0; iPoint < nPointDomain; iPoint++)
     node[iPoint]->SetUnd_LaplZero();
   
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-    
-    iPoint = geometry->edge[iEdge]->GetNode(0);
-    jPoint = geometry->edge[iEdge]->GetNode(1);
-    
-    /*--- Solution differences ---*/
-    
-    for (iVar = 0; iVar < nVar; iVar++)
-      Diff[iVar] = node[iPoint]->GetSolution(iVar) - node[jPoint]->GetSolution(iVar);
-    
-    /*--- Correction for compressible flows which use the enthalpy ---*/
-    
-    Pressure_i = node[iPoint]->GetPressure();
-    Pressure_j = node[jPoint]->GetPressure();
-    Diff[nVar-1] = (node[iPoint]->GetSolution(nVar-1) + Pressure_i) - (node[jPoint]->GetSolution(nVar-1) + Pressure_j);
-    
-    boundary_i = geometry->node[iPoint]->GetPhysicalBoundary();
-    boundary_j = geometry->node[jPoint]->GetPhysicalBoundary();
-    
-    /*--- Both points inside the domain, or both in the boundary ---*/
-    
-    if ((!boundary_i && !boundary_j) || (boundary_i && boundary_j)) {
-      if (geometry->node[iPoint]->GetDomain()) node[iPoint]->SubtractUnd_Lapl(Diff);
-      if (geometry->node[jPoint]->GetDomain()) node[jPoint]->AddUnd_Lapl(Diff);
+  /*--- Loop over the edges by color, each thread has its own work array. ---*/
+
+  SU2_OMP_PARALLEL
+  {
+    su2double *Diff = new su2double[nVar];
+
+    for (unsigned long iColor = 0; iColor < geometry->GetnEdgeColor(); iColor++) {
+
+      SU2_OMP(for schedule(static, geometry->GetEdgeColorGroupSize()))
+      for (unsigned long iEdge = geometry->GetEdgeColorBegin(iColor); iEdge < geometry->GetEdgeColorEnd(iColor); iEdge++) {
+
+        unsigned long iPoint = geometry->GetEdgeNodes(iEdge)[0];
+        unsigned long jPoint = geometry->GetEdgeNodes(iEdge)[1];
+
+        /*--- Solution differences ---*/
+
+        for (unsigned short iVar = 0; iVar < nVar; iVar++)
+          Diff[iVar] = node[iPoint]->GetSolution(iVar) - node[jPoint]->GetSolution(iVar);
+
+        /*--- Correction for compressible flows which use the enthalpy ---*/
+
+        su2double Pressure_i = node[iPoint]->GetPressure();
+        su2double Pressure_j = node[jPoint]->GetPressure();
+        Diff[nVar-1] = (node[iPoint]->GetSolution(nVar-1) + Pressure_i) - (node[jPoint]->GetSolution(nVar-1) + Pressure_j);
+
+        bool boundary_i = geometry->node[iPoint]->GetPhysicalBoundary();
+        bool boundary_j = geometry->node[jPoint]->GetPhysicalBoundary();
+
+        /*--- Both points inside the domain, or both in the boundary ---*/
+
+        if ((!boundary_i && !boundary_j) || (boundary_i && boundary_j)) {
+          if (geometry->node[iPoint]->GetDomain()) node[iPoint]->SubtractUnd_Lapl(Diff);
+          if (geometry->node[jPoint]->GetDomain()) node[jPoint]->AddUnd_Lapl(Diff);
+        }
+
+        /*--- iPoint inside the domain, jPoint on the boundary ---*/
+
+        if (!boundary_i && boundary_j)
+          if (geometry->node[iPoint]->GetDomain()) node[iPoint]->SubtractUnd_Lapl(Diff);
+
+        /*--- jPoint inside the domain, iPoint on the boundary ---*/
+
+        if (boundary_i && !boundary_j)
+          if (geometry->node[jPoint]->GetDomain()) node[jPoint]->AddUnd_Lapl(Diff);
+
+      }
     }
-    
-    /*--- iPoint inside the domain, jPoint on the boundary ---*/
-    
-    if (!boundary_i && boundary_j)
-      if (geometry->node[iPoint]->GetDomain()) node[iPoint]->SubtractUnd_Lapl(Diff);
-    
-    /*--- jPoint inside the domain, iPoint on the boundary ---*/
-    
-    if (boundary_i && !boundary_j)
-      if (geometry->node[jPoint]->GetDomain()) node[jPoint]->AddUnd_Lapl(Diff);
-    
+
+    delete [] Diff;
   }
   
   /*--- Correct the Laplacian values across any periodic boundaries. ---*/
@@ -4024,8 +4186,6 @@ void CEulerSolver::SetUndivided_Laplacian(CGeometry *geometry, CConfig *config)
   InitiateComms(geometry, config, UNDIVIDED_LAPLACIAN);
   CompleteComms(geometry, config, UNDIVIDED_LAPLACIAN);
   
-  delete [] Diff;
-  
 }
 
 void CEulerSolver::SetCentered_Dissipation_Sensor(CGeometry *geometry, CConfig *config) {
@@ -5136,19 +5296,19 @@ void CEulerSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver
     Vol = (geometry->node[iPoint]->GetVolume() +
            geometry->node[iPoint]->GetPeriodicVolume());
     
-    /*--- Modify matrix diagonal to assure diagonal dominance ---*/
-    
+    /*--- Modify matrix diagonal to assure diagonal dominance, unless the matrix
+     of a previous iteration is kept (it already has its diagonal term). ---*/
     
     if (node[iPoint]->GetDelta_Time() != 0.0) {
       Delta = Vol / node[iPoint]->GetDelta_Time();
-      if (roe_turkel || low_mach_prec) {
+      if (!ResidualOnly && (roe_turkel || low_mach_prec)) {
         SetPreconditioner(config, iPoint);
         for (iVar = 0; iVar < nVar; iVar ++ )
           for (jVar = 0; jVar < nVar; jVar ++ )
             LowMach_Precontioner[iVar][jVar] = Delta*LowMach_Precontioner[iVar][jVar];
         Jacobian.AddBlock(iPoint, iPoint, LowMach_Precontioner);
       }
-      else {
+      else if (!ResidualOnly) {
         Jacobian.AddVal2Diag(iPoint, Delta);
       }
     }
@@ -5182,9 +5342,10 @@ void CEulerSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver
     }
   }
   
-  /*--- Solve or smooth the linear system ---*/
+  /*--- Solve or smooth the linear system, in the Newton-Krylov mode the
+   assembled Jacobian is only the preconditioner of the matrix-free product. ---*/
   
-  IterLinSol = System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
+  IterLinSol = System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config, JacobianFree_Product);
   
   /*--- The the number of iterations of the linear solver ---*/
   
@@ -5221,42 +5382,44 @@ void CEulerSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver
 }
 
 void CEulerSolver::SetPrimitive_Gradient_GG(CGeometry *geometry, CConfig *config) {
-  unsigned long iPoint, jPoint, iEdge, iVertex;
+  unsigned long iPoint, iVertex;
   unsigned short iDim, iVar, iMarker;
-  su2double *PrimVar_Vertex, *PrimVar_i, *PrimVar_j, PrimVar_Average,
-  Partial_Gradient, Partial_Res, *Normal, Vol;
+  su2double *PrimVar_Vertex, Partial_Gradient, Partial_Res, *Normal, Vol;
   
   /*--- Gradient primitive variables compressible (temp, vx, vy, vz, P, rho) ---*/
 
   PrimVar_Vertex = new su2double [nPrimVarGrad];
-  PrimVar_i = new su2double [nPrimVarGrad];
-  PrimVar_j = new su2double [nPrimVarGrad];
   
   /*--- Set Gradient_Primitive to zero ---*/
   
+  SU2_OMP(parallel for schedule(static))
   for (iPoint = 0; iPoint < nPointDomain; iPoint++)
     node[iPoint]->SetGradient_PrimitiveZero(nPrimVarGrad);
 
-  /*--- Loop interior edges ---*/
-  
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-    iPoint = geometry->edge[iEdge]->GetNode(0);
-    jPoint = geometry->edge[iEdge]->GetNode(1);
-    
-    for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
-      PrimVar_i[iVar] = node[iPoint]->GetPrimitive(iVar);
-      PrimVar_j[iVar] = node[jPoint]->GetPrimitive(iVar);
-    }
-    
-    Normal = geometry->edge[iEdge]->GetNormal();
-    for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
-      PrimVar_Average =  0.5 * ( PrimVar_i[iVar] + PrimVar_j[iVar] );
-      for (iDim = 0; iDim < nDim; iDim++) {
-        Partial_Res = PrimVar_Average*Normal[iDim];
-        if (geometry->node[iPoint]->GetDomain())
-          node[iPoint]->AddGradient_Primitive(iVar, iDim, Partial_Res);
-        if (geometry->node[jPoint]->GetDomain())
-          node[jPoint]->SubtractGradient_Primitive(iVar, iDim, Partial_Res);
+  /*--- Loop interior edges by color, the groups of edges of one color
+   do not share points and are split among the threads. ---*/
+
+  SU2_OMP_PARALLEL
+  {
+    for (unsigned long iColor = 0; iColor < geometry->GetnEdgeColor(); iColor++) {
+
+      SU2_OMP(for schedule(static, geometry->GetEdgeColorGroupSize()))
+      for (unsigned long iEdge = geometry->GetEdgeColorBegin(iColor); iEdge < geometry->GetEdgeColorEnd(iColor); iEdge++) {
+
+        unsigned long iPoint = geometry->GetEdgeNodes(iEdge)[0];
+        unsigned long jPoint = geometry->GetEdgeNodes(iEdge)[1];
+        bool domain_i = geometry->node[iPoint]->GetDomain();
+        bool domain_j = geometry->node[jPoint]->GetDomain();
+        su2double *Normal = geometry->GetEdgeNormal(iEdge);
+
+        for (unsigned short iVar = 0; iVar < nPrimVarGrad; iVar++) {
+          su2double PrimVar_Average = 0.5 * ( node[iPoint]->GetPrimitive(iVar) + node[jPoint]->GetPrimitive(iVar) );
+          for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+            su2double Partial_Res = PrimVar_Average*Normal[iDim];
+            if (domain_i) node[iPoint]->AddGradient_Primitive(iVar, iDim, Partial_Res);
+            if (domain_j) node[jPoint]->SubtractGradient_Primitive(iVar, iDim, Partial_Res);
+          }
+        }
       }
     }
   }
@@ -5293,6 +5456,7 @@ void CEulerSolver::SetPrimitive_Gradient_GG(CGeometry *geometry, CConfig *config
   
   /*--- Update gradient value ---*/
   
+  SU2_OMP(parallel for schedule(static) private(Vol, iVar, iDim, Partial_Gradient))
   for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
     
     /*--- Get the volume, which may include periodic components. ---*/
@@ -5310,8 +5474,6 @@ void CEulerSolver::SetPrimitive_Gradient_GG(CGeometry *geometry, CConfig *config
   }
 
   delete [] PrimVar_Vertex;
-  delete [] PrimVar_i;
-  delete [] PrimVar_j;
 
   /*--- Communicate the gradient values via MPI. ---*/
 
@@ -5499,11 +5661,10 @@ void CEulerSolver::SetPrimitive_Limiter(CGeometry *geometry, CConfig *config) {
   
   unsigned long iEdge, iPoint, jPoint;
   unsigned short iVar, iDim;
-  su2double **Gradient_i, **Gradient_j, *Coord_i, *Coord_j,
-  *Primitive, *Primitive_i, *Primitive_j,
+  su2double **Gradient_i, **Gradient_j, *Coord_i, *Coord_j, *Primitive,
   *LocalMinPrimitive = NULL, *LocalMaxPrimitive = NULL,
   *GlobalMinPrimitive = NULL, *GlobalMaxPrimitive = NULL,
-  dave, LimK, eps2, eps1, dm, dp, du, y, limiter;
+  dave, LimK, eps2, eps1, dm, dp, y, limiter;
 
 #ifdef CODI_REVERSE_TYPE
   bool TapeActive = false;
@@ -5532,6 +5693,7 @@ void CEulerSolver::SetPrimitive_Limiter(CGeometry *geometry, CConfig *config) {
     
     /*--- Initialize solution max and solution min and the limiter in the entire domain --*/
     
+    SU2_OMP(parallel for schedule(static) private(iVar))
     for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
       for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
         node[iPoint]->SetSolution_Max(iVar, -EPS);
@@ -5540,30 +5702,37 @@ void CEulerSolver::SetPrimitive_Limiter(CGeometry *geometry, CConfig *config) {
       }
     }
     
-    /*--- Establish bounds for Spekreijse monotonicity by finding max & min values of neighbor variables --*/
-    
-    for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-      
-      /*--- Point identification, Normal vector and area ---*/
-      
-      iPoint = geometry->edge[iEdge]->GetNode(0);
-      jPoint = geometry->edge[iEdge]->GetNode(1);
-      
-      /*--- Get the primitive variables ---*/
-      
-      Primitive_i = node[iPoint]->GetPrimitive();
-      Primitive_j = node[jPoint]->GetPrimitive();
-      
-      /*--- Compute the maximum, and minimum values for nodes i & j ---*/
-      
-      for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
-        du = (Primitive_j[iVar] - Primitive_i[iVar]);
-        node[iPoint]->SetSolution_Min(iVar, min(node[iPoint]->GetSolution_Min(iVar), du));
-        node[iPoint]->SetSolution_Max(iVar, max(node[iPoint]->GetSolution_Max(iVar), du));
-        node[jPoint]->SetSolution_Min(iVar, min(node[jPoint]->GetSolution_Min(iVar), -du));
-        node[jPoint]->SetSolution_Max(iVar, max(node[jPoint]->GetSolution_Max(iVar), -du));
+    /*--- Establish bounds for Spekreijse monotonicity by finding max & min values of neighbor variables,
+     the edges are processed by color so that the threads update different points. --*/
+
+    SU2_OMP_PARALLEL
+    {
+      for (unsigned long iColor = 0; iColor < geometry->GetnEdgeColor(); iColor++) {
+
+        SU2_OMP(for schedule(static, geometry->GetEdgeColorGroupSize()))
+        for (unsigned long iEdge = geometry->GetEdgeColorBegin(iColor); iEdge < geometry->GetEdgeColorEnd(iColor); iEdge++) {
+
+          /*--- Point identification, Normal vector and area ---*/
+
+          unsigned long iPoint = geometry->GetEdgeNodes(iEdge)[0];
+          unsigned long jPoint = geometry->GetEdgeNodes(iEdge)[1];
+
+          /*--- Get the primitive variables ---*/
+
+          su2double *Primitive_i = node[iPoint]->GetPrimitive();
+          su2double *Primitive_j = node[jPoint]->GetPrimitive();
+
+          /*--- Compute the maximum, and minimum values for nodes i & j ---*/
+
+          for (unsigned short iVar = 0; iVar < nPrimVarGrad; iVar++) {
+            su2double du = (Primitive_j[iVar] - Primitive_i[iVar]);
+            node[iPoint]->SetSolution_Min(iVar, min(node[iPoint]->GetSolution_Min(iVar), du));
+            node[iPoint]->SetSolution_Max(iVar, max(node[iPoint]->GetSolution_Max(iVar), du));
+            node[jPoint]->SetSolution_Min(iVar, min(node[jPoint]->GetSolution_Min(iVar), -du));
+            node[jPoint]->SetSolution_Max(iVar, max(node[jPoint]->GetSolution_Max(iVar), -du));
+          }
+        }
       }
-      
     }
     
     /*--- Correct the limiter values across any periodic boundaries. ---*/
@@ -7948,7 +8117,7 @@ void CEulerSolver::BC_Euler_Wall(CGeometry *geometry, CSolver **solver_container
   su2double Density_i, *Velocity_i, ProjVelocity_i = 0.0, Energy_i, VelMagnitude2_i;
   su2double **Jacobian_b, **DubDu;
   
-  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !ResidualOnly;
   bool grid_movement = config->GetGrid_Movement();
   bool tkeNeeded = (((config->GetKind_Solver() == RANS )|| (config->GetKind_Solver() == DISC_ADJ_RANS) || (config->GetKind_Solver() == ONE_SHOT_RANS)) &&
                     (config->GetKind_Turb_Model() == SST));
@@ -8135,7 +8304,7 @@ void CEulerSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_container,
   
   su2double Gas_Constant     = config->GetGas_ConstantND();
   
-  bool implicit       = config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT;
+  bool implicit       = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !ResidualOnly;
   bool grid_movement  = config->GetGrid_Movement();
   bool viscous        = config->GetViscous();
   bool tkeNeeded = (((config->GetKind_Solver() == RANS ) ||
@@ -8397,7 +8566,7 @@ void CEulerSolver::BC_Riemann(CGeometry *geometry, CSolver **solver_container,
   su2double *gridVel;
   su2double *V_boundary, *V_domain, *S_boundary, *S_domain;
   
-  bool implicit             = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit             = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !ResidualOnly;
   bool grid_movement        = config->GetGrid_Movement();
   string Marker_Tag         = config->GetMarker_All_TagBound(val_marker);
   bool viscous              = config->GetViscous();
@@ -8907,7 +9076,7 @@ void CEulerSolver::BC_TurboRiemann(CGeometry *geometry, CSolver **solver_contain
   su2double *V_boundary, *V_domain, *S_boundary, *S_domain;
   su2double AverageEnthalpy, AverageEntropy;
   unsigned short  iZone     = config->GetiZone();
-  bool implicit             = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit             = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !ResidualOnly;
   bool grid_movement        = config->GetGrid_Movement();
   string Marker_Tag         = config->GetMarker_All_TagBound(val_marker);
   unsigned short nSpanWiseSections = geometry->GetnSpanWiseSections(config->GetMarker_All_TurbomachineryFlag(val_marker));
@@ -9569,7 +9738,7 @@ void CEulerSolver::BC_Giles(CGeometry *geometry, CSolver **solver_container,
   su2double Pressure_e;
   su2double *V_boundary, *V_domain, *S_boundary, *S_domain;
   unsigned short  iZone     = config->GetiZone();
-  bool implicit             = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit             = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !ResidualOnly;
   bool grid_movement        = config->GetGrid_Movement();
   string Marker_Tag         = config->GetMarker_All_TagBound(val_marker);
   bool viscous              = config->GetViscous();
@@ -10310,7 +10479,7 @@ void CEulerSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container,
   alpha, aa, bb, cc, dd, Area, UnitNormal[3];
   su2double *V_inlet, *V_domain;
   
-  bool implicit             = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit             = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !ResidualOnly;
   bool grid_movement        = config->GetGrid_Movement();
   su2double Two_Gamma_M1       = 2.0/Gamma_Minus_One;
   su2double Gas_Constant       = config->GetGas_ConstantND();
@@ -10612,7 +10781,7 @@ void CEulerSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container,
   Area, UnitNormal[3];
   su2double *V_outlet, *V_domain;
   
-  bool implicit           = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit           = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !ResidualOnly;
   su2double Gas_Constant     = config->GetGas_ConstantND();
   bool grid_movement      = config->GetGrid_Movement();
   string Marker_Tag       = config->GetMarker_All_TagBound(val_marker);
@@ -10790,7 +10959,7 @@ void CEulerSolver::BC_Supersonic_Inlet(CGeometry *geometry, CSolver **solver_con
   su2double Density, Pressure, Temperature, Energy, *Vel, Velocity2;
   su2double Gas_Constant = config->GetGas_ConstantND();
   
-  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !ResidualOnly;
   bool grid_movement  = config->GetGrid_Movement();
   string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
   bool tkeNeeded = (((config->GetKind_Solver() == RANS )|| (config->GetKind_Solver() == DISC_ADJ_RANS) || (config->GetKind_Solver() == ONE_SHOT_RANS)) &&
@@ -10931,7 +11100,7 @@ void CEulerSolver::BC_Supersonic_Outlet(CGeometry *geometry, CSolver **solver_co
   unsigned long iVertex, iPoint;
   su2double *V_outlet, *V_domain;
   
-  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !ResidualOnly;
   bool grid_movement  = config->GetGrid_Movement();
   string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
   
@@ -11054,7 +11223,7 @@ void CEulerSolver::BC_Engine_Inflow(CGeometry *geometry, CSolver **solver_contai
   bool grid_movement  = config->GetGrid_Movement();
 
   su2double DampingFactor = config->GetDamp_Engine_Inflow();
-  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !ResidualOnly;
   unsigned short Kind_Engine_Inflow = config->GetKind_Engine_Inflow();
   su2double Gas_Constant = config->GetGas_ConstantND();
   string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
@@ -11275,7 +11444,7 @@ void CEulerSolver::BC_Engine_Exhaust(CGeometry *geometry, CSolver **solver_conta
   su2double *V_exhaust, *V_domain, Target_Exhaust_Pressure, Exhaust_Pressure_old, Exhaust_Pressure_inc;
   
   su2double Gas_Constant = config->GetGas_ConstantND();
-  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !ResidualOnly;
   bool grid_movement        = config->GetGrid_Movement();
   string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
   bool tkeNeeded = (((config->GetKind_Solver() == RANS )|| (config->GetKind_Solver() == DISC_ADJ_RANS) || (config->GetKind_Solver() == ONE_SHOT_RANS)) &&
@@ -11531,7 +11700,7 @@ void CEulerSolver::BC_Sym_Plane(CGeometry      *geometry,
   unsigned short iDim, iVar;
   unsigned long iVertex, iPoint;
   
-  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !ResidualOnly;
   
   /*--- Allocation of variables necessary for convective fluxes. ---*/
   su2double Area, ProjVelocity_i;
@@ -11779,7 +11948,7 @@ void CEulerSolver::BC_Fluid_Interface(CGeometry *geometry, CSolver **solver_cont
   unsigned long iVertex, jVertex, iPoint, Point_Normal = 0;
   unsigned short iDim, iVar, iMarker, nDonorVertex;
   
-  bool implicit      = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit      = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !ResidualOnly;
   bool grid_movement = config->GetGrid_Movement();
   bool viscous       = config->GetViscous();
   
@@ -11940,7 +12109,7 @@ void CEulerSolver::BC_Interface_Boundary(CGeometry *geometry, CSolver **solver_c
   unsigned long iVertex, iPoint, GlobalIndex_iPoint, GlobalIndex_jPoint;
   unsigned short iDim, iVar;
   
-  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !ResidualOnly;
   
   su2double *Normal = new su2double[nDim];
   su2double *PrimVar_i = new su2double[nPrimVar];
@@ -12001,7 +12170,7 @@ void CEulerSolver::BC_NearField_Boundary(CGeometry *geometry, CSolver **solver_c
   unsigned long iVertex, iPoint, GlobalIndex_iPoint, GlobalIndex_jPoint;
   unsigned short iDim, iVar;
   
-  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !ResidualOnly;
   
   su2double *Normal = new su2double[nDim];
   su2double *PrimVar_i = new su2double[nPrimVar];
@@ -12089,7 +12258,7 @@ void CEulerSolver::BC_ActDisk(CGeometry *geometry, CSolver **solver_container, C
   Mach_out, Pressure_in, Density_in, SoundSpeed_in, Velocity2_in,
   Mach_in, PressureAdj, TemperatureAdj;
   
-  bool implicit           = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit           = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !ResidualOnly;
   su2double Gas_Constant  = config->GetGas_ConstantND();
   bool grid_movement      = config->GetGrid_Movement();
   bool tkeNeeded          = (((config->GetKind_Solver() == RANS )|| (config->GetKind_Solver() == DISC_ADJ_RANS) || (config->GetKind_Solver() == ONE_SHOT_RANS)) &&
@@ -12517,7 +12686,7 @@ void CEulerSolver::BC_Custom(CGeometry      *geometry,
     unsigned short iVar;
     unsigned long iVertex, iPoint, total_index;
     
-    bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+    bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !ResidualOnly;
     
     /*--- Get the physical time. ---*/
     
@@ -12586,7 +12755,7 @@ void CEulerSolver::SetResidual_DualTime(CGeometry *geometry, CSolver **solver_co
   su2double Volume_nM1, Volume_nP1, TimeStep;
   su2double *Normal = NULL, *GridVel_i = NULL, *GridVel_j = NULL, Residual_GCL;
   
-  bool implicit       = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit       = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !ResidualOnly;
   bool grid_movement  = config->GetGrid_Movement();
   
   /*--- Store the physical time step ---*/
@@ -15011,10 +15180,39 @@ CNSSolver::CNSSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh)
     }
   }
 
-  /*--- Initialize the solution to the far-field state everywhere. ---*/
+  /*--- The edge loops need the sorted and colored edges, which are normally
+   set during the geometrical preprocessing. ---*/
+
+  if (geometry->GetnEdgeColor() == 0) geometry->SetEdgeColoring(config);
 
-  for (iPoint = 0; iPoint < nPoint; iPoint++)
+  /*--- Initialize the solution to the far-field state everywhere. The main
+   fields of each point are moved to the contiguous storage of the solver as
+   soon as the point is created. ---*/
+
+  nodeStorage = new CVariableStorage(nPoint, nDim, nVar, nPrimVar, nPrimVarGrad);
+
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
     node[iPoint] = new CNSVariable(Density_Inf, Velocity_Inf, Energy_Inf, nDim, nVar, config);
+    node[iPoint]->SetExternalStorage(nodeStorage, iPoint);
+  }
+
+  /*--- Work arrays of each thread of the edge loops. ---*/
+
+  for (int iThread = 0; iThread < omp_get_max_threads(); iThread++)
+    EdgeLoopWork.push_back(new CEdgeLoopWork(nDim, nVar, nPrimVar, nSecondaryVar));
+
+  /*--- Batched convective kernels, used by the edge loops for the plain Roe
+   and JST schemes. They are only compiled in for the passive (double) build. ---*/
+
+#if !defined CODI_REVERSE_TYPE && !defined CODI_FORWARD_TYPE
+  bool ideal_gas_model = (config->GetKind_FluidModel() == STANDARD_AIR || config->GetKind_FluidModel() == IDEAL_GAS);
+  for (int iThread = 0; iThread < omp_get_max_threads(); iThread++) {
+    if ((config->GetKind_ConvNumScheme_Flow() == SPACE_UPWIND) && (config->GetKind_Upwind_Flow() == ROE) && ideal_gas_model)
+      RoeBatch.push_back(new CUpwRoeBatch_Flow(nDim, nVar, config));
+    if ((config->GetKind_ConvNumScheme_Flow() == SPACE_CENTERED) && (config->GetKind_Centered_Flow() == JST) && (iMesh == MESH_0))
+      JSTBatch.push_back(new CCentJSTBatch_Flow(nDim, nVar, config));
+  }
+#endif
 
   /*--- Check that the initial solution is physical, report any non-physical nodes ---*/
 
@@ -15184,7 +15382,7 @@ void CNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, C
   unsigned long ExtIter     = config->GetExtIter();
   bool cont_adjoint         = config->GetContinuous_Adjoint();
   bool disc_adjoint         = config->GetDiscrete_Adjoint();
-  bool implicit             = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit             = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !ResidualOnly;
   bool center               = (config->GetKind_ConvNumScheme_Flow() == SPACE_CENTERED) || (cont_adjoint && config->GetKind_ConvNumScheme_AdjFlow() == SPACE_CENTERED);
   bool center_jst           = center && config->GetKind_Centered_Flow() == JST;
   bool limiter_flow         = (config->GetKind_SlopeLimit_Flow() != NO_LIMITER) && (ExtIter <= config->GetLimiterIter());
@@ -15563,54 +15761,64 @@ void CNSSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container, CC
 void CNSSolver::Viscous_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics,
                                  CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
   
-  unsigned long iPoint, jPoint, iEdge;
+  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !ResidualOnly;
   
-  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  /*--- Loop over the edges by color, each thread has its own numerics and work arrays. ---*/
   
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-    
-    /*--- Points, coordinates and normal vector in edge ---*/
-    
-    iPoint = geometry->edge[iEdge]->GetNode(0);
-    jPoint = geometry->edge[iEdge]->GetNode(1);
-    numerics->SetCoord(geometry->node[iPoint]->GetCoord(), geometry->node[jPoint]->GetCoord());
-    numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
-    
-    /*--- Primitive and secondary variables ---*/
-    
-    numerics->SetPrimitive(node[iPoint]->GetPrimitive(), node[jPoint]->GetPrimitive());
-    numerics->SetSecondary(node[iPoint]->GetSecondary(), node[jPoint]->GetSecondary());
-    
-    /*--- Gradient and limiters ---*/
-    
-    numerics->SetPrimVarGradient(node[iPoint]->GetGradient_Primitive(), node[jPoint]->GetGradient_Primitive());
-    
-    /*--- Turbulent kinetic energy ---*/
-    
-    if (config->GetKind_Turb_Model() == SST)
-      numerics->SetTurbKineticEnergy(solver_container[TURB_SOL]->node[iPoint]->GetSolution(0),
-                                     solver_container[TURB_SOL]->node[jPoint]->GetSolution(0));
-    
-    /*--- Wall shear stress values (wall functions) ---*/
+  SU2_OMP(parallel if(GetThreaded_EdgeLoops()))
+  {
+    CNumerics *edge_numerics = GetThreadNumerics(numerics, VISC_TERM);
+    CEdgeLoopWork &work = *EdgeLoopWork[omp_get_thread_num()];
     
-    numerics->SetTauWall(node[iPoint]->GetTauWall(), node[iPoint]->GetTauWall());
+    for (unsigned long iColor = 0; iColor < geometry->GetnEdgeColor(); iColor++) {
+      
+      SU2_OMP(for schedule(static, geometry->GetEdgeColorGroupSize()))
+      for (unsigned long iEdge = geometry->GetEdgeColorBegin(iColor); iEdge < geometry->GetEdgeColorEnd(iColor); iEdge++) {
+        
+        /*--- Points, coordinates and normal vector in edge ---*/
+        
+        unsigned long iPoint = geometry->GetEdgeNodes(iEdge)[0];
+        unsigned long jPoint = geometry->GetEdgeNodes(iEdge)[1];
+        edge_numerics->SetCoord(geometry->node[iPoint]->GetCoord(), geometry->node[jPoint]->GetCoord());
+        edge_numerics->SetNormal(geometry->GetEdgeNormal(iEdge));
+        
+        /*--- Primitive and secondary variables ---*/
+        
+        edge_numerics->SetPrimitive(node[iPoint]->GetPrimitive(), node[jPoint]->GetPrimitive());
+        edge_numerics->SetSecondary(node[iPoint]->GetSecondary(), node[jPoint]->GetSecondary());
+        
+        /*--- Gradient and limiters ---*/
+        
+        edge_numerics->SetPrimVarGradient(node[iPoint]->GetGradient_Primitive(), node[jPoint]->GetGradient_Primitive());
+        
+        /*--- Turbulent kinetic energy ---*/
+        
+        if (config->GetKind_Turb_Model() == SST)
+          edge_numerics->SetTurbKineticEnergy(solver_container[TURB_SOL]->node[iPoint]->GetSolution(0),
+                                              solver_container[TURB_SOL]->node[jPoint]->GetSolution(0));
+        
+        /*--- Wall shear stress values (wall functions) ---*/
+        
+        edge_numerics->SetTauWall(node[iPoint]->GetTauWall(), node[iPoint]->GetTauWall());
 
-    /*--- Compute and update residual ---*/
-    
-    numerics->ComputeResidual(Res_Visc, Jacobian_i, Jacobian_j, config);
-    
-    LinSysRes.SubtractBlock(iPoint, Res_Visc);
-    LinSysRes.AddBlock(jPoint, Res_Visc);
-    
-    /*--- Implicit part ---*/
-    
-    if (implicit) {
-      Jacobian.SubtractBlock(iPoint, iPoint, Jacobian_i);
-      Jacobian.SubtractBlock(iPoint, jPoint, Jacobian_j);
-      Jacobian.AddBlock(jPoint, iPoint, Jacobian_i);
-      Jacobian.AddBlock(jPoint, jPoint, Jacobian_j);
+        /*--- Compute and update residual ---*/
+        
+        edge_numerics->ComputeResidual(work.Residual, work.Jacobian_i, work.Jacobian_j, config);
+        
+        LinSysRes.SubtractBlock(iPoint, work.Residual);
+        LinSysRes.AddBlock(jPoint, work.Residual);
+        
+        /*--- Implicit part ---*/
+        
+        if (implicit) {
+          Jacobian.SubtractBlock(iPoint, iPoint, work.Jacobian_i);
+          Jacobian.SubtractBlock(iPoint, jPoint, work.Jacobian_j);
+          Jacobian.AddBlock(jPoint, iPoint, work.Jacobian_i);
+          Jacobian.AddBlock(jPoint, jPoint, work.Jacobian_j);
+        }
+        
+      }
     }
-    
   }
   
 }
@@ -16262,7 +16470,7 @@ void CNSSolver::BC_HeatFlux_Wall(CGeometry *geometry, CSolver **solver_container
   tau[3][3] = {{0.0,0.0,0.0},{0.0,0.0,0.0},{0.0,0.0,0.0}};
   su2double delta[3][3] = {{1.0, 0.0, 0.0},{0.0,1.0,0.0},{0.0,0.0,1.0}};
   
-  bool implicit       = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit       = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !ResidualOnly;
   bool grid_movement  = config->GetGrid_Movement();
   
   /*--- Identify the boundary by string name ---*/
@@ -16513,7 +16721,7 @@ void CNSSolver::BC_Isothermal_Wall(CGeometry *geometry, CSolver **solver_contain
   su2double Gas_Constant = config->GetGas_ConstantND();
   su2double Cp = (Gamma / Gamma_Minus_One) * Gas_Constant;
   
-  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !ResidualOnly;
   bool grid_movement  = config->GetGrid_Movement();
   
   /*--- Identify the boundary ---*/
@@ -16835,7 +17043,7 @@ void CNSSolver::BC_ConjugateHeat_Interface(CGeometry *geometry, CSolver **solver
   su2double Gas_Constant = config->GetGas_ConstantND();
   su2double Cp = (Gamma / Gamma_Minus_One) * Gas_Constant;
 
-  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !ResidualOnly;
   bool grid_movement  = config->GetGrid_Movement();
 
   /*--- Identify the boundary ---*/
@@ -93,165 +93,188 @@ CTurbSolver::~CTurbSolver(void) {
 
 void CTurbSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics, CConfig *config, unsigned short iMesh) {
   
-  su2double *Turb_i, *Turb_j, *Limiter_i = NULL, *Limiter_j = NULL, *V_i, *V_j, **Gradient_i, **Gradient_j, Project_Grad_i, Project_Grad_j;
-  unsigned long iEdge, iPoint, jPoint;
-  unsigned short iDim, iVar;
-  
   bool muscl         = config->GetMUSCL_Turb();
   bool limiter       = (config->GetKind_SlopeLimit_Turb() != NO_LIMITER);
   bool grid_movement = config->GetGrid_Movement();
   
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-    
-    /*--- Points in edge and normal vectors ---*/
-    
-    iPoint = geometry->edge[iEdge]->GetNode(0);
-    jPoint = geometry->edge[iEdge]->GetNode(1);
-    numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
-    
-    /*--- Primitive variables w/o reconstruction ---*/
-    
-    V_i = solver_container[FLOW_SOL]->node[iPoint]->GetPrimitive();
-    V_j = solver_container[FLOW_SOL]->node[jPoint]->GetPrimitive();
-    numerics->SetPrimitive(V_i, V_j);
-    
-    /*--- Turbulent variables w/o reconstruction ---*/
-    
-    Turb_i = node[iPoint]->GetSolution();
-    Turb_j = node[jPoint]->GetSolution();
-    numerics->SetTurbVar(Turb_i, Turb_j);
-    
-    /*--- Grid Movement ---*/
+  /*--- Loop over the edges by color, each thread has its own numerics and work arrays. ---*/
+  
+  SU2_OMP(parallel if(GetThreaded_EdgeLoops()))
+  {
+    su2double *Turb_i, *Turb_j, *Limiter_i = NULL, *Limiter_j = NULL, *V_i, *V_j, **Gradient_i, **Gradient_j, Project_Grad_i, Project_Grad_j;
+    unsigned long iPoint, jPoint;
+    unsigned short iDim, iVar;
     
-    if (grid_movement)
-      numerics->SetGridVel(geometry->node[iPoint]->GetGridVel(), geometry->node[jPoint]->GetGridVel());
+    CNumerics *edge_numerics = GetThreadNumerics(numerics, CONV_TERM);
+    CEdgeLoopWork &work = *EdgeLoopWork[omp_get_thread_num()];
     
-    if (muscl) {
-
-      for (iDim = 0; iDim < nDim; iDim++) {
-        Vector_i[iDim] = 0.5*(geometry->node[jPoint]->GetCoord(iDim) - geometry->node[iPoint]->GetCoord(iDim));
-        Vector_j[iDim] = 0.5*(geometry->node[iPoint]->GetCoord(iDim) - geometry->node[jPoint]->GetCoord(iDim));
-      }
-      
-      /*--- Mean flow primitive variables using gradient reconstruction and limiters ---*/
-      
-      Gradient_i = solver_container[FLOW_SOL]->node[iPoint]->GetGradient_Primitive();
-      Gradient_j = solver_container[FLOW_SOL]->node[jPoint]->GetGradient_Primitive();
-      if (limiter) {
-        Limiter_i = solver_container[FLOW_SOL]->node[iPoint]->GetLimiter_Primitive();
-        Limiter_j = solver_container[FLOW_SOL]->node[jPoint]->GetLimiter_Primitive();
-      }
-      
-      for (iVar = 0; iVar < solver_container[FLOW_SOL]->GetnPrimVarGrad(); iVar++) {
-        Project_Grad_i = 0.0; Project_Grad_j = 0.0;
-        for (iDim = 0; iDim < nDim; iDim++) {
-          Project_Grad_i += Vector_i[iDim]*Gradient_i[iVar][iDim];
-          Project_Grad_j += Vector_j[iDim]*Gradient_j[iVar][iDim];
-        }
-        if (limiter) {
-          FlowPrimVar_i[iVar] = V_i[iVar] + Limiter_i[iVar]*Project_Grad_i;
-          FlowPrimVar_j[iVar] = V_j[iVar] + Limiter_j[iVar]*Project_Grad_j;
-        }
-        else {
-          FlowPrimVar_i[iVar] = V_i[iVar] + Project_Grad_i;
-          FlowPrimVar_j[iVar] = V_j[iVar] + Project_Grad_j;
-        }
-      }
+    for (unsigned long iColor = 0; iColor < geometry->GetnEdgeColor(); iColor++) {
       
-      numerics->SetPrimitive(FlowPrimVar_i, FlowPrimVar_j);
-      
-      /*--- Turbulent variables using gradient reconstruction and limiters ---*/
-      
-      Gradient_i = node[iPoint]->GetGradient();
-      Gradient_j = node[jPoint]->GetGradient();
-      if (limiter) {
-        Limiter_i = node[iPoint]->GetLimiter();
-        Limiter_j = node[jPoint]->GetLimiter();
-      }
-      
-      for (iVar = 0; iVar < nVar; iVar++) {
-        Project_Grad_i = 0.0; Project_Grad_j = 0.0;
-        for (iDim = 0; iDim < nDim; iDim++) {
-          Project_Grad_i += Vector_i[iDim]*Gradient_i[iVar][iDim];
-          Project_Grad_j += Vector_j[iDim]*Gradient_j[iVar][iDim];
-        }
-        if (limiter) {
-          Solution_i[iVar] = Turb_i[iVar] + Limiter_i[iVar]*Project_Grad_i;
-          Solution_j[iVar] = Turb_j[iVar] + Limiter_j[iVar]*Project_Grad_j;
-        }
-        else {
-          Solution_i[iVar] = Turb_i[iVar] + Project_Grad_i;
-          Solution_j[iVar] = Turb_j[iVar] + Project_Grad_j;
+      SU2_OMP(for schedule(static, geometry->GetEdgeColorGroupSize()))
+      for (unsigned long iEdge = geometry->GetEdgeColorBegin(iColor); iEdge < geometry->GetEdgeColorEnd(iColor); iEdge++) {
+        
+        /*--- Points in edge and normal vectors ---*/
+        
+        iPoint = geometry->GetEdgeNodes(iEdge)[0];
+        jPoint = geometry->GetEdgeNodes(iEdge)[1];
+        edge_numerics->SetNormal(geometry->GetEdgeNormal(iEdge));
+        
+        /*--- Primitive variables w/o reconstruction ---*/
+        
+        V_i = solver_container[FLOW_SOL]->node[iPoint]->GetPrimitive();
+        V_j = solver_container[FLOW_SOL]->node[jPoint]->GetPrimitive();
+        edge_numerics->SetPrimitive(V_i, V_j);
+        
+        /*--- Turbulent variables w/o reconstruction ---*/
+        
+        Turb_i = node[iPoint]->GetSolution();
+        Turb_j = node[jPoint]->GetSolution();
+        edge_numerics->SetTurbVar(Turb_i, Turb_j);
+        
+        /*--- Grid Movement ---*/
+        
+        if (grid_movement)
+          edge_numerics->SetGridVel(geometry->node[iPoint]->GetGridVel(), geometry->node[jPoint]->GetGridVel());
+        
+        if (muscl) {
+
+          for (iDim = 0; iDim < nDim; iDim++) {
+            work.Vector_i[iDim] = 0.5*(geometry->node[jPoint]->GetCoord(iDim) - geometry->node[iPoint]->GetCoord(iDim));
+            work.Vector_j[iDim] = 0.5*(geometry->node[iPoint]->GetCoord(iDim) - geometry->node[jPoint]->GetCoord(iDim));
+          }
+          
+          /*--- Mean flow primitive variables using gradient reconstruction and limiters ---*/
+          
+          Gradient_i = solver_container[FLOW_SOL]->node[iPoint]->GetGradient_Primitive();
+          Gradient_j = solver_container[FLOW_SOL]->node[jPoint]->GetGradient_Primitive();
+          if (limiter) {
+            Limiter_i = solver_container[FLOW_SOL]->node[iPoint]->GetLimiter_Primitive();
+            Limiter_j = solver_container[FLOW_SOL]->node[jPoint]->GetLimiter_Primitive();
+          }
+          
+          for (iVar = 0; iVar < solver_container[FLOW_SOL]->GetnPrimVarGrad(); iVar++) {
+            Project_Grad_i = 0.0; Project_Grad_j = 0.0;
+            for (iDim = 0; iDim < nDim; iDim++) {
+              Project_Grad_i += work.Vector_i[iDim]*Gradient_i[iVar][iDim];
+              Project_Grad_j += work.Vector_j[iDim]*Gradient_j[iVar][iDim];
+            }
+            if (limiter) {
+              work.Primitive_i[iVar] = V_i[iVar] + Limiter_i[iVar]*Project_Grad_i;
+              work.Primitive_j[iVar] = V_j[iVar] + Limiter_j[iVar]*Project_Grad_j;
+            }
+            else {
+              work.Primitive_i[iVar] = V_i[iVar] + Project_Grad_i;
+              work.Primitive_j[iVar] = V_j[iVar] + Project_Grad_j;
+            }
+          }
+          
+          edge_numerics->SetPrimitive(work.Primitive_i, work.Primitive_j);
+          
+          /*--- Turbulent variables using gradient reconstruction and limiters ---*/
+          
+          Gradient_i = node[iPoint]->GetGradient();
+          Gradient_j = node[jPoint]->GetGradient();
+          if (limiter) {
+            Limiter_i = node[iPoint]->GetLimiter();
+            Limiter_j = node[jPoint]->GetLimiter();
+          }
+          
+          for (iVar = 0; iVar < nVar; iVar++) {
+            Project_Grad_i = 0.0; Project_Grad_j = 0.0;
+            for (iDim = 0; iDim < nDim; iDim++) {
+              Project_Grad_i += work.Vector_i[iDim]*Gradient_i[iVar][iDim];
+              Project_Grad_j += work.Vector_j[iDim]*Gradient_j[iVar][iDim];
+            }
+            if (limiter) {
+              work.Solution_i[iVar] = Turb_i[iVar] + Limiter_i[iVar]*Project_Grad_i;
+              work.Solution_j[iVar] = Turb_j[iVar] + Limiter_j[iVar]*Project_Grad_j;
+            }
+            else {
+              work.Solution_i[iVar] = Turb_i[iVar] + Project_Grad_i;
+              work.Solution_j[iVar] = Turb_j[iVar] + Project_Grad_j;
+            }
+          }
+          
+          edge_numerics->SetTurbVar(work.Solution_i, work.Solution_j);
+          
         }
+        
+        /*--- Add and subtract residual ---*/
+        
+        edge_numerics->ComputeResidual(work.Residual, work.Jacobian_i, work.Jacobian_j, config);
+        
+        LinSysRes.AddBlock(iPoint, work.Residual);
+        LinSysRes.SubtractBlock(jPoint, work.Residual);
+        
+        /*--- Implicit part ---*/
+        
+        Jacobian.AddBlock(iPoint, iPoint, work.Jacobian_i);
+        Jacobian.AddBlock(iPoint, jPoint, work.Jacobian_j);
+        Jacobian.SubtractBlock(jPoint, iPoint, work.Jacobian_i);
+        Jacobian.SubtractBlock(jPoint, jPoint, work.Jacobian_j);
+        
       }
-      
-      numerics->SetTurbVar(Solution_i, Solution_j);
-      
     }
-    
-    /*--- Add and subtract residual ---*/
-    
-    numerics->ComputeResidual(Residual, Jacobian_i, Jacobian_j, config);
-    
-    LinSysRes.AddBlock(iPoint, Residual);
-    LinSysRes.SubtractBlock(jPoint, Residual);
-    
-    /*--- Implicit part ---*/
-    
-    Jacobian.AddBlock(iPoint, iPoint, Jacobian_i);
-    Jacobian.AddBlock(iPoint, jPoint, Jacobian_j);
-    Jacobian.SubtractBlock(jPoint, iPoint, Jacobian_i);
-    Jacobian.SubtractBlock(jPoint, jPoint, Jacobian_j);
-    
   }
   
 }
 
 void CTurbSolver::Viscous_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics,
                                    CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
-  unsigned long iEdge, iPoint, jPoint;
   
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-    
-    /*--- Points in edge ---*/
-    
-    iPoint = geometry->edge[iEdge]->GetNode(0);
-    jPoint = geometry->edge[iEdge]->GetNode(1);
-    
-    /*--- Points coordinates, and normal vector ---*/
-    
-    numerics->SetCoord(geometry->node[iPoint]->GetCoord(),
-                       geometry->node[jPoint]->GetCoord());
-    numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
-    
-    /*--- Conservative variables w/o reconstruction ---*/
-    
-    numerics->SetPrimitive(solver_container[FLOW_SOL]->node[iPoint]->GetPrimitive(),
-                           solver_container[FLOW_SOL]->node[jPoint]->GetPrimitive());
-    
-    /*--- Turbulent variables w/o reconstruction, and its gradients ---*/
-    
-    numerics->SetTurbVar(node[iPoint]->GetSolution(), node[jPoint]->GetSolution());
-    numerics->SetTurbVarGradient(node[iPoint]->GetGradient(), node[jPoint]->GetGradient());
-    
-    /*--- Menter's first blending function (only SST)---*/
-    if (config->GetKind_Turb_Model() == SST)
-      numerics->SetF1blending(node[iPoint]->GetF1blending(), node[jPoint]->GetF1blending());
-    
-    /*--- Compute residual, and Jacobians ---*/
-    
-    numerics->ComputeResidual(Residual, Jacobian_i, Jacobian_j, config);
-    
-    /*--- Add and subtract residual, and update Jacobians ---*/
-    
-    LinSysRes.SubtractBlock(iPoint, Residual);
-    LinSysRes.AddBlock(jPoint, Residual);
-    
-    Jacobian.SubtractBlock(iPoint, iPoint, Jacobian_i);
-    Jacobian.SubtractBlock(iPoint, jPoint, Jacobian_j);
-    Jacobian.AddBlock(jPoint, iPoint, Jacobian_i);
-    Jacobian.AddBlock(jPoint, jPoint, Jacobian_j);
+  /*--- Loop over the edges by color, each thread has its own numerics and work arrays. ---*/
+  
+  SU2_OMP(parallel if(GetThreaded_EdgeLoops()))
+  {
+    CNumerics *edge_numerics = GetThreadNumerics(numerics, VISC_TERM);
+    CEdgeLoopWork &work = *EdgeLoopWork[omp_get_thread_num()];
     
+    for (unsigned long iColor = 0; iColor < geometry->GetnEdgeColor(); iColor++) {
+      
+      SU2_OMP(for schedule(static, geometry->GetEdgeColorGroupSize()))
+      for (unsigned long iEdge = geometry->GetEdgeColorBegin(iColor); iEdge < geometry->GetEdgeColorEnd(iColor); iEdge++) {
+        
+        /*--- Points in edge ---*/
+        
+        unsigned long iPoint = geometry->GetEdgeNodes(iEdge)[0];
+        unsigned long jPoint = geometry->GetEdgeNodes(iEdge)[1];
+        
+        /*--- Points coordinates, and normal vector ---*/
+        
+        edge_numerics->SetCoord(geometry->node[iPoint]->GetCoord(),
+                                geometry->node[jPoint]->GetCoord());
+        edge_numerics->SetNormal(geometry->GetEdgeNormal(iEdge));
+        
+        /*--- Conservative variables w/o reconstruction ---*/
+        
+        edge_numerics->SetPrimitive(solver_container[FLOW_SOL]->node[iPoint]->GetPrimitive(),
+                                    solver_container[FLOW_SOL]->node[jPoint]->GetPrimitive());
+        
+        /*--- Turbulent variables w/o reconstruction, and its gradients ---*/
+        
+        edge_numerics->SetTurbVar(node[iPoint]->GetSolution(), node[jPoint]->GetSolution());
+        edge_numerics->SetTurbVarGradient(node[iPoint]->GetGradient(), node[jPoint]->GetGradient());
+        
+        /*--- Menter's first blending function (only SST)---*/
+        if (config->GetKind_Turb_Model() == SST)
+          edge_numerics->SetF1blending(node[iPoint]->GetF1blending(), node[jPoint]->GetF1blending());
+        
+        /*--- Compute residual, and Jacobians ---*/
+        
+        edge_numerics->ComputeResidual(work.Residual, work.Jacobian_i, work.Jacobian_j, config);
+        
+        /*--- Add and subtract residual, and update Jacobians ---*/
+        
+        LinSysRes.SubtractBlock(iPoint, work.Residual);
+        LinSysRes.AddBlock(jPoint, work.Residual);
+        
+        Jacobian.SubtractBlock(iPoint, iPoint, work.Jacobian_i);
+        Jacobian.SubtractBlock(iPoint, jPoint, work.Jacobian_j);
+        Jacobian.AddBlock(jPoint, iPoint, work.Jacobian_i);
+        Jacobian.AddBlock(jPoint, jPoint, work.Jacobian_j);
+        
+      }
+    }
   }
   
 }
@@ -1059,10 +1082,22 @@ CTurbSASolver::CTurbSASolver(CGeometry *geometry, CConfig *config, unsigned shor
   fv1 = Ji_3/(Ji_3+cv1_3);
   muT_Inf = Density_Inf*fv1*nu_tilde_Inf;
 
-  /*--- Initialize the solution to the far-field state everywhere. ---*/
+  /*--- Initialize the solution to the far-field state everywhere. The main
+   fields of each point are moved to the contiguous storage of the solver as
+   soon as the point is created. ---*/
+
+  nodeStorage = new CVariableStorage(nPoint, nDim, nVar);
 
-  for (iPoint = 0; iPoint < nPoint; iPoint++)
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
     node[iPoint] = new CTurbSAVariable(nu_tilde_Inf, muT_Inf, nDim, nVar, config);
+    node[iPoint]->SetExternalStorage(nodeStorage, iPoint);
+  }
+
+  /*--- Work arrays of each thread of the edge loops, the primitive arrays
+   hold the flow variables (nDim+9) used by the upwind scheme. ---*/
+
+  for (int iThread = 0; iThread < omp_get_max_threads(); iThread++)
+    EdgeLoopWork.push_back(new CEdgeLoopWork(nDim, nVar, nDim+9, 0));
 
   /*--- MPI solution ---*/
 
@@ -3391,10 +3426,22 @@ CTurbSSTSolver::CTurbSSTSolver(CGeometry *geometry, CConfig *config, unsigned sh
   /*--- Eddy viscosity, initialized without stress limiter at the infinity ---*/
   muT_Inf = rhoInf*kine_Inf/omega_Inf;
 
-  /*--- Initialize the solution to the far-field state everywhere. ---*/
+  /*--- Initialize the solution to the far-field state everywhere. The main
+   fields of each point are moved to the contiguous storage of the solver as
+   soon as the point is created. ---*/
+
+  nodeStorage = new CVariableStorage(nPoint, nDim, nVar);
 
-  for (iPoint = 0; iPoint < nPoint; iPoint++)
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
     node[iPoint] = new CTurbSSTVariable(kine_Inf, omega_Inf, muT_Inf, nDim, nVar, constants, config);
+    node[iPoint]->SetExternalStorage(nodeStorage, iPoint);
+  }
+
+  /*--- Work arrays of each thread of the edge loops, the primitive arrays
+   hold the flow variables (nDim+9) used by the upwind scheme. ---*/
+
+  for (int iThread = 0; iThread < omp_get_max_threads(); iThread++)
+    EdgeLoopWork.push_back(new CEdgeLoopWork(nDim, nVar, nDim+9, 0));
 
   /*--- MPI solution ---*/
 
@@ -36,6 +36,7 @@
  */
 
 #include "../include/solver_structure.hpp"
+#include "../include/integration_structure.hpp"
 #include "../include/variables/CBaselineVariable.hpp"
 #include "../../Common/include/toolboxes/MMS/CIncTGVSolution.hpp"
 #include "../../Common/include/toolboxes/MMS/CInviscidVortexSolution.hpp"
@@ -51,6 +52,56 @@
 #include "../../Common/include/toolboxes/MMS/CUserDefinedSolution.hpp"
 
 
+CEdgeLoopWork::CEdgeLoopWork(unsigned short val_nDim, unsigned short val_nVar,
+                             unsigned short val_nPrimVar, unsigned short val_nSecondaryVar) {
+
+  unsigned short iVar, jVar;
+
+  nVar = val_nVar;
+
+  Vector_i    = new su2double[val_nDim];          Vector_j    = new su2double[val_nDim];
+  Primitive_i = new su2double[val_nPrimVar];      Primitive_j = new su2double[val_nPrimVar];
+  Secondary_i = new su2double[val_nSecondaryVar]; Secondary_j = new su2double[val_nSecondaryVar];
+  Solution_i  = new su2double[nVar];              Solution_j  = new su2double[nVar];
+  Residual    = new su2double[nVar];
+
+  for (iVar = 0; iVar < val_nDim; iVar++)          { Vector_i[iVar] = 0.0;    Vector_j[iVar] = 0.0; }
+  for (iVar = 0; iVar < val_nPrimVar; iVar++)      { Primitive_i[iVar] = 0.0; Primitive_j[iVar] = 0.0; }
+  for (iVar = 0; iVar < val_nSecondaryVar; iVar++) { Secondary_i[iVar] = 0.0; Secondary_j[iVar] = 0.0; }
+  for (iVar = 0; iVar < nVar; iVar++)              { Solution_i[iVar] = 0.0;  Solution_j[iVar] = 0.0; Residual[iVar] = 0.0; }
+
+  Jacobian_i = new su2double*[nVar];
+  Jacobian_j = new su2double*[nVar];
+  for (iVar = 0; iVar < nVar; iVar++) {
+    Jacobian_i[iVar] = new su2double[nVar];
+    Jacobian_j[iVar] = new su2double[nVar];
+    for (jVar = 0; jVar < nVar; jVar++) {
+      Jacobian_i[iVar][jVar] = 0.0;
+      Jacobian_j[iVar][jVar] = 0.0;
+    }
+  }
+
+}
+
+CEdgeLoopWork::~CEdgeLoopWork(void) {
+
+  unsigned short iVar;
+
+  delete [] Vector_i;    delete [] Vector_j;
+  delete [] Primitive_i; delete [] Primitive_j;
+  delete [] Secondary_i; delete [] Secondary_j;
+  delete [] Solution_i;  delete [] Solution_j;
+  delete [] Residual;
+
+  for (iVar = 0; iVar < nVar; iVar++) {
+    delete [] Jacobian_i[iVar];
+    delete [] Jacobian_j[iVar];
+  }
+  delete [] Jacobian_i;
+  delete [] Jacobian_j;
+
+}
+
 CSolver::CSolver(void) {
 
   rank = SU2_MPI::GetRank();
@@ -63,6 +114,7 @@ CSolver::CSolver(void) {
   /*--- Array initialization ---*/
   
   OutputHeadingNames = NULL;
+  JacobianFree_Product = NULL;
   Residual_RMS       = NULL;
   Residual_Max       = NULL;
   Residual_BGS       = NULL;
@@ -100,6 +152,7 @@ CSolver::CSolver(void) {
   Restart_Vars       = NULL;
   Restart_Data       = NULL;
   node               = NULL;
+  nodeStorage        = NULL;
   nOutputVariables   = 0;
 
   /*--- Inlet profile data structures. ---*/
@@ -120,6 +173,10 @@ CSolver::CSolver(void) {
   
   rotate_periodic   = false;
   implicit_periodic = false;
+
+  /*--- The Jacobian is assembled unless a matrix-free product evaluates the residual. ---*/
+
+  ResidualOnly = false;
   
 }
 
@@ -141,6 +198,14 @@ CSolver::~CSolver(void) {
     delete [] node;
   }
 
+  /*--- The storage must outlive the nodes that point into it. ---*/
+
+  if (nodeStorage != NULL) delete nodeStorage;
+
+  if (JacobianFree_Product != NULL) delete JacobianFree_Product;
+
+  for (unsigned long iThread = 0; iThread < EdgeLoopWork.size(); iThread++) delete EdgeLoopWork[iThread];
+
   /*--- Private ---*/
 
   if (Residual_RMS != NULL) delete [] Residual_RMS;
@@ -1903,6 +1968,13 @@ void CSolver::InitiateComms(CGeometry *geometry,
   
   su2double *bufDSend = geometry->bufD_P2PSend;
   
+  /*--- The solution of the solvers with a contiguous storage is received
+   in place, the halo points of each neighbor are a contiguous range of the
+   storage. The messages are then packed with nVar values per point. ---*/
+  
+  su2double *inPlace = GetInPlace_Data(geometry, commType);
+  unsigned short countPerPoint = (inPlace != NULL)? nVar : geometry->countPerPoint;
+  
   /*--- Load the specified quantity from the solver into the generic
    communication buffer in the geometry class. ---*/
   
@@ -1910,7 +1982,8 @@ void CSolver::InitiateComms(CGeometry *geometry,
     
     /*--- Post all non-blocking recvs first before sends. ---*/
     
-    geometry->PostP2PRecvs(geometry, config, MPI_TYPE, false);
+    if (inPlace != NULL) geometry->PostP2PRecvs_InPlace(inPlace, nVar);
+    else geometry->PostP2PRecvs(geometry, config, MPI_TYPE, false);
     
     for (iMessage = 0; iMessage < geometry->nP2PSend; iMessage++) {
       
@@ -1931,7 +2004,7 @@ void CSolver::InitiateComms(CGeometry *geometry,
         
         /*--- Compute the offset in the recv buffer for this point. ---*/
         
-        buf_offset = (msg_offset + iSend)*geometry->countPerPoint;
+        buf_offset = (msg_offset + iSend)*countPerPoint;
         
         switch (commType) {
           case SOLUTION:
@@ -2019,12 +2092,27 @@ void CSolver::InitiateComms(CGeometry *geometry,
       
       /*--- Launch the point-to-point MPI send for this message. ---*/
       
-      geometry->PostP2PSends(geometry, config, MPI_TYPE, iMessage, false);
+      if (inPlace != NULL) geometry->PostP2PSends_InPlace(inPlace, nVar, iMessage);
+      else geometry->PostP2PSends(geometry, config, MPI_TYPE, iMessage, false);
       
     }
   }
   
 }
+
+su2double *CSolver::GetInPlace_Data(CGeometry *geometry, unsigned short commType) {
+  
+  /*--- Only the solution is received in place, the other quantities are not
+   always stored in the contiguous blocks by every type of variable. ---*/
+  
+  if ((commType == SOLUTION) && (nodeStorage != NULL) &&
+      (nodeStorage->GetnVar() == nVar) && geometry->GetP2PRecv_InPlace())
+    return nodeStorage->GetSolution_Block();
+  
+  return NULL;
+  
+}
+
 void CSolver::CompleteComms(CGeometry *geometry,
                             CConfig *config,
                             unsigned short commType) {
@@ -2034,13 +2122,16 @@ void CSolver::CompleteComms(CGeometry *geometry,
   unsigned short iDim, iVar;
   unsigned long iPoint, iRecv, nRecv, msg_offset, buf_offset;
   
-  int ind, source, iMessage, jRecv;
-  SU2_MPI::Status status;
+  int source, iMessage, jRecv;
   
   /*--- Set some local pointers to make access simpler. ---*/
   
   su2double *bufDRecv = geometry->bufD_P2PRecv;
   
+  /*--- Data received in place does not need to be unpacked. ---*/
+  
+  bool inPlace = (GetInPlace_Data(geometry, commType) != NULL);
+  
   /*--- Store the data that was communicated into the appropriate
    location within the local class data structures. ---*/
   
@@ -2049,14 +2140,11 @@ void CSolver::CompleteComms(CGeometry *geometry,
     for (iMessage = 0; iMessage < geometry->nP2PRecv; iMessage++) {
       
       /*--- For efficiency, recv the messages dynamically based on
-       the order they arrive. ---*/
+       the order they arrive, and get the source rank. ---*/
       
-      SU2_MPI::Waitany(geometry->nP2PRecv, geometry->req_P2PRecv,
-                       &ind, &status);
-      
-      /*--- Once we have recv'd a message, get the source rank. ---*/
+      source = geometry->WaitAnyP2PRecv();
       
-      source = status.MPI_SOURCE;
+      if (inPlace) continue;
       
       /*--- We know the offsets based on the source rank. ---*/
       
@@ -2172,9 +2260,7 @@ void CSolver::CompleteComms(CGeometry *geometry,
      Note that this should be satisfied, as we have received all of the
      data in the loop above at this point. ---*/
     
-#ifdef HAVE_MPI
-    SU2_MPI::Waitall(geometry->nP2PSend, geometry->req_P2PSend, MPI_STATUS_IGNORE);
-#endif
+    geometry->WaitAllP2PSends();
     
   }
   
@@ -2183,8 +2269,17 @@ void CSolver::CompleteComms(CGeometry *geometry,
 void CSolver::SetResidual_RMS(CGeometry *geometry, CConfig *config) {
   unsigned short iVar;
   
+  /*--- With REPRODUCIBLE_REDUCTIONS the sums of squares accumulated by AddRes_RMS
+   are exact, the norms do not depend on the partition. ---*/
+  
+  bool exact = CReproducibleSum::GetActive() && (Residual_RMS_Sum.size() >= nVar);
+  
 #ifndef HAVE_MPI
   
+  if (exact) {
+    for (iVar = 0; iVar < nVar; iVar++) Residual_RMS[iVar] = Residual_RMS_Sum[iVar].GetValue();
+  }
+  
   for (iVar = 0; iVar < nVar; iVar++) {
     
     if (GetRes_RMS(iVar) != GetRes_RMS(iVar)) {
@@ -2216,7 +2311,13 @@ void CSolver::SetResidual_RMS(CGeometry *geometry, CConfig *config) {
   if (config->GetComm_Level() == COMM_FULL) {
     
     unsigned long Local_nPointDomain = geometry->GetnPointDomain();
-    SU2_MPI::Allreduce(sbuf_residual, rbuf_residual, nVar, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    if (exact) {
+      CReproducibleSum::Allreduce(&Residual_RMS_Sum[0], nVar);
+      for (iVar = 0; iVar < nVar; iVar++) rbuf_residual[iVar] = Residual_RMS_Sum[iVar].GetValue();
+    }
+    else {
+      SU2_MPI::Allreduce(sbuf_residual, rbuf_residual, nVar, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    }
     SU2_MPI::Allreduce(&Local_nPointDomain, &Global_nPointDomain, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
     
   } else {
@@ -406,6 +406,11 @@ CEulerVariable::CEulerVariable(su2double *val_solution, unsigned short val_nDim,
 CEulerVariable::~CEulerVariable(void) {
     unsigned short iVar;
 
+  if (External_Storage) {
+    Primitive = NULL; Gradient_Primitive = NULL;
+    Limiter_Primitive = NULL;
+  }
+
   if (HB_Source         != NULL) delete [] HB_Source;
   if (Primitive         != NULL) delete [] Primitive;
   if (Secondary         != NULL) delete [] Secondary;
@@ -431,6 +436,49 @@ CEulerVariable::~CEulerVariable(void) {
 
 }
 
+void CEulerVariable::SetExternalStorage(CVariableStorage *storage, unsigned long iPoint) {
+  unsigned short iVar, iDim;
+
+  if (External_Storage) return;
+
+  /*--- The primitive fields are only moved if the storage was sized for them. ---*/
+
+  if ((Primitive != NULL) && (storage->GetnPrimVar() == nPrimVar) &&
+      (storage->GetnPrimVarGrad() == nPrimVarGrad)) {
+
+    su2double *new_Primitive = storage->GetPrimitive(iPoint);
+    su2double **new_Gradient_Primitive = storage->GetGradient_Primitive(iPoint);
+    su2double *new_Limiter_Primitive = storage->GetLimiter_Primitive(iPoint);
+
+    for (iVar = 0; iVar < nPrimVar; iVar++) new_Primitive[iVar] = Primitive[iVar];
+    delete [] Primitive;
+    Primitive = new_Primitive;
+
+    if (Gradient_Primitive != NULL) {
+      for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+        for (iDim = 0; iDim < nDim; iDim++)
+          new_Gradient_Primitive[iVar][iDim] = Gradient_Primitive[iVar][iDim];
+        delete [] Gradient_Primitive[iVar];
+      }
+      delete [] Gradient_Primitive;
+      Gradient_Primitive = new_Gradient_Primitive;
+    }
+
+    if (Limiter_Primitive != NULL) {
+      for (iVar = 0; iVar < nPrimVarGrad; iVar++) new_Limiter_Primitive[iVar] = Limiter_Primitive[iVar];
+      delete [] Limiter_Primitive;
+      Limiter_Primitive = new_Limiter_Primitive;
+    }
+
+  }
+  else if (Primitive != NULL) {
+    SU2_MPI::Error("The variable storage does not match the number of primitive variables.", CURRENT_FUNCTION);
+  }
+
+  CVariable::SetExternalStorage(storage, iPoint);
+
+}
+
 void CEulerVariable::SetGradient_PrimitiveZero(unsigned short val_primvar) {
     unsigned short iVar, iDim;
 
@@ -61,6 +61,7 @@ CVariable::CVariable(void) {
   Solution_Delta_Store = NULL;
   Solution_Save = NULL;
   Solution_Former = NULL;
+  External_Storage = false;
 
 }
 
@@ -87,6 +88,7 @@ CVariable::CVariable(unsigned short val_nvar, CConfig *config) {
   Solution_Delta_Store = NULL;
   Solution_Save = NULL;
   Solution_Former = NULL;
+  External_Storage = false;
 
   /*--- Initialize the number of solution variables. This version
    of the constructor will be used primarily for converting the
@@ -127,6 +129,7 @@ CVariable::CVariable(unsigned short val_nDim, unsigned short val_nvar, CConfig *
   Solution_Delta_Store = NULL;
   Solution_Save = NULL;
   Solution_Former = NULL;
+  External_Storage = false;
 
   /*--- Initializate the number of dimension and number of variables ---*/
   nDim = val_nDim;
@@ -182,6 +185,13 @@ CVariable::CVariable(unsigned short val_nDim, unsigned short val_nvar, CConfig *
 CVariable::~CVariable(void) {
   unsigned short iVar, iDim;
 
+  /*--- The fields held by a CVariableStorage are released by the solver. ---*/
+
+  if (External_Storage) {
+    Solution = NULL; Solution_Old = NULL;
+    Gradient = NULL; Limiter = NULL;
+  }
+
   if (Solution            != NULL) delete [] Solution;
   if (Solution_Old        != NULL) delete [] Solution_Old;
   if (Solution_time_n     != NULL) delete [] Solution_time_n;
@@ -214,3 +224,49 @@ CVariable::~CVariable(void) {
   }
 
 }
+
+void CVariable::SetExternalStorage(CVariableStorage *storage, unsigned long iPoint) {
+
+  unsigned short iVar, iDim;
+
+  if (External_Storage) return;
+
+  su2double *new_Solution = storage->GetSolution(iPoint);
+  su2double *new_Solution_Old = storage->GetSolution_Old(iPoint);
+  su2double **new_Gradient = storage->GetGradient(iPoint);
+  su2double *new_Limiter = storage->GetLimiter(iPoint);
+
+  /*--- Copy the current values and release the per-point arrays. Arrays that
+   were never allocated for this variable type are left untouched. ---*/
+
+  if (Solution != NULL) {
+    for (iVar = 0; iVar < nVar; iVar++) new_Solution[iVar] = Solution[iVar];
+    delete [] Solution;
+    Solution = new_Solution;
+  }
+
+  if (Solution_Old != NULL) {
+    for (iVar = 0; iVar < nVar; iVar++) new_Solution_Old[iVar] = Solution_Old[iVar];
+    delete [] Solution_Old;
+    Solution_Old = new_Solution_Old;
+  }
+
+  if (Gradient != NULL) {
+    for (iVar = 0; iVar < nVar; iVar++) {
+      for (iDim = 0; iDim < nDim; iDim++)
+        new_Gradient[iVar][iDim] = Gradient[iVar][iDim];
+      delete [] Gradient[iVar];
+    }
+    delete [] Gradient;
+    Gradient = new_Gradient;
+  }
+
+  if (Limiter != NULL) {
+    for (iVar = 0; iVar < nVar; iVar++) new_Limiter[iVar] = Limiter[iVar];
+    delete [] Limiter;
+    Limiter = new_Limiter;
+  }
+
+  External_Storage = true;
+
+}
@@ -0,0 +1,129 @@
+/*!
+ * \file CVariableStorage.cpp
+ * \brief Definition of the contiguous storage of the solution fields.
+ * \version 6.2.0 "Falcon"
+ *
+ * The current SU2 release has been coordinated by the
+ * SU2 International Developers Society <www.su2devsociety.org>
+ * with selected contributions from the open-source community.
+ *
+ * The main research teams contributing to the current release are:
+ *  - Prof. Juan J. Alonso's group at Stanford University.
+ *  - Prof. Piero Colonna's group at Delft University of Technology.
+ *  - Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+ *  - Prof. Alberto Guardone's group at Polytechnic University of Milan.
+ *  - Prof. Rafael Palacios' group at Imperial College London.
+ *  - Prof. Vincent Terrapon's group at the University of Liege.
+ *  - Prof. Edwin van der Weide's group at the University of Twente.
+ *  - Lab. of New Concepts in Aeronautics at Tech. Institute of Aeronautics.
+ *
+ * Copyright 2012-2019, Francisco D. Palacios, Thomas D. Economon,
+ *                      Tim Albring, and the SU2 contributors.
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/variables/CVariableStorage.hpp"
+
+#include <new>
+
+CVariableStorage::CVariableStorage(unsigned long val_nPoint, unsigned short val_nDim, unsigned short val_nVar,
+                                   unsigned short val_nPrimVar, unsigned short val_nPrimVarGrad) {
+
+  unsigned long iPoint, iVar;
+
+  nPoint       = val_nPoint;
+  nDim         = val_nDim;
+  nVar         = val_nVar;
+  nPrimVar     = val_nPrimVar;
+  nPrimVarGrad = val_nPrimVarGrad;
+
+  /*--- At most seven blocks are allocated. ---*/
+
+  RawBlock  = new char* [7];
+  nRawBlock = 0;
+
+  Solution           = AllocateBlock(nPoint*nVar);
+  Solution_Old       = AllocateBlock(nPoint*nVar);
+  Gradient           = AllocateBlock(nPoint*nVar*nDim);
+  Limiter            = AllocateBlock(nPoint*nVar);
+  Primitive          = AllocateBlock(nPoint*nPrimVar);
+  Gradient_Primitive = AllocateBlock(nPoint*nPrimVarGrad*nDim);
+  Limiter_Primitive  = AllocateBlock(nPoint*nPrimVarGrad);
+
+  /*--- Row pointers, the gradients are accessed as [iVar][iDim] by CVariable. ---*/
+
+  Gradient_Rows = new su2double* [nPoint*nVar];
+  for (iPoint = 0; iPoint < nPoint; iPoint++)
+    for (iVar = 0; iVar < nVar; iVar++)
+      Gradient_Rows[iPoint*nVar+iVar] = &Gradient[(iPoint*nVar+iVar)*nDim];
+
+  Gradient_Primitive_Rows = NULL;
+  if (nPrimVarGrad > 0) {
+    Gradient_Primitive_Rows = new su2double* [nPoint*nPrimVarGrad];
+    for (iPoint = 0; iPoint < nPoint; iPoint++)
+      for (iVar = 0; iVar < nPrimVarGrad; iVar++)
+        Gradient_Primitive_Rows[iPoint*nPrimVarGrad+iVar] = &Gradient_Primitive[(iPoint*nPrimVarGrad+iVar)*nDim];
+  }
+
+}
+
+CVariableStorage::~CVariableStorage(void) {
+
+  FreeBlock(Solution,           nPoint*nVar);
+  FreeBlock(Solution_Old,       nPoint*nVar);
+  FreeBlock(Gradient,           nPoint*nVar*nDim);
+  FreeBlock(Limiter,            nPoint*nVar);
+  FreeBlock(Primitive,          nPoint*nPrimVar);
+  FreeBlock(Gradient_Primitive, nPoint*nPrimVarGrad*nDim);
+  FreeBlock(Limiter_Primitive,  nPoint*nPrimVarGrad);
+
+  for (unsigned short iBlock = 0; iBlock < nRawBlock; iBlock++)
+    delete [] RawBlock[iBlock];
+  delete [] RawBlock;
+
+  if (Gradient_Rows           != NULL) delete [] Gradient_Rows;
+  if (Gradient_Primitive_Rows != NULL) delete [] Gradient_Primitive_Rows;
+
+}
+
+su2double *CVariableStorage::AllocateBlock(unsigned long size) {
+
+  if (size == 0) return NULL;
+
+  /*--- Over-allocate by one alignment unit and shift the start of the block
+   to the next multiple of ALIGNMENT. The su2double entries are constructed
+   in place since they may be an AD type. ---*/
+
+  char *raw = new char [size*sizeof(su2double) + ALIGNMENT];
+  RawBlock[nRawBlock++] = raw;
+
+  size_t offset = ALIGNMENT - reinterpret_cast<size_t>(raw) % ALIGNMENT;
+  su2double *block = reinterpret_cast<su2double*>(raw + offset);
+
+  for (unsigned long i = 0; i < size; i++)
+    new (&block[i]) su2double(0.0);
+
+  return block;
+
+}
+
+void CVariableStorage::FreeBlock(su2double *block, unsigned long size) {
+
+  if (block == NULL) return;
+
+  for (unsigned long i = 0; i < size; i++)
+    block[i].~su2double();
+
+}
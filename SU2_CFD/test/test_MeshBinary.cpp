@@ -0,0 +1,243 @@
+/*!
+ * \file test_MeshBinary.cpp
+ * \brief Round trip of a small mesh through the SU2_BINARY writer and reader.
+ * \version 6.2.0 "Falcon"
+ *
+ * The current SU2 release has been coordinated by the
+ * SU2 International Developers Society <www.su2devsociety.org>
+ * with selected contributions from the open-source community.
+ *
+ * The main research teams contributing to the current release are:
+ *  - Prof. Juan J. Alonso's group at Stanford University.
+ *  - Prof. Piero Colonna's group at Delft University of Technology.
+ *  - Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+ *  - Prof. Alberto Guardone's group at Polytechnic University of Milan.
+ *  - Prof. Rafael Palacios' group at Imperial College London.
+ *  - Prof. Vincent Terrapon's group at the University of Liege.
+ *  - Prof. Edwin van der Weide's group at the University of Twente.
+ *  - Lab. of New Concepts in Aeronautics at Tech. Institute of Aeronautics.
+ *
+ * Copyright 2012-2019, Francisco D. Palacios, Thomas D. Economon,
+ *                      Tim Albring, and the SU2 contributors.
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../include/output_structure.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <map>
+
+/*--- Element or boundary element as a sorted list of (VTK type, global nodes),
+ the writer groups the elements by type so the order of the list is not kept. ---*/
+
+typedef vector<unsigned long> ElemKey;
+
+static void GetElements(CGeometry *geometry, vector<ElemKey> & elems) {
+  elems.clear();
+  for (unsigned long iElem = 0; iElem < geometry->GetnElem(); iElem++) {
+    ElemKey key(1, geometry->elem[iElem]->GetVTK_Type());
+    for (unsigned short iNode = 0; iNode < geometry->elem[iElem]->GetnNodes(); iNode++)
+      key.push_back(geometry->elem[iElem]->GetNode(iNode));
+    elems.push_back(key);
+  }
+  sort(elems.begin(), elems.end());
+}
+
+static void GetMarkers(CGeometry *geometry, CConfig *config, map<string, vector<ElemKey> > & markers) {
+  markers.clear();
+  for (unsigned short iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++) {
+    vector<ElemKey> & elems = markers[config->GetMarker_All_TagBound(iMarker)];
+    for (unsigned long iElem = 0; iElem < geometry->GetnElem_Bound(iMarker); iElem++) {
+      ElemKey key(1, geometry->bound[iMarker][iElem]->GetVTK_Type());
+      for (unsigned short iNode = 0; iNode < geometry->bound[iMarker][iElem]->GetnNodes(); iNode++)
+        key.push_back(geometry->bound[iMarker][iElem]->GetNode(iNode));
+      elems.push_back(key);
+    }
+    sort(elems.begin(), elems.end());
+  }
+}
+
+int main(int argc, char *argv[]) {
+
+#ifdef HAVE_MPI
+  SU2_MPI::Init(&argc, &argv);
+  SU2_MPI::Comm MPICommunicator(MPI_COMM_WORLD);
+#else
+  SU2_Comm MPICommunicator(0);
+#endif
+
+  const unsigned long nx = 4, ny = 3;
+  unsigned long i, j, iPoint, p0, p1, p2, p3;
+  int nFail = 0;
+
+  /*--- A 2D grid of 4x3 points, the cells of the first column are split in two
+   triangles, the others are quadrilaterals. The coordinates are exact in binary. ---*/
+
+  ofstream mesh_file("test_MeshBinary.su2");
+  mesh_file.precision(15);
+  mesh_file << "NDIME= 2" << endl;
+  mesh_file << "NELEM= " << 2*(ny-1) + (nx-2)*(ny-1) << endl;
+  unsigned long iElem = 0;
+  for (j = 0; j < ny-1; j++) {
+    for (i = 0; i < nx-1; i++) {
+      p0 = j*nx+i; p1 = p0+1; p2 = p1+nx; p3 = p0+nx;
+      if (i == 0) {
+        mesh_file << TRIANGLE << "\t" << p0 << "\t" << p1 << "\t" << p2 << "\t" << iElem++ << endl;
+        mesh_file << TRIANGLE << "\t" << p0 << "\t" << p2 << "\t" << p3 << "\t" << iElem++ << endl;
+      }
+      else {
+        mesh_file << QUADRILATERAL << "\t" << p0 << "\t" << p1 << "\t" << p2 << "\t" << p3 << "\t" << iElem++ << endl;
+      }
+    }
+  }
+  mesh_file << "NPOIN= " << nx*ny << endl;
+  for (j = 0; j < ny; j++)
+    for (i = 0; i < nx; i++)
+      mesh_file << 0.75*i + 0.125*j << "\t" << 0.5*j - 0.0625*i << "\t" << j*nx+i << endl;
+  mesh_file << "NMARK= 2" << endl;
+  mesh_file << "MARKER_TAG= wall" << endl;
+  mesh_file << "MARKER_ELEMS= " << nx-1 << endl;
+  for (i = 0; i < nx-1; i++)
+    mesh_file << LINE << "\t" << i << "\t" << i+1 << endl;
+  mesh_file << "MARKER_TAG= farfield" << endl;
+  mesh_file << "MARKER_ELEMS= " << 2*(ny-1) + nx-1 << endl;
+  for (j = 0; j < ny-1; j++)
+    mesh_file << LINE << "\t" << j*nx+nx-1 << "\t" << (j+1)*nx+nx-1 << endl;
+  for (i = nx-1; i > 0; i--)
+    mesh_file << LINE << "\t" << (ny-1)*nx+i << "\t" << (ny-1)*nx+i-1 << endl;
+  for (j = ny-1; j > 0; j--)
+    mesh_file << LINE << "\t" << j*nx << "\t" << (j-1)*nx << endl;
+  mesh_file.close();
+
+  /*--- Configurations to convert the mesh (as SU2_DEF) and to read it back. ---*/
+
+  const char *config_text =
+    "PHYSICAL_PROBLEM= EULER\n"
+    "MATH_PROBLEM= DIRECT\n"
+    "MARKER_EULER= ( wall )\n"
+    "MARKER_FAR= ( farfield )\n"
+    "DV_KIND= NO_DEFORMATION\n"
+    "DV_MARKER= ( wall )\n"
+    "DV_PARAM= ( 1, 0.5 )\n"
+    "DV_VALUE= 0.0\n"
+    "VISUALIZE_SURFACE_DEF= NO\n"
+    "VISUALIZE_VOLUME_DEF= NO\n"
+    "MESH_OUT_FILENAME= test_MeshBinary.su2b\n"
+    "MESH_OUT_FORMAT= SU2_BINARY\n";
+
+  ofstream config_file("test_MeshBinary_ascii.cfg");
+  config_file << config_text << "MESH_FILENAME= test_MeshBinary.su2\nMESH_FORMAT= SU2\n";
+  config_file.close();
+  config_file.open("test_MeshBinary_binary.cfg");
+  config_file << config_text << "MESH_FILENAME= test_MeshBinary.su2b\nMESH_FORMAT= SU2_BINARY\n";
+  config_file.close();
+
+  char ascii_name[MAX_STRING_SIZE] = "test_MeshBinary_ascii.cfg";
+  char binary_name[MAX_STRING_SIZE] = "test_MeshBinary_binary.cfg";
+
+  /*--- Partition and preprocess the ASCII mesh, then write it with the binary
+   writer through the same path as SU2_DEF with DV_KIND= NO_DEFORMATION. ---*/
+
+  CConfig *driver_config = new CConfig(ascii_name, SU2_DEF, SINGLE_ZONE, false);
+  CConfig **config_container = new CConfig*[SINGLE_ZONE];
+  config_container[ZONE_0] = new CConfig(driver_config, ascii_name, SU2_DEF, ZONE_0, SINGLE_ZONE, false);
+  config_container[ZONE_0]->SetMPICommunicator(MPICommunicator);
+
+  CGeometry *geometry_aux = new CPhysicalGeometry(config_container[ZONE_0], ZONE_0, SINGLE_ZONE);
+  geometry_aux->SetColorGrid_Parallel(config_container[ZONE_0]);
+
+  CGeometry **geometry_container = new CGeometry*[SINGLE_ZONE];
+  geometry_container[ZONE_0] = new CPhysicalGeometry(geometry_aux, config_container[ZONE_0]);
+  delete geometry_aux;
+
+  geometry_container[ZONE_0]->SetSendReceive(config_container[ZONE_0]);
+  geometry_container[ZONE_0]->SetBoundaries(config_container[ZONE_0]);
+  geometry_container[ZONE_0]->SetPoint_Connectivity();
+  geometry_container[ZONE_0]->SetBoundVolume();
+  geometry_container[ZONE_0]->SetEdges();
+  geometry_container[ZONE_0]->SetVertex(config_container[ZONE_0]);
+  geometry_container[ZONE_0]->PreprocessP2PComms(geometry_container[ZONE_0], config_container[ZONE_0]);
+
+  COutput *output = new COutput(config_container[ZONE_0]);
+  output->SetMesh_Files(geometry_container, config_container, SINGLE_ZONE, true, true);
+
+  /*--- Read both meshes with the (linear partition) readers and compare. ---*/
+
+  CGeometry *geometry_ascii = new CPhysicalGeometry(config_container[ZONE_0], ZONE_0, SINGLE_ZONE);
+
+  CConfig *driver_config_bin = new CConfig(binary_name, SU2_DEF, SINGLE_ZONE, false);
+  CConfig *config_bin = new CConfig(driver_config_bin, binary_name, SU2_DEF, ZONE_0, SINGLE_ZONE, false);
+  config_bin->SetMPICommunicator(MPICommunicator);
+  CGeometry *geometry_bin = new CPhysicalGeometry(config_bin, ZONE_0, SINGLE_ZONE);
+
+  if ((geometry_bin->GetnDim() != geometry_ascii->GetnDim()) ||
+      (geometry_bin->GetnPoint() != geometry_ascii->GetnPoint()) ||
+      (geometry_bin->GetGlobal_nPointDomain() != geometry_ascii->GetGlobal_nPointDomain())) {
+    cout << "Wrong dimension or number of points of the binary mesh." << endl;
+    nFail++;
+  }
+  else {
+    for (iPoint = 0; iPoint < geometry_ascii->GetnPoint(); iPoint++) {
+      if (geometry_bin->node[iPoint]->GetGlobalIndex() != geometry_ascii->node[iPoint]->GetGlobalIndex()) nFail++;
+      for (unsigned short iDim = 0; iDim < geometry_ascii->GetnDim(); iDim++)
+        if (geometry_bin->node[iPoint]->GetCoord(iDim) != geometry_ascii->node[iPoint]->GetCoord(iDim)) nFail++;
+    }
+    if (nFail > 0) cout << "Wrong coordinates of the binary mesh." << endl;
+  }
+
+  vector<ElemKey> elems_ascii, elems_bin;
+  GetElements(geometry_ascii, elems_ascii);
+  GetElements(geometry_bin, elems_bin);
+  if (elems_ascii != elems_bin) {
+    cout << "Wrong elements of the binary mesh." << endl;
+    nFail++;
+  }
+
+  map<string, vector<ElemKey> > markers_ascii, markers_bin;
+  GetMarkers(geometry_ascii, config_container[ZONE_0], markers_ascii);
+  GetMarkers(geometry_bin, config_bin, markers_bin);
+  if (markers_ascii != markers_bin) {
+    cout << "Wrong markers of the binary mesh." << endl;
+    nFail++;
+  }
+
+  if (nFail == 0) cout << "Round trip of the SU2_BINARY mesh format: passed." << endl;
+
+  delete geometry_bin;
+  delete config_bin;
+  delete driver_config_bin;
+  delete geometry_ascii;
+  delete output;
+  delete geometry_container[ZONE_0];
+  delete [] geometry_container;
+  delete config_container[ZONE_0];
+  delete [] config_container;
+  delete driver_config;
+
+  /*--- The readers of SU2_DEF also write the boundary information to a file. ---*/
+
+  remove("boundary.dat");
+  remove("test_MeshBinary.su2");
+  remove("test_MeshBinary.su2b");
+  remove("test_MeshBinary_ascii.cfg");
+  remove("test_MeshBinary_binary.cfg");
+
+#ifdef HAVE_MPI
+  SU2_MPI::Finalize();
+#endif
+
+  return (nFail == 0)? 0 : 1;
+}